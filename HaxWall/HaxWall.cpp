@@ -3,24 +3,54 @@
 #include "stdafx.h"
 
 //#define BLOCK_DATA_CENTERS // uncomment flag when compiling flavors
+//#define PREINSTALL_DATA_CENTERS // with BLOCK_DATA_CENTERS, block the whole list in the kernel at startup
+//#define PERSISTENT_FILTERS // keep filters across restarts instead of a dynamic session
+//#define EVENT_JOURNAL // record every event in the binary journal, see scripts/journal.py
+//#define WARM_START_CLIENTS // also restore the active clients of the previous run from the snapshot
+//#define CAPTURE_IPV6 // also protect the IPv6 addresses of the interfaces, sources are tracked per IPV6_PREFIX network
 
 #include "ban.h"
 #include "PacketFilter.h"
+#include "ban_aggregator.h"
+#include "capture.h"
+#include "journal.h"
+#include "policy.h"
+#include "range_list.h"
+#include "snapshot.h"
+#include "verification.h"
 #include <Winsock2.h>
 #include <Mstcpip.h>
 #include <Iphlpapi.h>
 #include <Ws2tcpip.h>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
 #include <cstdint>
+#include <fstream>
 #include <iostream>
 #include <list>
+#include <mutex>
+#include <sstream>
+#include <thread>
 #include "haxball_whitelist.h"
 
 #pragma comment(lib, "Ws2_32.lib")
 #pragma comment(lib, "Iphlpapi.lib")
 
-#define VERIFICATION_PORT 1337 // Port for signature verification service
+#define VERIFICATION_PORT 1337 // Port for signature verification service, see verification.h
+#define STATS_INTERVAL 60 // seconds between console summaries, 0 disables them
+#define DATA_CENTERS_IPV6 "lists\\data_centers6.txt" // IPv6 networks, one a:b::/prefix per line
 
 PacketFilter pktFilter;
+BanAggregator aggregator; // only used by the ban worker once capture starts
+EventJournal journal;
+AttackFirewall *firewall = NULL;
+bool blacklist_in_kernel = false; // data center ranges installed as filters instead of checked per source
+std::mutex snapshot_lock; // the exit handler may save while the periodic snapshot is written
+std::mutex exit_lock;
+std::condition_variable exit_wake; // wakes up main and the periodic threads on exit, and the exit handler once main is done
+bool exit_requested = false;
+bool exit_done = false;
 
 void DisableQuickEditMode()
 {
@@ -78,20 +108,230 @@ void ListIpAddresses(std::list<SOCKADDR_IN> &list)
 	}
 }
 
+// One address per adapter, every raw socket of an adapter already sees all of its traffic.
+// Link-local addresses are skipped, their traffic never comes from the internet.
+void ListIpv6Addresses(std::list<SOCKADDR_IN6> &list)
+{
+	IP_ADAPTER_ADDRESSES adapter_addresses[0xFF];
+	DWORD adapter_addresses_buffer_size = sizeof(adapter_addresses);
+
+	DWORD error = ::GetAdaptersAddresses(
+		AF_INET6,
+		GAA_FLAG_SKIP_ANYCAST |
+		GAA_FLAG_SKIP_MULTICAST |
+		GAA_FLAG_SKIP_DNS_SERVER |
+		GAA_FLAG_SKIP_FRIENDLY_NAME,
+		NULL,
+		adapter_addresses,
+		&adapter_addresses_buffer_size);
+
+	if (error != ERROR_SUCCESS)
+	{
+		return;
+	}
+
+	for (IP_ADAPTER_ADDRESSES* adapter = adapter_addresses; NULL != adapter; adapter = adapter->Next)
+	{
+		if (IF_TYPE_SOFTWARE_LOOPBACK == adapter->IfType)
+		{
+			continue;
+		}
+
+		for (
+			IP_ADAPTER_UNICAST_ADDRESS* address = adapter->FirstUnicastAddress;
+			NULL != address;
+			address = address->Next)
+		{
+			SOCKADDR_IN6* ipv6 = reinterpret_cast<SOCKADDR_IN6*>(address->Address.lpSockaddr);
+			if (AF_INET6 == ipv6->sin6_family && !IN6_IS_ADDR_LINKLOCAL(&ipv6->sin6_addr))
+			{
+				list.push_back(*ipv6);
+				break;
+			}
+		}
+	}
+}
+
+// Parses an IPv6 network list, lines that are not a network are skipped
+std::vector<CIDR6> LoadNetworks6(const char *path)
+{
+	std::vector<CIDR6> networks;
+	std::ifstream in(path);
+	std::string line;
+	while (std::getline(in, line))
+	{
+		size_t slash = line.find('/');
+		IN6_ADDR addr;
+		if (slash == std::string::npos || inet_pton(AF_INET6, line.substr(0, slash).c_str(), &addr) != 1)
+		{
+			continue;
+		}
+		CIDR6 network = { IPv6FromBytes(addr.u.Byte), (uint8_t)atoi(line.c_str() + slash + 1) };
+		networks.push_back(network);
+	}
+	return networks;
+}
+
 void ban(uint32_t saddr)
 {
-	char buf[INET_ADDRSTRLEN];
-	snprintf(buf, sizeof(buf), "%d.%d.%d.%d", (saddr >> 24) & 0xFF, (saddr >> 16) & 0xFF,
-		(saddr >> 8) & 0xFF, saddr & 0xFF);
-	pktFilter.Block(buf);
+	pktFilter.Block(saddr);
 }
 
 void unban(uint32_t saddr)
 {
-	char buf[INET_ADDRSTRLEN];
-	snprintf(buf, sizeof(buf), "%d.%d.%d.%d", (saddr >> 24) & 0xFF, (saddr >> 16) & 0xFF,
-		(saddr >> 8) & 0xFF, saddr & 0xFF);
-	pktFilter.Unblock(buf);
+	pktFilter.Unblock(saddr);
+}
+
+void ban6(const CIDR6 &network)
+{
+	pktFilter.Block6(network);
+}
+
+void unban6(const CIDR6 &network)
+{
+	pktFilter.Unblock6(network);
+}
+
+void reconcile(const uint32_t *add, size_t add_count, const uint32_t *remove, size_t remove_count)
+{
+	static std::vector<CIDR> filter_add, filter_remove; // ban worker thread only
+	aggregator.Reconcile(add, add_count, remove, remove_count, filter_add, filter_remove);
+	{
+		StatTimer timer(StatHistogram::FilterLatency);
+		pktFilter.ApplyBans(filter_add.data(), filter_add.size(), filter_remove.data(), filter_remove.size());
+	}
+	filter_add.clear();
+	filter_remove.clear();
+}
+
+void reconcile6(const uint64_t *add, size_t add_count, const uint64_t *remove, size_t remove_count)
+{
+	static std::vector<CIDR6> filter_add, filter_remove; // ban worker thread only
+	for (size_t i = 0; i < add_count; i++)
+	{
+		filter_add.push_back(AttackFirewall::Network6(add[i]));
+	}
+	for (size_t i = 0; i < remove_count; i++)
+	{
+		filter_remove.push_back(AttackFirewall::Network6(remove[i]));
+	}
+	{
+		StatTimer timer(StatHistogram::FilterLatency);
+		pktFilter.ApplyBans6(filter_add.data(), filter_add.size(), filter_remove.data(), filter_remove.size());
+	}
+	filter_add.clear();
+	filter_remove.clear();
+}
+
+void WriteStats(std::ostream &out)
+{
+	GlobalStatistics().Write(out);
+	BanWorkerStats worker = firewall->WorkerStats();
+	out << "clients " << firewall->ClientCount() << "\n";
+	out << "bans " << firewall->BanCount() << "\n";
+	out << "flood_mode " << (firewall->FloodMode() ? 1 : 0) << "\n";
+	out << "collapsed_prefixes " << aggregator.Collapsed() << "\n";
+	out << "ban_queue_depth " << worker.depth << " max " << worker.max_depth << " stalls " << worker.stalls << "\n";
+	out << "ban_batches " << worker.batches << " commands " << worker.commands << " coalesced " << worker.coalesced << "\n";
+	out << "ban_latency_us last " << worker.last_latency << " max " << worker.max_latency << "\n";
+}
+
+// Sleeps for the interval, returns false once exiting
+bool WaitForInterval(unsigned int seconds)
+{
+	std::unique_lock<std::mutex> lock(exit_lock);
+	return !exit_wake.wait_for(lock, std::chrono::seconds(seconds), []() { return exit_requested; });
+}
+
+void SummarizeStats()
+{
+	uint64_t last_packets = GlobalStatistics().Get(Stat::PacketsReceived);
+	uint64_t last_bans = 0;
+	while (WaitForInterval(STATS_INTERVAL))
+	{
+		Statistics &stats = GlobalStatistics();
+		uint64_t packets = stats.Get(Stat::PacketsReceived);
+		uint64_t bans = stats.Get(Stat::BansBlacklist) + stats.Get(Stat::BansMultiport) + stats.Get(Stat::BansFlood);
+		std::cout << "[Stats] " << (packets - last_packets) / STATS_INTERVAL << " packets/s, "
+			<< bans - last_bans << " new bans, " << firewall->ClientCount() << " clients, "
+			<< firewall->BanCount() << " banned, ban queue " << firewall->WorkerStats().depth << std::endl;
+		last_packets = packets;
+		last_bans = bans;
+	}
+}
+
+void WriteSnapshot()
+{
+	std::vector<SnapshotBan> bans;
+	std::vector<SnapshotBan6> bans6;
+	std::vector<SnapshotClient> clients;
+#ifdef WARM_START_CLIENTS
+	firewall->Snapshot(bans, bans6, &clients);
+#else
+	firewall->Snapshot(bans, bans6, NULL);
+#endif
+	std::lock_guard<std::mutex> lock(snapshot_lock);
+	SaveSnapshot(SNAPSHOT_PATH, bans, bans6, clients);
+}
+
+void SnapshotPeriodically()
+{
+	while (WaitForInterval(SNAPSHOT_INTERVAL))
+	{
+		WriteSnapshot();
+	}
+}
+
+void journal_event(JournalEvent event, BanReason reason, uint32_t addr, uint16_t port)
+{
+	journal.Append(event, reason, addr, port);
+}
+
+// Called on the verification thread, a room bot queries every joining player so only the journal records it
+void verification_query(uint32_t addr, bool active)
+{
+	journal.Append(JournalEvent::Query, BanReason::None, addr, 0);
+}
+
+void ProcessPackets(const CapturedPacket *packets, size_t count)
+{
+	firewall->UpdateClock();
+	firewall->ReceiveBatch(packets, count);
+	firewall->ClearOldEntries();
+}
+
+void ProcessPackets6(const CapturedPacket6 *packets, size_t count)
+{
+	firewall->UpdateClock();
+	firewall->ReceiveBatch6(packets, count);
+	firewall->ClearOldEntries();
+}
+
+// Called on the purge thread, rates are per second
+void flood_changed(bool active, uint64_t new_sources, uint64_t packets)
+{
+	if (active)
+	{
+		std::cout << "Flood detected (" << new_sources << " new sources/s, " << packets << " packets/s), "
+			"only known and verified sources are tracked." << std::endl;
+	}
+	else
+	{
+		std::cout << "Flood over, tracking new sources again." << std::endl;
+	}
+}
+
+// Called on the list watcher thread with the lists that replace the current ones
+void lists_changed(const CIDRMatcher *blacklist, const CIDRMatcher *exceptions)
+{
+	// Preinstalled range filters keep the startup list until the next restart
+	firewall->ReplaceLists(blacklist_in_kernel ? NULL : blacklist, exceptions);
+}
+
+// Called on the policy watcher thread, NULL restores the compiled-in limits
+void policy_changed(const PolicyTable *policy)
+{
+	firewall->SetPolicy(policy);
 }
 
 BOOL WINAPI ConsoleHandlerRoutine(DWORD dwCtrlType)
@@ -102,10 +342,15 @@ BOOL WINAPI ConsoleHandlerRoutine(DWORD dwCtrlType)
 		case CTRL_LOGOFF_EVENT:
 		case CTRL_SHUTDOWN_EVENT:
 		case CTRL_C_EVENT:
+		{
+			// Main joins every thread, writes the snapshot and stops the filter before it returns
 			std::cout << "Exiting..." << std::endl;
-			pktFilter.StopFirewall();
-			exit(0);
+			std::unique_lock<std::mutex> lock(exit_lock);
+			exit_requested = true;
+			exit_wake.notify_all();
+			exit_wake.wait(lock, []() { return exit_done; });
 			return TRUE;
+		}
 		default:
 			break;
 	}
@@ -117,7 +362,12 @@ int main()
 	DisableQuickEditMode(); // https://stackoverflow.com/q/30418886
 
 	// Start firewall.
-	if (pktFilter.StartFirewall())
+#ifdef PERSISTENT_FILTERS
+	bool persistent = true;
+#else
+	bool persistent = false;
+#endif
+	if (pktFilter.StartFirewall(persistent))
 	{
 		std::cout << "Packet filter started successfully..." << std::endl;
 	}
@@ -143,66 +393,210 @@ int main()
 		return 1;
 	}
 
-	unsigned char data[0xFFFF];
 	AttackFirewall fw(ban, unban);
+	fw.SetReconcileFunction(reconcile, reconcile6);
+	fw.SetIPv6Functions(ban6, unban6);
+	fw.SetFloodFunction(flood_changed);
+#ifdef EVENT_JOURNAL
+	if (journal.Open())
+	{
+		fw.SetEventFunction(journal_event);
+	}
+#endif
+	firewall = &fw;
+
+	// Destroyed before the firewall, the watcher never sees it go away
+#ifdef BLOCK_DATA_CENTERS
+	ListReloader lists(LIST_DATA_CENTERS, &DataCenters, LIST_WHITELIST, &HaxBallMatcher);
+#else
+	ListReloader lists(NULL, NULL, LIST_WHITELIST, &HaxBallMatcher);
+#endif
+	lists.Load();
+	PolicyReloader policies(POLICY_PATH);
+	policies.Load();
+	fw.SetPolicy(policies.Current());
+
+	// Not reloaded, the IPv6 list is read once at startup
+#if defined(CAPTURE_IPV6) && defined(BLOCK_DATA_CENTERS)
+	std::vector<CIDR6> networks6 = LoadNetworks6(DATA_CENTERS_IPV6);
+	CIDR6Matcher data_centers6(networks6.data(), networks6.size());
+	if (data_centers6.Size() > 0)
+	{
+		std::cout << "Loaded " << data_centers6.Size() << " IPv6 data center ranges." << std::endl;
+		fw.SetBlacklist6(&data_centers6);
+	}
+#endif
 
-	FD_SET socket_set;
-	FD_SET backup_set;
-	FD_ZERO(&socket_set);
-	FD_SET* current_set = &socket_set;
-	FD_SET* next_set = &backup_set;
+	// Saved bans keep their remaining time, filters kept from the previous run without a
+	// saved ban start a fresh ban duration
+	std::vector<SnapshotBan> saved_bans;
+	std::vector<SnapshotBan6> saved_bans6;
+	std::vector<SnapshotClient> saved_clients;
+	LoadSnapshot(SNAPSHOT_PATH, (uint32_t)SECONDS_TO_TICKS(TIMEOUT), saved_bans, saved_bans6, saved_clients);
+	std::vector<UINT32> restored;
+	pktFilter.RestoredAddresses(restored);
+	fw.UpdateClock();
+	for (auto it = saved_bans.begin(); it != saved_bans.end(); it++)
+	{
+		if (fw.RestoreBan(it->addr, it->remaining, it->reason))
+		{
+			journal.Append(JournalEvent::Ban, BanReason::Restored, it->addr, 0);
+		}
+	}
+	for (auto it = restored.begin(); it != restored.end(); it++)
+	{
+		aggregator.Restore(*it);
+		if (fw.RestoreBan(*it))
+		{
+			journal.Append(JournalEvent::Ban, BanReason::Restored, *it, 0);
+		}
+	}
 
-	bool bound = false;
-	std::list<SOCKET> sockets;
+	// Saved bans without a filter are installed in one transaction before capture starts
+	std::sort(restored.begin(), restored.end());
+	std::vector<uint32_t> missing;
+	for (auto it = saved_bans.begin(); it != saved_bans.end(); it++)
+	{
+		if (!std::binary_search(restored.begin(), restored.end(), it->addr))
+		{
+			missing.push_back(it->addr);
+		}
+	}
+	if (!missing.empty())
+	{
+		std::vector<CIDR> filter_add, filter_remove;
+		aggregator.Reconcile(missing.data(), missing.size(), NULL, 0, filter_add, filter_remove);
+		DWORD ban_result = pktFilter.ApplyBans(filter_add.data(), filter_add.size(), NULL, 0);
+		if (ban_result != ERROR_SUCCESS)
+		{
+			std::cerr << "Failed to install the saved bans: " << ban_result << std::endl;
+		}
+	}
+
+	// IPv6 bans are restored the same way. Filters of networks the firewall does not track,
+	// without IPv6 capture or from another IPV6_PREFIX, are deleted instead.
+	std::vector<CIDR6> restored6, missing6, stale6;
+	std::vector<uint64_t> restored_networks;
+	pktFilter.RestoredNetworks6(restored6);
+#ifdef CAPTURE_IPV6
+	for (auto it = saved_bans6.begin(); it != saved_bans6.end(); it++)
+	{
+		fw.RestoreBan6(it->network, it->remaining, it->reason);
+	}
+#endif
+	for (auto it = restored6.begin(); it != restored6.end(); it++)
+	{
+#ifdef CAPTURE_IPV6
+		if (it->prefix == IPV6_PREFIX && it->network.low == 0 && (it->network.high & CIDR6HostMask(IPV6_PREFIX)) == 0)
+		{
+			fw.RestoreBan6(it->network.high);
+			restored_networks.push_back(it->network.high);
+			continue;
+		}
+#endif
+		stale6.push_back(*it);
+	}
+#ifdef CAPTURE_IPV6
+	std::sort(restored_networks.begin(), restored_networks.end());
+	for (auto it = saved_bans6.begin(); it != saved_bans6.end(); it++)
+	{
+		if (!std::binary_search(restored_networks.begin(), restored_networks.end(), it->network))
+		{
+			missing6.push_back(AttackFirewall::Network6(it->network));
+		}
+	}
+#endif
+	if (!missing6.empty() || !stale6.empty())
+	{
+		DWORD ban_result = pktFilter.ApplyBans6(missing6.data(), missing6.size(), stale6.data(), stale6.size());
+		if (ban_result != ERROR_SUCCESS)
+		{
+			std::cerr << "Failed to install the saved IPv6 bans: " << ban_result << std::endl;
+		}
+	}
+	for (auto it = saved_clients.begin(); it != saved_clients.end(); it++)
+	{
+		fw.RestoreClient(*it);
+	}
+	if (!restored.empty() || !saved_bans.empty() || !restored_networks.empty() || !saved_bans6.empty() || !saved_clients.empty())
+	{
+		std::cout << "Restored " << fw.BanCount() << " bans and " << fw.ClientCount() << " clients." << std::endl;
+	}
+#ifdef CAPTURE_IPV6
+	CaptureEngine capture(ProcessPackets, ProcessPackets6);
+#else
+	CaptureEngine capture(ProcessPackets);
+#endif
 
-	SOCKET verification_socket = socket(AF_INET, SOCK_DGRAM, 0);
-	struct sockaddr_in verification_addr;
-	verification_addr.sin_family = AF_INET;
-	verification_addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
-	verification_addr.sin_port = htons(VERIFICATION_PORT);
-	u_long nonblocking = 1;
-	if (verification_socket == INVALID_SOCKET)
+#ifdef BLOCK_DATA_CENTERS
+	std::cout << "Data center blacklisting enabled." << std::endl;
+#ifdef PREINSTALL_DATA_CENTERS
+	// The kernel drops data center traffic directly, no per-address bans are needed
+	auto install_start = std::chrono::steady_clock::now();
+	std::vector<CIDRRange> dc_ranges = SubtractRanges(*lists.Blacklist(), lists.Exceptions());
+	DWORD install_result = ERROR_SUCCESS;
+	if (!pktFilter.RangesInstalled(dc_ranges.data(), dc_ranges.size()))
 	{
-		std::cerr << "Failed to start verification service." << std::endl;
+		// Persistent filters of another list version are replaced
+		pktFilter.RemoveRanges();
+		install_result = pktFilter.InstallRanges(dc_ranges.data(), dc_ranges.size());
 	}
-	else if (bind(verification_socket, (struct sockaddr*)&verification_addr, sizeof(verification_addr)) == SOCKET_ERROR)
+	auto install_time = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - install_start);
+	if (install_result == ERROR_SUCCESS)
 	{
-		std::cerr << "Failed to bind to verification service: " << WSAGetLastError() << std::endl;
+		std::cout << "Installed " << pktFilter.RangeFilterCount() << " data center range filters in " << install_time.count() << " ms." << std::endl;
+		fw.SetBlacklist(NULL, lists.Exceptions());
+		blacklist_in_kernel = true;
 	}
 	else
 	{
-		FD_SET(verification_socket, &socket_set);
-		sockets.push_back(verification_socket);
+		std::cerr << "Failed to install data center filters: " << install_result << ", banning addresses as they are seen." << std::endl;
+		fw.SetBlacklist(lists.Blacklist(), lists.Exceptions());
 	}
+#else
+	fw.SetBlacklist(lists.Blacklist(), lists.Exceptions());
+#endif
+#else
+	std::cout << "Data center blacklisting disabled." << std::endl;
+	fw.SetBlacklist(NULL, lists.Exceptions());
+#endif
+	lists.Start(lists_changed);
+	policies.Start(policy_changed);
 
+	// Subnets of our own interfaces are never blocked as a whole
 	for (auto it = bind_addrs.begin(); it != bind_addrs.end(); it++)
 	{
-		SOCKET sock = socket(AF_INET, SOCK_RAW, IPPROTO_IP);
-		if (sock != INVALID_SOCKET)
-		{
-			SOCKADDR_IN bind_addr = *it;
-			if (bind(sock, (struct sockaddr*)&bind_addr, sizeof(SOCKADDR_IN)) != 0)
-			{
-				std::cerr << "Failed to bind socket: " << WSAGetLastError() << std::endl;
-				continue;
-			}
-			unsigned int opt = RCVALL_IPLEVEL;
-			DWORD ret;
-			if (WSAIoctl(sock, SIO_RCVALL, &opt, sizeof(opt), 0, 0, &ret, 0, 0) != 0)
-			{
-				std::cerr << "Failed to enable promiscuous mode: " << WSAGetLastError() << std::endl;
-				continue;
-			}
+		aggregator.AddException(ntohl(*((uint32_t*)&it->sin_addr)));
+	}
 
-			uint32_t address = ntohl(*((uint32_t*)&bind_addr.sin_addr));
-			fw.AddWhitelist(address);
+	bool bound = false;
+	for (auto it = bind_addrs.begin(); it != bind_addrs.end(); it++)
+	{
+		uint32_t address = ntohl(*((uint32_t*)&it->sin_addr));
+		fw.AddWhitelist(address); // before its receive thread starts delivering packets
+		if (capture.AddInterface(*it))
+		{
 			fw.Log("Protecting", address);
+			journal.Append(JournalEvent::Protecting, BanReason::None, address, 0);
+			bound = true;
+		}
+	}
 
-			FD_SET(sock, &socket_set);
-			sockets.push_back(sock);
+#ifdef CAPTURE_IPV6
+	// Other hosts of our own networks are trusted like private IPv4 networks
+	std::list<SOCKADDR_IN6> bind_addrs6;
+	ListIpv6Addresses(bind_addrs6);
+	for (auto it = bind_addrs6.begin(); it != bind_addrs6.end(); it++)
+	{
+		IPv6Address address = IPv6FromBytes(it->sin6_addr.u.Byte);
+		fw.AddWhitelist6(address);
+		if (capture.AddInterface(*it))
+		{
+			fw.Log6("Protecting", address);
 			bound = true;
 		}
 	}
+#endif
 
 	if (!bound)
 	{
@@ -210,88 +604,57 @@ int main()
 		return 1;
 	}
 
-#ifdef BLOCK_DATA_CENTERS
-	std::cout << "Data center blacklisting enabled." << std::endl;
-	fw.SetBlacklist(&DataCenters, &HaxBallMatcher);
-#else
-	std::cout << "Data center blacklisting disabled." << std::endl;
-	fw.SetBlacklist(NULL, &HaxBallMatcher);
-#endif
-
 	std::cout << "Firewall started. Keep this window open." << std::endl << std::endl;
 
-	struct sockaddr_in receiver;
-	int receiver_len = sizeof(receiver);
+	std::thread summary, snapshots;
+	if (STATS_INTERVAL > 0)
+	{
+		summary = std::thread(SummarizeStats);
+	}
+	if (SNAPSHOT_INTERVAL > 0)
+	{
+		snapshots = std::thread(SnapshotPeriodically);
+	}
+
+	VerificationService verification(fw, verification_query, WriteStats);
+	verification.Start(VERIFICATION_PORT);
 
-	while (1)
+	bool requested;
 	{
-		FD_ZERO(next_set);
-		if (select(0, current_set, NULL, NULL, NULL) == SOCKET_ERROR)
+		std::unique_lock<std::mutex> lock(exit_lock);
+		while (!exit_wake.wait_for(lock, std::chrono::seconds(1), []() { return exit_requested; }) && capture.Running())
 		{
-			std::cerr << "Error: Select failed. " << WSAGetLastError() << std::endl;
-			return 1;
-		}
-		for (auto it = sockets.begin(); it != sockets.end(); it++)
-		{
-			FD_SET(*it, next_set);
-			if (!FD_ISSET(*it, current_set))
-			{
-				continue;
-			}
-			int count = (*it != verification_socket) ? recvfrom(*it, (char *)data, sizeof(data), 0, NULL, NULL)
-				: recvfrom(*it, (char *)data, sizeof(data), 0, (struct sockaddr*)&receiver, &receiver_len);
-			if (count > 0)
-			{
-				if (*it == verification_socket)
-				{
-					if (count != 4)
-					{
-						continue;
-					}
-					uint32_t addr = ntohl(*((uint32_t*)data));
-					data[0] = fw.IsActive(addr) ? 1 : 0;
-					fw.Log("Query:", addr);
-					sendto(*it, (char*)data, 1, 0, (struct sockaddr*)&receiver, receiver_len);
-					continue;
-				}
-
-				if (count < 28 || data[9] != 0x11) // Must be IP header with UDP payload
-				{
-					continue;
-				}
-
-				uint32_t saddr = ntohl(*((uint32_t*)(data + 12)));
-				uint32_t daddr = ntohl(*((uint32_t*)(data + 16)));
-				uint16_t sport = ntohs(*((uint16_t*)(data + 20)));
-				uint16_t dport = ntohs(*((uint16_t*)(data + 22)));
-
-				if (sport < 1024 || dport < 1024 || dport == 3389) // Allow incoming and outgoing low port services like DNS and do not ban RDP packets.
-				{
-					// The source port check actually decreases the effectiveness of the firewall.
-					// However, the usual skid will hardly be able to make it around this check.
-					continue;
-				}
-
-				fw.ReceivePacket(saddr, sport);
-				fw.ClearOldEntries();
-			}
-			else
-			{
-				std::cerr << "An error occured." << std::endl;
-				return 1;
-			}
-		}
-		if (current_set == &socket_set)
-		{
-			current_set = &backup_set;
-			next_set = &socket_set;
-		}
-		else
-		{
-			current_set = &socket_set;
-			next_set = &backup_set;
 		}
+		requested = exit_requested;
+		exit_requested = true; // also ends the periodic threads after a capture failure
+		exit_wake.notify_all();
+	}
+	if (!requested)
+	{
+		std::cerr << "An error occured." << std::endl;
+	}
+
+	// Nothing feeds the firewall or touches the packet filter once these are joined
+	capture.Stop();
+	verification.Stop();
+	policies.Stop();
+	lists.Stop();
+	if (summary.joinable())
+	{
+		summary.join();
+	}
+	if (snapshots.joinable())
+	{
+		snapshots.join();
 	}
-    return 0;
+	fw.StopWorker();
+	WriteSnapshot();
+	pktFilter.StopFirewall();
+	journal.Close();
+
+	std::lock_guard<std::mutex> lock(exit_lock);
+	exit_done = true;
+	exit_wake.notify_all();
+	return requested ? 0 : 1;
 }
 
@@ -13,6 +13,11 @@
 #pragma comment(lib, "Fwpuclnt.lib")
 #pragma comment(lib, "Rpcrt4.lib")
 
+// Stable sublayer key of the persistent mode.
+// {6C1E4F2A-3B9D-4E57-9A1C-5D2F8B7E0C41}
+static const GUID FIREWALL_SUBLAYER_KEY =
+{ 0x6c1e4f2a, 0x3b9d, 0x4e57, { 0x9a, 0x1c, 0x5d, 0x2f, 0x8b, 0x7e, 0x0c, 0x41 } };
+
 /******************************************************************************
 PacketFilter::PacketFilter() - Constructor
 *******************************************************************************/
@@ -22,6 +27,7 @@ PacketFilter::PacketFilter()
     {
         // Initialize member variables.
         m_hEngineHandle = NULL;
+        m_bPersistent = false;
         ::ZeroMemory( &m_subLayerGUID, sizeof( GUID ) );
     }
     catch(...)
@@ -55,11 +61,17 @@ DWORD PacketFilter::CreateDeleteInterface( bool bCreate )
     {
         if( bCreate )
         {
+            FWPM_SESSION0 Session = {0};
+
+            // Objects of a dynamic session are deleted by the engine when the handle
+            // closes, including after a crash.
+            Session.flags = m_bPersistent ? 0 : FWPM_SESSION_FLAG_DYNAMIC;
+
             // Create packet filter interface.
             dwFwAPiRetCode =  ::FwpmEngineOpen0( NULL,
                                                  RPC_C_AUTHN_WINNT,
                                                  NULL,
-                                                 NULL,
+                                                 &Session,
                                                  &m_hEngineHandle );
         }
         else
@@ -92,8 +104,15 @@ DWORD PacketFilter::BindUnbindInterface( bool bBind )
             RPC_STATUS rpcStatus = {0};
             FWPM_SUBLAYER0 SubLayer = {0};
 
-            // Create a GUID for our packet filter layer.
-            rpcStatus = ::UuidCreate( &SubLayer.subLayerKey );
+            // Create a GUID for our packet filter layer, the persistent one is fixed.
+            if( m_bPersistent )
+            {
+                SubLayer.subLayerKey = FIREWALL_SUBLAYER_KEY;
+            }
+            else
+            {
+                rpcStatus = ::UuidCreate( &SubLayer.subLayerKey );
+            }
             if( NO_ERROR == rpcStatus )
             {
                 // Save GUID.
@@ -104,13 +123,19 @@ DWORD PacketFilter::BindUnbindInterface( bool bBind )
                 // Populate packet filter layer information.
                 SubLayer.displayData.name = FIREWALL_SUBLAYER_NAMEW;
                 SubLayer.displayData.description = FIREWALL_SUBLAYER_NAMEW;
-                SubLayer.flags = 0;
+                SubLayer.flags = m_bPersistent ? FWPM_SUBLAYER_FLAG_PERSISTENT : 0;
                 SubLayer.weight = 0x100;
 
                 // Add packet filter to our interface.
                 dwFwAPiRetCode = ::FwpmSubLayerAdd0( m_hEngineHandle,
                                                      &SubLayer,
                                                      NULL );
+
+                // Left by a previous run, its filters are restored separately.
+                if( m_bPersistent && FWP_E_ALREADY_EXISTS == dwFwAPiRetCode )
+                {
+                    dwFwAPiRetCode = ERROR_SUCCESS;
+                }
             }
         }
         else
@@ -175,6 +200,456 @@ bool PacketFilter::ParseIPAddrString( char* szIpAddr, UINT nStrLen, BYTE* pbHost
     return bRet;
 }
 
+/******************************************************************************
+PacketFilter::AddFilter - Adds a block filter for a host order network and
+                          remembers its id. Caller holds m_filterLock.
+*******************************************************************************/
+DWORD PacketFilter::AddFilter( const CIDR& network )
+{
+	FWPM_FILTER0 Filter = { 0 };
+	FWPM_FILTER_CONDITION0 Condition = { 0 };
+	FWP_V4_ADDR_AND_MASK AddrMask = { 0 };
+	UINT64 u64VistaFilterId = 0;
+
+	// Prepare filter condition.
+	Filter.subLayerKey = m_subLayerGUID;
+	Filter.displayData.name = FIREWALL_SERVICE_NAMEW;
+	Filter.flags = m_bPersistent ? FWPM_FILTER_FLAG_PERSISTENT : FWPM_FILTER_FLAG_NONE;
+	Filter.layerKey = FWPM_LAYER_INBOUND_TRANSPORT_V4;
+	Filter.action.type = FWP_ACTION_BLOCK;
+	Filter.weight.type = FWP_EMPTY;
+	Filter.filterCondition = &Condition;
+	Filter.numFilterConditions = 1;
+
+	// Remote IP address should fall inside network.
+	Condition.fieldKey = FWPM_CONDITION_IP_REMOTE_ADDRESS;
+	Condition.matchType = FWP_MATCH_EQUAL;
+	Condition.conditionValue.type = FWP_V4_ADDR_MASK;
+	Condition.conditionValue.v4AddrMask = &AddrMask;
+
+	// Add network to be blocked.
+	AddrMask.mask = VISTA_SUBNET_MASK & ~CIDRHostMask(network.prefix);
+	AddrMask.addr = network.network & AddrMask.mask;
+
+	// Add filter condition to our interface and save the filter id.
+	DWORD dwFwAPiRetCode = FwpmFilterAdd0(m_hEngineHandle,
+		&Filter,
+		NULL,
+		&u64VistaFilterId);
+	if (ERROR_SUCCESS == dwFwAPiRetCode)
+	{
+		filterIds.insert(std::make_pair(network, u64VistaFilterId));
+	}
+	return dwFwAPiRetCode;
+}
+
+/******************************************************************************
+PacketFilter::RemoveFilter - Deletes the filter added for network, if any.
+                             Caller holds m_filterLock.
+*******************************************************************************/
+DWORD PacketFilter::RemoveFilter( const CIDR& network )
+{
+	DWORD dwFwAPiRetCode = ERROR_NOT_FOUND;
+	std::unordered_map<CIDR, UINT64>::iterator elm = filterIds.find(network);
+	if (elm != filterIds.end())
+	{
+		dwFwAPiRetCode = FwpmFilterDeleteById0(m_hEngineHandle, elm->second);
+		filterIds.erase(elm);
+	}
+	return dwFwAPiRetCode;
+}
+
+/******************************************************************************
+PacketFilter::ApplyTransaction - Adds and removes a batch of networks of one
+                                 address family in a single engine
+                                 transaction, so one commit is paid per batch
+                                 instead of one per address.
+*******************************************************************************/
+template <typename Network>
+DWORD PacketFilter::ApplyTransaction( std::unordered_map<Network, UINT64>& ids, DWORD (PacketFilter::*pAddFilter)( const Network& ),
+	DWORD (PacketFilter::*pRemoveFilter)( const Network& ), const Network* pAdd, size_t nAdd, const Network* pRemove, size_t nRemove )
+{
+	DWORD dwFwAPiRetCode = ERROR_BAD_COMMAND;
+	try
+	{
+		std::lock_guard<std::mutex> lock(m_filterLock);
+		dwFwAPiRetCode = FwpmTransactionBegin0(m_hEngineHandle, 0);
+		if (ERROR_SUCCESS != dwFwAPiRetCode)
+		{
+			return dwFwAPiRetCode;
+		}
+
+		// Ids touched by the transaction, restored if it does not commit.
+		std::vector<std::pair<Network, UINT64>> removed;
+		std::vector<Network> added;
+
+		for (size_t i = 0; i < nRemove; i++)
+		{
+			typename std::unordered_map<Network, UINT64>::iterator elm = ids.find(pRemove[i]);
+			if (elm != ids.end())
+			{
+				removed.push_back(*elm);
+				(this->*pRemoveFilter)(pRemove[i]);
+			}
+		}
+		for (size_t i = 0; i < nAdd; i++)
+		{
+			if (ids.find(pAdd[i]) == ids.end() && ERROR_SUCCESS == (this->*pAddFilter)(pAdd[i]))
+			{
+				added.push_back(pAdd[i]);
+			}
+		}
+
+		dwFwAPiRetCode = FwpmTransactionCommit0(m_hEngineHandle);
+		if (ERROR_SUCCESS != dwFwAPiRetCode)
+		{
+			FwpmTransactionAbort0(m_hEngineHandle);
+
+			// Nothing was applied, put the filter ids back as they were.
+			for (size_t i = 0; i < added.size(); i++)
+			{
+				ids.erase(added[i]);
+			}
+			ids.insert(removed.begin(), removed.end());
+		}
+	}
+	catch (...)
+	{
+	}
+	return dwFwAPiRetCode;
+}
+
+/******************************************************************************
+PacketFilter::ApplyBans - Adds and removes a batch of host order networks in
+                          one transaction.
+*******************************************************************************/
+DWORD PacketFilter::ApplyBans( const CIDR* pAdd, size_t nAdd, const CIDR* pRemove, size_t nRemove )
+{
+	return ApplyTransaction(filterIds, &PacketFilter::AddFilter, &PacketFilter::RemoveFilter, pAdd, nAdd, pRemove, nRemove);
+}
+
+/******************************************************************************
+PacketFilter::ApplyBans6 - Same as ApplyBans for IPv6 networks.
+*******************************************************************************/
+DWORD PacketFilter::ApplyBans6( const CIDR6* pAdd, size_t nAdd, const CIDR6* pRemove, size_t nRemove )
+{
+	return ApplyTransaction(filterIds6, &PacketFilter::AddFilter6, &PacketFilter::RemoveFilter6, pAdd, nAdd, pRemove, nRemove);
+}
+
+/******************************************************************************
+PacketFilter::AddFilter6 - Adds a block filter for an IPv6 network on the
+                           IPv6 transport layer and remembers its id.
+                           Caller holds m_filterLock.
+*******************************************************************************/
+DWORD PacketFilter::AddFilter6( const CIDR6& network )
+{
+	FWPM_FILTER0 Filter = { 0 };
+	FWPM_FILTER_CONDITION0 Condition = { 0 };
+	FWP_V6_ADDR_AND_MASK AddrMask = { 0 };
+	UINT64 u64VistaFilterId = 0;
+
+	// Prepare filter condition.
+	Filter.subLayerKey = m_subLayerGUID;
+	Filter.displayData.name = FIREWALL_SERVICE_NAMEW;
+	Filter.flags = m_bPersistent ? FWPM_FILTER_FLAG_PERSISTENT : FWPM_FILTER_FLAG_NONE;
+	Filter.layerKey = FWPM_LAYER_INBOUND_TRANSPORT_V6;
+	Filter.action.type = FWP_ACTION_BLOCK;
+	Filter.weight.type = FWP_EMPTY;
+	Filter.filterCondition = &Condition;
+	Filter.numFilterConditions = 1;
+
+	// Remote IP address should fall inside network.
+	Condition.fieldKey = FWPM_CONDITION_IP_REMOTE_ADDRESS;
+	Condition.matchType = FWP_MATCH_EQUAL;
+	Condition.conditionValue.type = FWP_V6_ADDR_MASK;
+	Condition.conditionValue.v6AddrMask = &AddrMask;
+
+	// Add network to be blocked, the address is in network order.
+	IPv6ToBytes(network.network, AddrMask.addr);
+	AddrMask.prefixLength = network.prefix;
+
+	DWORD dwFwAPiRetCode = FwpmFilterAdd0(m_hEngineHandle,
+		&Filter,
+		NULL,
+		&u64VistaFilterId);
+	if (ERROR_SUCCESS == dwFwAPiRetCode)
+	{
+		filterIds6.insert(std::make_pair(network, u64VistaFilterId));
+	}
+	return dwFwAPiRetCode;
+}
+
+/******************************************************************************
+PacketFilter::RemoveFilter6 - Deletes the filter added for an IPv6 network,
+                              if any. Caller holds m_filterLock.
+*******************************************************************************/
+DWORD PacketFilter::RemoveFilter6( const CIDR6& network )
+{
+	DWORD dwFwAPiRetCode = ERROR_NOT_FOUND;
+	std::unordered_map<CIDR6, UINT64>::iterator elm = filterIds6.find(network);
+	if (elm != filterIds6.end())
+	{
+		dwFwAPiRetCode = FwpmFilterDeleteById0(m_hEngineHandle, elm->second);
+		filterIds6.erase(elm);
+	}
+	return dwFwAPiRetCode;
+}
+
+/******************************************************************************
+PacketFilter::InstallRanges - Adds one range filter per address range in a
+                              single transaction. Meant for large static
+                              lists, the filters stay until StopFirewall.
+*******************************************************************************/
+DWORD PacketFilter::InstallRanges( const CIDRRange* pRanges, size_t nRanges )
+{
+	DWORD dwFwAPiRetCode = ERROR_BAD_COMMAND;
+	try
+	{
+		std::lock_guard<std::mutex> lock(m_filterLock);
+		dwFwAPiRetCode = FwpmTransactionBegin0(m_hEngineHandle, 0);
+		if (ERROR_SUCCESS != dwFwAPiRetCode)
+		{
+			return dwFwAPiRetCode;
+		}
+
+		FWPM_FILTER0 Filter = { 0 };
+		FWPM_FILTER_CONDITION0 Condition = { 0 };
+		FWP_RANGE0 Range = { 0 };
+
+		// Prepare filter condition.
+		Filter.subLayerKey = m_subLayerGUID;
+		Filter.displayData.name = FIREWALL_SERVICE_NAMEW;
+		Filter.flags = m_bPersistent ? FWPM_FILTER_FLAG_PERSISTENT : FWPM_FILTER_FLAG_NONE;
+		Filter.layerKey = FWPM_LAYER_INBOUND_TRANSPORT_V4;
+		Filter.action.type = FWP_ACTION_BLOCK;
+		Filter.weight.type = FWP_EMPTY;
+		Filter.filterCondition = &Condition;
+		Filter.numFilterConditions = 1;
+
+		// Remote IP address should fall inside [valueLow, valueHigh].
+		Condition.fieldKey = FWPM_CONDITION_IP_REMOTE_ADDRESS;
+		Condition.matchType = FWP_MATCH_RANGE;
+		Condition.conditionValue.type = FWP_RANGE_TYPE;
+		Condition.conditionValue.rangeValue = &Range;
+		Range.valueLow.type = FWP_UINT32;
+		Range.valueHigh.type = FWP_UINT32;
+
+		size_t nInstalled = rangeFilterIds.size();
+		for (size_t i = 0; i < nRanges && ERROR_SUCCESS == dwFwAPiRetCode; i++)
+		{
+			UINT64 u64VistaFilterId = 0;
+			Range.valueLow.uint32 = pRanges[i].start;
+			Range.valueHigh.uint32 = pRanges[i].end;
+			dwFwAPiRetCode = FwpmFilterAdd0(m_hEngineHandle,
+				&Filter,
+				NULL,
+				&u64VistaFilterId);
+			rangeFilterIds.push_back(u64VistaFilterId);
+			installedRanges.push_back(pRanges[i]);
+		}
+
+		if (ERROR_SUCCESS == dwFwAPiRetCode)
+		{
+			dwFwAPiRetCode = FwpmTransactionCommit0(m_hEngineHandle);
+		}
+		if (ERROR_SUCCESS != dwFwAPiRetCode)
+		{
+			// All or nothing, the user mode blacklist stays in charge.
+			FwpmTransactionAbort0(m_hEngineHandle);
+			rangeFilterIds.resize(nInstalled);
+			installedRanges.resize(nInstalled);
+		}
+	}
+	catch (...)
+	{
+	}
+	return dwFwAPiRetCode;
+}
+
+size_t PacketFilter::RangeFilterCount()
+{
+	std::lock_guard<std::mutex> lock(m_filterLock);
+	return rangeFilterIds.size();
+}
+
+bool PacketFilter::RangesInstalled( const CIDRRange* pRanges, size_t nRanges )
+{
+	std::lock_guard<std::mutex> lock(m_filterLock);
+	if (installedRanges.size() != nRanges)
+	{
+		return false;
+	}
+	auto less = [](const CIDRRange& a, const CIDRRange& b) { return a.start < b.start || (a.start == b.start && a.end < b.end); };
+	std::vector<CIDRRange> installed(installedRanges), wanted(pRanges, pRanges + nRanges);
+	std::sort(installed.begin(), installed.end(), less);
+	std::sort(wanted.begin(), wanted.end(), less);
+	for (size_t i = 0; i < nRanges; i++)
+	{
+		if (installed[i].start != wanted[i].start || installed[i].end != wanted[i].end)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+/******************************************************************************
+PacketFilter::RemoveRanges - Deletes every installed range filter.
+*******************************************************************************/
+DWORD PacketFilter::RemoveRanges()
+{
+	DWORD dwFwAPiRetCode = ERROR_BAD_COMMAND;
+	try
+	{
+		std::lock_guard<std::mutex> lock(m_filterLock);
+		dwFwAPiRetCode = FwpmTransactionBegin0(m_hEngineHandle, 0);
+		if (ERROR_SUCCESS != dwFwAPiRetCode)
+		{
+			return dwFwAPiRetCode;
+		}
+		for (auto it = rangeFilterIds.begin(); it != rangeFilterIds.end(); it++)
+		{
+			FwpmFilterDeleteById0(m_hEngineHandle, *it);
+		}
+		dwFwAPiRetCode = FwpmTransactionCommit0(m_hEngineHandle);
+		if (ERROR_SUCCESS == dwFwAPiRetCode)
+		{
+			rangeFilterIds.clear();
+			installedRanges.clear();
+		}
+		else
+		{
+			FwpmTransactionAbort0(m_hEngineHandle);
+		}
+	}
+	catch (...)
+	{
+	}
+	return dwFwAPiRetCode;
+}
+
+/******************************************************************************
+PacketFilter::RestorePersistentFilters - Rebuilds filterIds, filterIds6 and
+                                         rangeFilterIds from the filters in our
+                                         sublayer.
+                                         Prefix filters cannot be split without
+                                         their member addresses, so they are
+                                         deleted and rebuilt from new bans.
+                                         IPv6 network filters are kept like the
+                                         single address filters.
+*******************************************************************************/
+DWORD PacketFilter::RestorePersistentFilters()
+{
+	DWORD dwFwAPiRetCode = ERROR_BAD_COMMAND;
+	try
+	{
+		std::lock_guard<std::mutex> lock(m_filterLock);
+		std::vector<UINT64> prefixFilterIds;
+		const GUID* layers[] = { &FWPM_LAYER_INBOUND_TRANSPORT_V4, &FWPM_LAYER_INBOUND_TRANSPORT_V6 };
+		for (size_t nLayer = 0; nLayer < sizeof(layers) / sizeof(layers[0]); nLayer++)
+		{
+			HANDLE hEnum = NULL;
+			FWPM_FILTER_ENUM_TEMPLATE0 Template = { 0 };
+			Template.layerKey = *layers[nLayer];
+			Template.enumType = FWP_FILTER_ENUM_OVERLAPPING;
+			Template.actionMask = 0xFFFFFFFF;
+
+			dwFwAPiRetCode = FwpmFilterCreateEnumHandle0(m_hEngineHandle, &Template, &hEnum);
+			if (ERROR_SUCCESS != dwFwAPiRetCode)
+			{
+				return dwFwAPiRetCode;
+			}
+
+			for (;;)
+			{
+				FWPM_FILTER0** ppEntries = NULL;
+				UINT32 nEntries = 0;
+				dwFwAPiRetCode = FwpmFilterEnum0(m_hEngineHandle, hEnum, 1024, &ppEntries, &nEntries);
+				if (ERROR_SUCCESS != dwFwAPiRetCode)
+				{
+					break;
+				}
+				for (UINT32 i = 0; i < nEntries; i++)
+				{
+					const FWPM_FILTER0* pFilter = ppEntries[i];
+					if (!IsEqualGUID(pFilter->subLayerKey, m_subLayerGUID) || 1 != pFilter->numFilterConditions ||
+						!IsEqualGUID(pFilter->filterCondition[0].fieldKey, FWPM_CONDITION_IP_REMOTE_ADDRESS))
+					{
+						continue;
+					}
+					const FWP_CONDITION_VALUE0& Value = pFilter->filterCondition[0].conditionValue;
+					if (FWP_V6_ADDR_MASK == Value.type)
+					{
+						CIDR6 network = { IPv6FromBytes(Value.v6AddrMask->addr), Value.v6AddrMask->prefixLength };
+						filterIds6.insert(std::make_pair(network, pFilter->filterId));
+					}
+					else if (FWP_RANGE_TYPE == Value.type)
+					{
+						// A bound of another type never equals a list range, the filters are replaced
+						CIDRRange range = { 1, 0 };
+						if (FWP_UINT32 == Value.rangeValue->valueLow.type && FWP_UINT32 == Value.rangeValue->valueHigh.type)
+						{
+							range.start = Value.rangeValue->valueLow.uint32;
+							range.end = Value.rangeValue->valueHigh.uint32;
+						}
+						rangeFilterIds.push_back(pFilter->filterId);
+						installedRanges.push_back(range);
+					}
+					else if (FWP_V4_ADDR_MASK == Value.type && VISTA_SUBNET_MASK == Value.v4AddrMask->mask)
+					{
+						CIDR network = { Value.v4AddrMask->addr, 32 };
+						filterIds.insert(std::make_pair(network, pFilter->filterId));
+					}
+					else if (FWP_V4_ADDR_MASK == Value.type)
+					{
+						prefixFilterIds.push_back(pFilter->filterId);
+					}
+				}
+				FwpmFreeMemory0((void**)&ppEntries);
+				if (nEntries < 1024)
+				{
+					break;
+				}
+			}
+			FwpmFilterDestroyEnumHandle0(m_hEngineHandle, hEnum);
+		}
+
+		if (!prefixFilterIds.empty() && ERROR_SUCCESS == FwpmTransactionBegin0(m_hEngineHandle, 0))
+		{
+			for (auto it = prefixFilterIds.begin(); it != prefixFilterIds.end(); it++)
+			{
+				FwpmFilterDeleteById0(m_hEngineHandle, *it);
+			}
+			FwpmTransactionCommit0(m_hEngineHandle);
+		}
+	}
+	catch (...)
+	{
+	}
+	return dwFwAPiRetCode;
+}
+
+void PacketFilter::RestoredAddresses( std::vector<UINT32>& addrs )
+{
+	std::lock_guard<std::mutex> lock(m_filterLock);
+	for (auto it = filterIds.begin(); it != filterIds.end(); it++)
+	{
+		if (32 == it->first.prefix)
+		{
+			addrs.push_back(it->first.network);
+		}
+	}
+}
+
+void PacketFilter::RestoredNetworks6( std::vector<CIDR6>& networks )
+{
+	std::lock_guard<std::mutex> lock(m_filterLock);
+	for (auto it = filterIds6.begin(); it != filterIds6.end(); it++)
+	{
+		networks.push_back(it->first);
+	}
+}
+
 /******************************************************************************
 PacketFilter::AddToBlockList - This public method allows caller to add
                                IP addresses which need to be blocked.
@@ -194,40 +669,7 @@ DWORD PacketFilter::Block( char* szIpAddrToBlock )
                                stIPFilter.bIpAddrToBlock,
                                BYTE_IPADDR_ARRLEN,
                                stIPFilter.uHexAddrToBlock );
-			UINT32 ipVal = *((UINT32*)&stIPFilter.bIpAddrToBlock);
-
-			if ((NULL != stIPFilter.bIpAddrToBlock) && (0 != stIPFilter.uHexAddrToBlock))
-			{
-				FWPM_FILTER0 Filter = { 0 };
-				FWPM_FILTER_CONDITION0 Condition = { 0 };
-				FWP_V4_ADDR_AND_MASK AddrMask = { 0 };
-
-				// Prepare filter condition.
-				Filter.subLayerKey = m_subLayerGUID;
-				Filter.displayData.name = FIREWALL_SERVICE_NAMEW;
-				Filter.layerKey = FWPM_LAYER_INBOUND_TRANSPORT_V4;
-				Filter.action.type = FWP_ACTION_BLOCK;
-				Filter.weight.type = FWP_EMPTY;
-				Filter.filterCondition = &Condition;
-				Filter.numFilterConditions = 1;
-
-				// Remote IP address should match itFilters->uHexAddrToBlock.
-				Condition.fieldKey = FWPM_CONDITION_IP_REMOTE_ADDRESS;
-				Condition.matchType = FWP_MATCH_EQUAL;
-				Condition.conditionValue.type = FWP_V4_ADDR_MASK;
-				Condition.conditionValue.v4AddrMask = &AddrMask;
-
-				// Add IP address to be blocked.
-				AddrMask.addr = stIPFilter.uHexAddrToBlock;
-				AddrMask.mask = VISTA_SUBNET_MASK;
-
-				// Add filter condition to our interface. Save filter id in itFilters->u64VistaFilterId.
-				dwFwAPiRetCode = FwpmFilterAdd0(m_hEngineHandle,
-					&Filter,
-					NULL,
-					&(stIPFilter.u64VistaFilterId));
-				filterIds.insert(std::make_pair(ipVal, stIPFilter.u64VistaFilterId));
-			}
+			dwFwAPiRetCode = Block(stIPFilter.uHexAddrToBlock);
         }
     }
     catch(...)
@@ -236,6 +678,45 @@ DWORD PacketFilter::Block( char* szIpAddrToBlock )
 	return dwFwAPiRetCode;
 }
 
+/******************************************************************************
+PacketFilter::Block - Blocks a host order address without any string handling.
+*******************************************************************************/
+DWORD PacketFilter::Block( UINT32 uHexAddr )
+{
+	DWORD dwFwAPiRetCode = ERROR_BAD_COMMAND;
+	try
+	{
+		if (0 != uHexAddr)
+		{
+			dwFwAPiRetCode = Block(CIDR{ uHexAddr, 32 });
+		}
+	}
+	catch (...)
+	{
+	}
+	return dwFwAPiRetCode;
+}
+
+/******************************************************************************
+PacketFilter::Block - Blocks every address of a host order network.
+*******************************************************************************/
+DWORD PacketFilter::Block( const CIDR& network )
+{
+	DWORD dwFwAPiRetCode = ERROR_BAD_COMMAND;
+	try
+	{
+		std::lock_guard<std::mutex> lock(m_filterLock);
+		dwFwAPiRetCode = ERROR_ALREADY_EXISTS;
+		if (filterIds.find(network) == filterIds.end())
+		{
+			dwFwAPiRetCode = AddFilter(network);
+		}
+	}
+	catch (...)
+	{
+	}
+	return dwFwAPiRetCode;
+}
 
 DWORD PacketFilter::Unblock(char* szIpAddrToBlock)
 {
@@ -252,16 +733,26 @@ DWORD PacketFilter::Unblock(char* szIpAddrToBlock)
 				stIPFilter.bIpAddrToBlock,
 				BYTE_IPADDR_ARRLEN,
 				stIPFilter.uHexAddrToBlock);
-			UINT32 ipVal = *((UINT32*)&stIPFilter.bIpAddrToBlock);
+			dwFwAPiRetCode = Unblock(stIPFilter.uHexAddrToBlock);
+		}
+	}
+	catch (...)
+	{
+	}
+	return dwFwAPiRetCode;
+}
 
-			std::unordered_map<UINT32, UINT64>::iterator elm = filterIds.find(ipVal);
-			if ((NULL != stIPFilter.bIpAddrToBlock) && (0 != stIPFilter.uHexAddrToBlock) && elm != filterIds.end())
-			{
-				// Delete all previously added filters.
-				dwFwAPiRetCode = FwpmFilterDeleteById0(m_hEngineHandle,
-					elm->second);
-				filterIds.erase(elm);
-			}
+/******************************************************************************
+PacketFilter::Unblock - Removes the filter of a host order address.
+*******************************************************************************/
+DWORD PacketFilter::Unblock( UINT32 uHexAddr )
+{
+	DWORD dwFwAPiRetCode = ERROR_BAD_COMMAND;
+	try
+	{
+		if (0 != uHexAddr)
+		{
+			dwFwAPiRetCode = Unblock(CIDR{ uHexAddr, 32 });
 		}
 	}
 	catch (...)
@@ -270,15 +761,72 @@ DWORD PacketFilter::Unblock(char* szIpAddrToBlock)
 	return dwFwAPiRetCode;
 }
 
+/******************************************************************************
+PacketFilter::Unblock - Removes the filter of a host order network.
+*******************************************************************************/
+DWORD PacketFilter::Unblock( const CIDR& network )
+{
+	DWORD dwFwAPiRetCode = ERROR_BAD_COMMAND;
+	try
+	{
+		std::lock_guard<std::mutex> lock(m_filterLock);
+		dwFwAPiRetCode = RemoveFilter(network);
+	}
+	catch (...)
+	{
+	}
+	return dwFwAPiRetCode;
+}
+
+
+/******************************************************************************
+PacketFilter::Block6 - Blocks every address of an IPv6 network.
+*******************************************************************************/
+DWORD PacketFilter::Block6( const CIDR6& network )
+{
+	DWORD dwFwAPiRetCode = ERROR_BAD_COMMAND;
+	try
+	{
+		std::lock_guard<std::mutex> lock(m_filterLock);
+		dwFwAPiRetCode = ERROR_ALREADY_EXISTS;
+		if (filterIds6.find(network) == filterIds6.end())
+		{
+			dwFwAPiRetCode = AddFilter6(network);
+		}
+	}
+	catch (...)
+	{
+	}
+	return dwFwAPiRetCode;
+}
+
+/******************************************************************************
+PacketFilter::Unblock6 - Removes the filter of an IPv6 network.
+*******************************************************************************/
+DWORD PacketFilter::Unblock6( const CIDR6& network )
+{
+	DWORD dwFwAPiRetCode = ERROR_BAD_COMMAND;
+	try
+	{
+		std::lock_guard<std::mutex> lock(m_filterLock);
+		dwFwAPiRetCode = RemoveFilter6(network);
+	}
+	catch (...)
+	{
+	}
+	return dwFwAPiRetCode;
+}
 
 /******************************************************************************
 PacketFilter::StartFirewall - This public method starts firewall.
 *******************************************************************************/
-BOOL PacketFilter::StartFirewall()
+BOOL PacketFilter::StartFirewall( bool bPersistent )
 {
     BOOL bStarted = FALSE;
     try
     {
+        m_bPersistent = bPersistent;
+
         // Create packet filter interface.
         if( ERROR_SUCCESS == CreateDeleteInterface( true ) )
         {
@@ -287,6 +835,10 @@ BOOL PacketFilter::StartFirewall()
             {
                 // Add filters.
                 //AddRemoveFilter( true );
+                if( m_bPersistent )
+                {
+                    RestorePersistentFilters();
+                }
 
                 bStarted = TRUE;
             }
@@ -306,20 +858,24 @@ BOOL PacketFilter::StopFirewall()
     BOOL bStopped = FALSE;
     try
     {
-		for (auto it = filterIds.begin(); it != filterIds.end(); it++)
+		std::lock_guard<std::mutex> lock(m_filterLock);
+		if( NULL == m_hEngineHandle )
 		{
-			FwpmFilterDeleteById0(m_hEngineHandle, it->second);
+			return bStopped;
 		}
 
-        // Unbind from packet filter interface.
-        if( ERROR_SUCCESS == BindUnbindInterface( false ) )
-        {
-            // Delete packet filter interface.
-            if( ERROR_SUCCESS == CreateDeleteInterface( false ) )
-            {
-                bStopped = TRUE;
-            }
-        }
+		// Closing the engine handle ends the dynamic session along with all of its
+		// filters, persistent filters stay for the next start. Either way no
+		// filter is deleted one by one.
+		filterIds.clear();
+		filterIds6.clear();
+		rangeFilterIds.clear();
+		installedRanges.clear();
+		::ZeroMemory( &m_subLayerGUID, sizeof( GUID ) );
+		if( ERROR_SUCCESS == CreateDeleteInterface( false ) )
+		{
+			bStopped = TRUE;
+		}
     }
     catch(...)
     {
@@ -20,9 +20,14 @@
 #include <conio.h>
 #include <strsafe.h>
 #include <fwpmu.h>
+#include <algorithm>
 #include <list>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 #include <string>
+#include "cidr.h"
+#include "cidr6.h"
 
 // Firewall sub-layer names.
 #define FIREWALL_SUBLAYER_NAME  "GamingFirewall"
@@ -57,20 +62,50 @@ private:
     // Firewall sublayer GUID.
     GUID m_subLayerGUID;
 
+    // Filters outlive the engine handle and are picked up again on the next start.
+    bool m_bPersistent;
+
     // List of filters.
     IPFILTERINFOLIST m_lstFilters;
 
-	std::unordered_map<UINT32, UINT64> filterIds;
+	// Filter ids by host order network, single addresses use prefix 32.
+	std::unordered_map<CIDR, UINT64> filterIds;
+
+	// Filter ids of the IPv6 networks.
+	std::unordered_map<CIDR6, UINT64> filterIds6;
+
+	// Filter ids of the pre-installed address ranges, and the range of each.
+	std::vector<UINT64> rangeFilterIds;
+	std::vector<CIDRRange> installedRanges;
+
+	// Serializes filter changes, Block/Unblock are called from every capture thread
+	std::mutex m_filterLock;
 
     // Method to get byte array format and hex format IP address from string format.
     bool ParseIPAddrString( char* szIpAddr, UINT nStrLen, BYTE* pbHostOrdr, UINT nByteLen, ULONG& uHexAddr );
 
+    // Methods to add/delete the filter of a network, caller holds m_filterLock.
+    DWORD AddFilter( const CIDR& network );
+    DWORD RemoveFilter( const CIDR& network );
+
+    // Method to add/delete the filter of an IPv6 network, caller holds m_filterLock.
+    DWORD AddFilter6( const CIDR6& network );
+    DWORD RemoveFilter6( const CIDR6& network );
+
+    // Method to add/delete a batch of filters of one address family in one transaction.
+    template <typename Network>
+    DWORD ApplyTransaction( std::unordered_map<Network, UINT64>& ids, DWORD (PacketFilter::*pAddFilter)( const Network& ),
+        DWORD (PacketFilter::*pRemoveFilter)( const Network& ), const Network* pAdd, size_t nAdd, const Network* pRemove, size_t nRemove );
+
     // Method to create/delete packet filter interface.
     DWORD CreateDeleteInterface( bool bCreate );
 
     // Method to bind/unbind to/from packet filter interface.
     DWORD BindUnbindInterface( bool bBind );
 
+    // Method to load the filters left in the persistent sublayer by a previous run.
+    DWORD RestorePersistentFilters();
+
 public:
 
     // Constructor.
@@ -81,12 +116,44 @@ public:
 
     // Method to block IP instantly
     DWORD Block(char* szIpAddrToBlock);
+	DWORD Block(UINT32 uHexAddr);
+	DWORD Block(const CIDR& network);
 
 	// Method to unblock IP instantly
 	DWORD Unblock(char* szIpAddr);
+	DWORD Unblock(UINT32 uHexAddr);
+	DWORD Unblock(const CIDR& network);
+
+	// Method to block and unblock an IPv6 network instantly
+	DWORD Block6(const CIDR6& network);
+	DWORD Unblock6(const CIDR6& network);
+
+	// Method to block and unblock host order networks in one transaction
+	DWORD ApplyBans(const CIDR* pAdd, size_t nAdd, const CIDR* pRemove, size_t nRemove);
+
+	// Method to block and unblock IPv6 networks in one transaction
+	DWORD ApplyBans6(const CIDR6* pAdd, size_t nAdd, const CIDR6* pRemove, size_t nRemove);
+
+	// Method to block a list of host order address ranges in one transaction
+	DWORD InstallRanges(const CIDRRange* pRanges, size_t nRanges);
+
+	size_t RangeFilterCount();
+
+	// Method to check whether exactly these ranges are installed, in any order
+	bool RangesInstalled(const CIDRRange* pRanges, size_t nRanges);
+
+	// Method to delete the address range filters in one transaction
+	DWORD RemoveRanges();
+
+	// Method to list the single address filters restored from a previous run
+	void RestoredAddresses(std::vector<UINT32>& addrs);
+
+	// Method to list the IPv6 network filters restored from a previous run
+	void RestoredNetworks6(std::vector<CIDR6>& networks);
 
-    // Method to start packet filter.
-    BOOL StartFirewall();
+    // Method to start packet filter. The default dynamic session removes every
+    // filter when the engine handle closes, persistent filters survive restarts.
+    BOOL StartFirewall( bool bPersistent = false );
 
     // Method to stop packet filter.
     BOOL StopFirewall();
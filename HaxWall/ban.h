@@ -1,93 +1,145 @@
 #pragma once
 // UDP Gaming Firewall
 
+#include <atomic>
 #include <cstdint>
 #include <ctime>
-#include <unordered_map>
-#include <unordered_set>
+#include <mutex>
+#include <vector>
 #include <iostream>
 #include <fstream>
 #include <iomanip>
+#include "batch_classifier.h"
+#include "cidr6.h"
 #include "cidr_matcher.h"
+#include "clock.h"
+#include "ban_worker.h"
+#include "flat_table.h"
+#include "journal.h"
+#include "logger.h"
+#include "snapshot.h"
+#include "stats.h"
+#include "timer_wheel.h"
+#include "verdict_cache.h"
 
-#define MAX_PORTS 3 // maximum number of source ports per client
+#define MAX_PORTS 3 // maximum number of source ports per client, policy profiles may only lower it
+#define PORT_SLOTS (MAX_PORTS + 1) // one more port than allowed is tracked to detect multiport clients
 #define TIMEOUT 60 // seconds
-#define PURGE_INTERVAL 30 // seconds
+#define PURGE_INTERVAL 1 // seconds between timer wheel advances
+#define TIMER_SLOTS 256 // buckets per timer wheel, each covering one purge interval
 #define MAX_PACKETS 80 // per packet frame span (defined below)
-#define MAX_PACKET_FRAME 1 // seconds
+#define MAX_PACKET_FRAME 1 // seconds, fractions are allowed
+#define RATE_DETECTOR TokenBucketDetector // flood detection strategy, see rate_detector.h
 #define BAN_DURATION_MULTIPORT 60 // seconds
 #define BAN_DURATION_FLOOD 60 // seconds
 #define BAN_DURATION_BLACKLIST 3600 // seconds
+#define SHARD_BITS 6 // per-address state is split into 2^SHARD_BITS independently locked shards
+#define IPV6_PREFIX 64 // IPv6 sources are tracked and banned per network of this length, 8 to 64
+#define SHARD_BITS_IPV6 4 // shards of the IPv6 networks, far fewer than IPv4 sources
+#define MAX_CLIENTS 0x40000 // tracked sources per address family, beyond it the least recently seen of a sample is evicted
+#define EVICTION_SAMPLES 8 // tracked sources compared per eviction
+#define MAX_BANS 0x40000 // bans per address family, blacklisted sources beyond it are left to the range filters
+#define FLOOD_NEW_SOURCES 5000 // new sources per second that switch to flood mode
+#define FLOOD_PACKETS 500000 // received packets per second that switch to flood mode
+#define FLOOD_COOLDOWN 30 // seconds below both thresholds before flood mode ends
+#define FLOOD_PENDING 0x10000 // untracked IPv4 sources remembered in flood mode for verification queries
 
-// On Windows, the purge interval defines the minimum ban durations because packets from
+#include "rate_detector.h" // uses the limits above
+#include "policy.h" // the limits above are DefaultPolicy
+
+// On Windows, the purge interval defines the granularity of ban durations because packets from
 // banned IP addresses are no longer received
 
-static time_t now;
+typedef RATE_DETECTOR RateDetector;
+
+struct PortSlot
+{
+	uint32_t last_seen; // ticks, ports are pruned long before this wraps
+	uint16_t port;
+};
 
+// Fixed-size record stored inline in the flat per-shard table
 struct AddressStatistics
 {
 public:
-	time_t times[MAX_PACKETS];
-	size_t packet_count;
-	size_t last_time;
-	std::unordered_map<uint16_t, time_t> ports;
+	tick_t last_seen;
+	tick_t timer; // deadline of the pending timeout timer, stale timers do not match
+	RateDetector rate;
+	uint32_t port_count;
+	uint16_t dport; // destination port of the last reset, selects the policy profile on a warm start
+	PortSlot ports[PORT_SLOTS];
 
-	AddressStatistics(uint16_t port)
+	AddressStatistics()
 	{
-		Reset(port);
 	}
 
-	void RemoveOldPorts()
+	void RemoveOldPorts(tick_t now)
 	{
-		for (auto it = ports.begin();  it != ports.end();)
+		uint32_t kept = 0;
+		for (uint32_t i = 0; i < port_count; i++)
 		{
-			double elapsed = difftime(now, it->second);
-			if (elapsed > TIMEOUT)
+			uint32_t elapsed = (uint32_t)now - ports[i].last_seen;
+			if (elapsed <= SECONDS_TO_TICKS(TIMEOUT))
 			{
-				it = ports.erase(it);
-				continue;
+				ports[kept++] = ports[i];
 			}
-			it++;
 		}
+		port_count = kept;
 	}
 
-	void Reset(uint16_t port)
+	// Assumes RemoveOldPorts() left at most MAX_PORTS ports, so a free slot always exists
+	void TouchPort(uint16_t port, tick_t now)
 	{
-		packet_count = 1;
-		ports.clear();
-		last_time = 0;
-		times[last_time] = now;
-		ports.insert(std::make_pair(port, now));
+		for (uint32_t i = 0; i < port_count; i++)
+		{
+			if (ports[i].port == port)
+			{
+				ports[i].last_seen = (uint32_t)now;
+				return;
+			}
+		}
+		if (port_count < PORT_SLOTS)
+		{
+			ports[port_count].port = port;
+			ports[port_count].last_seen = (uint32_t)now;
+			port_count++;
+		}
 	}
 
-	bool TimedOut(double timeout = TIMEOUT)
+	template <typename Policy>
+	void Reset(uint16_t port, uint16_t dport, tick_t now, const Policy &policy)
 	{
-		double elapsed = difftime(now, times[last_time]);
-		return elapsed > timeout;
+		this->dport = dport;
+		last_seen = now;
+		rate.Reset(now, policy);
+		port_count = 0;
+		TouchPort(port, now);
 	}
 
-	void CountPacket()
+	bool TimedOut(tick_t now, tick_t timeout = SECONDS_TO_TICKS(TIMEOUT)) const
 	{
-		packet_count++;
-		if (++last_time >= MAX_PACKETS)
-		{
-			last_time = 0;
-		}
-		times[last_time] = now;
+		return now - last_seen > timeout;
 	}
 
-	bool HitLimit()
+	// Returns true when the client exceeded the packet rate limit
+	template <typename Policy>
+	bool CountPacket(tick_t now, const Policy &policy)
 	{
-		size_t first_time = last_time + 1;
-		if (first_time >= MAX_PACKETS)
-		{
-			first_time = 0;
-		}
-		double diff = difftime(times[last_time], times[first_time]);
-		return packet_count > MAX_PACKETS && diff < MAX_PACKET_FRAME;
+		last_seen = now;
+		return rate.Count(now, policy);
 	}
 };
 
+// Outcome of one packet for the log and the journal
+struct FirewallEvent
+{
+	const char *msg;
+	JournalEvent type;
+	BanReason reason;
+};
+
+typedef void(*EventFunction)(JournalEvent event, BanReason reason, uint32_t addr, uint16_t port);
+
 enum class BanStatus {
 	Unbanned,
 	Banned,
@@ -97,35 +149,177 @@ enum class BanStatus {
 
 struct BanInfo
 {
-	time_t expiry;
+	tick_t expiry;
+	BanReason reason;
 
 public:
-	BanInfo(time_t duration)
+	BanInfo()
+	{
+	}
+
+	BanInfo(tick_t now, tick_t duration, BanReason why)
 	{
 		expiry = now + duration;
+		reason = why;
+	}
+
+	bool TimedOut(tick_t now) const
+	{
+		return now >= expiry;
+	}
+};
+
+typedef void(*FloodFunction)(bool active, uint64_t new_sources, uint64_t packets); // rates per second
+
+// Source seen in flood mode without being tracked, its next packet or a verification query admits it
+template <typename Key>
+struct PendingSource
+{
+	Key addr;
+	uint32_t seen; // ticks
+	uint16_t port;
+	uint16_t dport; // selects the policy profile once admitted
+};
+
+// Per-address state of all sources hashing to the same shard, keyed by the IPv4 address
+// or by the upper half of the IPv6 network
+template <typename Key>
+struct alignas(64) FirewallShard
+{
+	static const size_t CLIENT_LIMIT = MAX_CLIENTS >> (sizeof(Key) == sizeof(uint32_t) ? SHARD_BITS : SHARD_BITS_IPV6);
+	static const size_t BAN_LIMIT = MAX_BANS >> (sizeof(Key) == sizeof(uint32_t) ? SHARD_BITS : SHARD_BITS_IPV6);
+
+	std::mutex lock;
+	FlatTable<Key, AddressStatistics> table;
+	FlatTable<Key, BanInfo> bans;
+	FlatTable<Key, bool> whitelist;
+	TimerWheel<Key> client_timers;
+	TimerWheel<Key> ban_timers;
+	std::vector<PendingSource<Key>> pending; // direct mapped
+
+	FirewallShard() : table(0x10000 >> SHARD_BITS), bans(0x10000 >> SHARD_BITS), whitelist(0x10000 >> SHARD_BITS),
+		client_timers(TIMER_SLOTS, SECONDS_TO_TICKS(PURGE_INTERVAL), 0), ban_timers(TIMER_SLOTS, SECONDS_TO_TICKS(PURGE_INTERVAL), 0),
+		pending(FLOOD_PENDING >> (sizeof(Key) == sizeof(uint32_t) ? SHARD_BITS : SHARD_BITS_IPV6), PendingSource<Key>{ 0, 0, 0, 0 })
+	{
+	}
+
+	template <typename Policy = DefaultPolicy>
+	void Track(Key addr, uint16_t port, uint16_t dport, tick_t now, const Policy &policy = Policy())
+	{
+		// Spoofed sources are seen once, they lose against clients that keep sending
+		if (table.Size() >= CLIENT_LIMIT && table.Find(addr) == NULL &&
+			table.EvictSample(FlatHash(addr), EVICTION_SAMPLES, [](const AddressStatistics &entry) { return entry.last_seen; }))
+		{
+			GlobalStatistics().Add(Stat::Evictions);
+		}
+		AddressStatistics *entry = table.Insert(addr);
+		entry->Reset(port, dport, now, policy);
+		entry->timer = now + SECONDS_TO_TICKS(TIMEOUT) + 1;
+		client_timers.Schedule(addr, entry->timer);
+	}
+
+	void Ban(Key addr, tick_t now, tick_t duration, BanReason reason)
+	{
+		BanInfo *ban = bans.Insert(addr, BanInfo(now, duration, reason));
+		ban_timers.Schedule(addr, ban->expiry);
+	}
+
+	// Overwrites whichever source was remembered in the same slot
+	void Remember(Key addr, uint16_t port, uint16_t dport, tick_t now)
+	{
+		pending[FlatHash(addr) & (pending.size() - 1)] = PendingSource<Key>{ addr, (uint32_t)now, port, dport };
+	}
+
+	// Forgets a source remembered within the timeout and returns true, false if it is not remembered
+	bool Forget(Key addr, tick_t now)
+	{
+		PendingSource<Key> &source = pending[FlatHash(addr) & (pending.size() - 1)];
+		if (source.addr != addr || (uint32_t)now - source.seen > SECONDS_TO_TICKS(TIMEOUT))
+		{
+			return false;
+		}
+		source.addr = 0;
+		return true;
 	}
 
-	bool TimedOut()
+	// Tracks a remembered source that sent within the timeout, with the limits that
+	// profile_function(dport) returns for the port it sent to. A blacklisted one stays
+	// remembered, its next packet bans it.
+	template <typename VerdictFunction, typename ProfileFunction>
+	bool Admit(Key addr, tick_t now, VerdictFunction verdict_function, ProfileFunction profile_function)
 	{
-		double elapsed = difftime(now, expiry);
-		return elapsed >= 0;
+		PendingSource<Key> &source = pending[FlatHash(addr) & (pending.size() - 1)];
+		if (source.addr != addr || (uint32_t)now - source.seen > SECONDS_TO_TICKS(TIMEOUT) || bans.Find(addr) != NULL ||
+			(verdict_function() & VerdictBlacklisted))
+		{
+			return false;
+		}
+		const PolicyProfile *profile = profile_function(source.dport);
+		if (profile == NULL)
+		{
+			Track(addr, source.port, source.dport, now);
+		}
+		else
+		{
+			Track(addr, source.port, source.dport, now, *profile);
+		}
+		source.addr = 0;
+		return true;
 	}
 };
 
+static_assert(IPV6_PREFIX >= 8 && IPV6_PREFIX <= 64, "IPv6 networks are keyed by their upper half");
+
+typedef void(*NetworkFunction6)(const CIDR6 &network);
+
 class AttackFirewall
 {
 private:
-	std::unordered_map<uint32_t, AddressStatistics> table;
-	std::unordered_map<uint32_t, BanInfo> bans;
-	std::unordered_set<uint32_t> whitelist;
-	time_t last_purge;
+	FirewallShard<uint32_t> shards[1 << SHARD_BITS];
+	FirewallShard<uint64_t> shards6[1 << SHARD_BITS_IPV6];
+	std::atomic<tick_t> now;
+	std::atomic<tick_t> last_purge;
 	void (*ban_function)(uint32_t);
 	void(*unban_function)(uint32_t);
-	CIDRMatcher *blacklist;
-	CIDRMatcher *exceptions;
-	std::ofstream out;
+	BanWorker worker;
+	EventFunction event_function;
+	std::atomic<const CIDRMatcher*> blacklist;
+	std::atomic<const CIDRMatcher*> exceptions;
+	NetworkFunction6 ban6_function;
+	NetworkFunction6 unban6_function;
+	const CIDR6Matcher *blacklist6;
+	const CIDR6Matcher *exceptions6;
+	BatchClassifier classifier;
+	VerdictCache verdicts;
+	std::atomic<const PolicyTable*> policy_table;
+	std::atomic<bool> flood;
+	FloodFunction flood_function;
+	// Flood detection state, only used by the thread running the purge
+	uint64_t flood_sources;
+	uint64_t flood_packets;
+	tick_t flood_sampled;
+	tick_t flood_exceeded; // last sample above a threshold
+	EventLogger logger;
 
-	bool IsSpecialAddress(uint32_t addr)
+	static size_t ShardIndex(uint32_t addr)
+	{
+		return (uint32_t)(addr * 2654435761u) >> (32 - SHARD_BITS); // Fibonacci hashing spreads adjacent addresses
+	}
+
+	static size_t ShardIndex6(uint64_t network)
+	{
+		return (size_t)((network * 0x9E3779B97F4A7C15ULL) >> (64 - SHARD_BITS_IPV6));
+	}
+
+public:
+	// Network an IPv6 source is tracked and banned by, from the upper half of its address
+	static CIDR6 Network6(uint64_t network)
+	{
+		return CIDR6{ IPv6Address{ network, 0 }, IPV6_PREFIX };
+	}
+
+	// Reserved, private and multicast addresses are never tracked
+	static bool IsSpecialAddress(uint32_t addr)
 	{
 		uint8_t b1, b2, b3, b4;
 		b1 = (uint8_t)(addr >> 24);
@@ -184,198 +378,908 @@ private:
 		return false;
 	}
 
-public:
-	AttackFirewall(void(*ban)(uint32_t) = NULL, void(*unban)(uint32_t) = NULL) : out("firewall.log", std::ios::out)
+	// Reserved, link-local, unique local, multicast and documentation addresses are never
+	// tracked. The reserved ::/8 covers IPv4-mapped addresses, so no network key is zero.
+	static bool IsSpecialAddress6(const IPv6Address &addr)
 	{
-		if (out.is_open())
-		{
-			std::cout << "Logging to firewall.log." << std::endl;
-		}
-		blacklist = NULL;
-		exceptions = NULL;
-		table.reserve(0xFFFF);
-		bans.reserve(0xFFFF);
-		whitelist.reserve(0xFFFF);
-		last_purge = now;
-		ban_function = ban;
-		unban_function = unban;
+		uint8_t b1 = (uint8_t)(addr.high >> 56);
+		uint16_t w1 = (uint16_t)(addr.high >> 48);
+		return b1 == 0x00 // ::/8
+			|| b1 == 0xFF // ff00::/8
+			|| (b1 & 0xFE) == 0xFC // fc00::/7
+			|| (w1 & 0xFFC0) == 0xFE80 // fe80::/10
+			|| (w1 & 0xFFC0) == 0xFEC0 // fec0::/10
+			|| (addr.high >> 32) == 0x20010DB8 // 2001:db8::/32
+			|| addr.high == 0x0100000000000000ULL; // 100::/64
 	}
 
-	void AddWhitelist(uint32_t addr)
+	// Upper half of the network an IPv6 source is tracked by
+	static uint64_t NetworkKey6(const IPv6Address &addr)
 	{
-		whitelist.insert(addr);
+		return addr.high & ~CIDR6HostMask(IPV6_PREFIX);
 	}
 
-	void SetBlacklist(CIDRMatcher *pBlacklist = NULL, CIDRMatcher *pExceptions = NULL)
+private:
+	// Exception and blacklist membership, sources coming back after a timeout or a ban
+	// are answered by the cache instead of searching the lists again. cached only answers
+	// from the cache and returns 0 on a miss.
+	uint8_t Verdict(uint32_t addr, bool cached = false)
 	{
-		blacklist = pBlacklist;
-		exceptions = pExceptions;
+		// The generation is read first, a verdict computed from lists replaced meanwhile is stored as stale
+		uint32_t generation = verdicts.Generation();
+		const CIDRMatcher *black = blacklist.load(std::memory_order_acquire);
+		const CIDRMatcher *white = exceptions.load(std::memory_order_acquire);
+		if (black == NULL && white == NULL)
+		{
+			return 0;
+		}
+		uint8_t flags;
+		if (verdicts.Lookup(addr, flags))
+		{
+			GlobalStatistics().Add(Stat::VerdictCacheHits);
+			return flags;
+		}
+		if (cached)
+		{
+			return 0;
+		}
+		flags = 0;
+		if (white && white->Contains(addr))
+		{
+			flags |= VerdictException;
+		}
+		else if (black && black->Contains(addr))
+		{
+			flags |= VerdictBlacklisted;
+		}
+		verdicts.Store(addr, flags, generation);
+		GlobalStatistics().Add(Stat::VerdictCacheMisses);
+		return flags;
 	}
 
-	void Log(const char *msg, uint32_t addr)
+	// Checked by the first address seen of a network, no cache for these few lookups
+	uint8_t Verdict6(const IPv6Address &addr, bool cached = false) const
 	{
-		auto t = std::time(nullptr);
-		std::tm tm{};
-		localtime_s(&tm, &t);
-		std::cout << "[" << std::put_time(&tm, "%Y-%m-%d %H:%M:%S") << "] " << msg << " " << ((addr >> 24) & 0xFF) << "." << ((addr >> 16) & 0xFF) << "." <<
-			((addr >> 8) & 0xFF) << "." << (addr & 0xFF) << std::endl;
-		if (out.is_open())
+		if (cached)
 		{
-			out << "[" << std::put_time(&tm, "%Y-%m-%d %H:%M:%S") << "] " << msg << " " << ((addr >> 24) & 0xFF) << "." << ((addr >> 16) & 0xFF) << "." <<
-				((addr >> 8) & 0xFF) << "." << (addr & 0xFF) << std::endl;
+			return 0;
 		}
+		if (exceptions6 && exceptions6->Contains(addr))
+		{
+			return VerdictException;
+		}
+		if (blacklist6 && blacklist6->Contains(addr))
+		{
+			return VerdictBlacklisted;
+		}
+		return 0;
 	}
 
-	bool IsActive(uint32_t addr, unsigned int timeout = TIMEOUT)
+	// Bans a blacklisted source unless its shard holds BAN_LIMIT bans already. Spoofed floods
+	// from blacklisted networks would grow the ban table without bound otherwise.
+	template <typename Key, typename Policy>
+	static bool BanBlacklisted(FirewallShard<Key> &shard, Key addr, tick_t now, FirewallEvent &event, const Policy &policy)
 	{
-		auto entry = table.find(addr);
-		if (entry == table.end())
+		if (shard.bans.Size() >= FirewallShard<Key>::BAN_LIMIT)
 		{
+			GlobalStatistics().Add(Stat::BansLimited);
 			return false;
 		}
-		return !entry->second.TimedOut();
+		shard.Ban(addr, now, policy.BanBlacklist(), BanReason::Blacklist);
+		event = FirewallEvent{ "Blacklist:", JournalEvent::Ban, BanReason::Blacklist };
+		GlobalStatistics().Add(Stat::BansBlacklist);
+		return true;
 	}
 
-	BanStatus ReceivePacket(uint32_t addr, uint16_t port)
+	// Updates the state of one shard for a packet. Must be called with the shard lock held,
+	// event receives the log message and the caller performs the ban/unban side effects.
+	// verdict(cached) returns the list flags of a source that is not tracked yet, policy holds
+	// the limits of dport, the destination port.
+	template <typename Key, typename VerdictFunction, typename Policy>
+	BanStatus Inspect(FirewallShard<Key> &shard, Key addr, uint16_t port, uint16_t dport, tick_t now, FirewallEvent &event,
+		VerdictFunction verdict_function, const Policy &policy)
 	{
-		time(&now);
-		BanStatus result = BanStatus::Unbanned;
-		if (IsSpecialAddress(addr) || whitelist.find(addr) != whitelist.end())
+		if (shard.whitelist.Find(addr) != NULL)
 		{
-			return result;
+			return BanStatus::Unbanned;
 		}
 
-		auto ban = bans.find(addr);
-		if (ban != bans.end())
+		BanInfo *ban = shard.bans.Find(addr);
+		if (ban != NULL)
 		{
-			if (ban->second.TimedOut())
+			if (ban->TimedOut(now))
 			{
-				Log("Unban:", addr);
-				bans.erase(ban);
-				if (unban_function != NULL)
-				{
-					unban_function(addr);
-				}
+				event = FirewallEvent{ "Unban:", JournalEvent::Unban, ban->reason };
+				shard.bans.Erase(addr);
+				GlobalStatistics().Add(Stat::Unbans);
 				return BanStatus::Unban;
 			}
 			else
 			{
+				GlobalStatistics().Add(Stat::BannedPackets);
 				return BanStatus::Banned;
 			}
 		}
 
-		auto entry = table.find(addr);
-		if (entry == table.end())
+		AddressStatistics *entry = shard.table.Find(addr);
+		if (entry == NULL)
 		{
-			if (exceptions && exceptions->Contains(addr))
+			// Spoofed addresses are seen once, a source sending again is tracked and rate limited
+			if (flood.load(std::memory_order_relaxed) && !shard.Forget(addr, now))
 			{
-				Log("Whitelist:", addr);
-				whitelist.insert(addr);
+				// Only known verdicts are used, searching the lists for spoofed addresses would fill the cache
+				if ((verdict_function(true) & VerdictBlacklisted) && BanBlacklisted(shard, addr, now, event, policy))
+				{
+					return BanStatus::Ban;
+				}
+				shard.Remember(addr, port, dport, now);
+				GlobalStatistics().Add(Stat::FloodUntracked);
 				return BanStatus::Unbanned;
 			}
-			if (blacklist && blacklist->Contains(addr))
+			uint8_t verdict = verdict_function(false);
+			if (verdict & VerdictException)
 			{
-				bans.insert(std::make_pair(addr, BanInfo(BAN_DURATION_BLACKLIST)));
-				if (ban_function != NULL)
-				{
-					ban_function(addr);
-				}
-				Log("Blacklist:", addr);
-				return BanStatus::Ban;
+				event = FirewallEvent{ "Whitelist:", JournalEvent::Whitelist, BanReason::None };
+				shard.whitelist.Insert(addr, true);
+				return BanStatus::Unbanned;
+			}
+			if (verdict & VerdictBlacklisted)
+			{
+				return BanBlacklisted(shard, addr, now, event, policy) ? BanStatus::Ban : BanStatus::Unbanned;
 			}
-			Log("First packet:", addr);
-			AddressStatistics entry(port);
-			table.insert(std::make_pair(addr, entry));
+			event = FirewallEvent{ "First packet:", JournalEvent::FirstPacket, BanReason::None };
+			shard.Track(addr, port, dport, now, policy);
+			GlobalStatistics().Add(Stat::NewSources);
 			return BanStatus::Unbanned;
 		}
 		else
 		{
-			if (entry->second.TimedOut())
+			if (entry->TimedOut(now))
 			{
-				Log("Reappearance:", addr);
-				entry->second.Reset(port);
+				event = FirewallEvent{ "Reappearance:", JournalEvent::Reappearance, BanReason::None };
+				entry->Reset(port, dport, now, policy);
 				return BanStatus::Unbanned;
 			}
-			entry->second.RemoveOldPorts();
-			if (entry->second.ports.size() > MAX_PORTS)
+			entry->RemoveOldPorts(now);
+			if (entry->port_count > policy.MaxPorts())
 			{
-				Log("Multiport:", addr);
-				bans.insert(std::make_pair(addr, BanInfo(BAN_DURATION_MULTIPORT)));
-				table.erase(entry);
-				if (ban_function != NULL)
-				{
-					ban_function(addr);
-				}
+				event = FirewallEvent{ "Multiport:", JournalEvent::Ban, BanReason::Multiport };
+				shard.Ban(addr, now, policy.BanMultiport(), BanReason::Multiport);
+				shard.table.Erase(addr);
+				GlobalStatistics().Add(Stat::BansMultiport);
 				return BanStatus::Ban;
 			}
-			entry->second.ports[port] = now;
+			entry->TouchPort(port, now);
 
-			entry->second.CountPacket();
-			if (entry->second.HitLimit())
+			if (entry->CountPacket(now, policy))
 			{
-				bans.insert(std::make_pair(addr, BanInfo(BAN_DURATION_FLOOD)));
-				table.erase(entry);
-				if (ban_function != NULL)
-				{
-					ban_function(addr);
-				}
-				Log("Flood:", addr);
+				shard.Ban(addr, now, policy.BanFlood(), BanReason::Flood);
+				shard.table.Erase(addr);
+				event = FirewallEvent{ "Flood:", JournalEvent::Ban, BanReason::Flood };
+				GlobalStatistics().Add(Stat::BansFlood);
 				return BanStatus::Ban;
 			}
 			return BanStatus::Unbanned;
 		}
 	}
 
-	void ClearOldEntries()
+public:
+	AttackFirewall(void(*ban)(uint32_t) = NULL, void(*unban)(uint32_t) = NULL, const char *log_path = "firewall.log", bool log_console = true)
+		: logger(log_path, log_console)
+	{
+		blacklist = NULL;
+		exceptions = NULL;
+		blacklist6 = NULL;
+		exceptions6 = NULL;
+		ban6_function = NULL;
+		unban6_function = NULL;
+		now = 0; // Set by UpdateClock() or SetClock()
+		last_purge = 0;
+		ban_function = ban;
+		unban_function = unban;
+		event_function = NULL;
+		policy_table = NULL;
+		flood = false;
+		flood_function = NULL;
+		flood_sources = 0;
+		flood_packets = 0;
+		flood_sampled = 0;
+		flood_exceeded = 0;
+	}
+
+	// Receives every logged event regardless of log rate limits. Set before capture starts.
+	void SetEventFunction(EventFunction events)
+	{
+		event_function = events;
+	}
+
+	// Called when flood mode starts or ends. Set before capture starts.
+	void SetFloodFunction(FloodFunction function)
+	{
+		flood_function = function;
+	}
+
+	// Sources not tracked yet are only remembered for verification queries while it is active
+	bool FloodMode() const
+	{
+		return flood.load(std::memory_order_relaxed);
+	}
+
+	// Replaces the per-address ban/unban calls with batches applied on a worker thread,
+	// IPv6 networks are batched as well if reconcile6 is set. Set before capture starts.
+	void SetReconcileFunction(ReconcileFunction reconcile, ReconcileFunction6 reconcile6 = NULL)
+	{
+		worker.Start(reconcile, reconcile6);
+	}
+
+	// Applies the queued ban changes and joins the worker, e.g. before the packet filter is
+	// stopped. Stop capture first, later changes call the ban functions directly.
+	void StopWorker()
+	{
+		worker.Stop();
+	}
+
+	// Blocks and unblocks IPv6 networks directly while there is no IPv6 reconcile function.
+	// Set before capture starts, IPv6 sources are not banned in the packet filter without them.
+	void SetIPv6Functions(NetworkFunction6 ban, NetworkFunction6 unban)
 	{
-		time(&now);
-		if(difftime(now, last_purge) <= PURGE_INTERVAL)
+		ban6_function = ban;
+		unban6_function = unban;
+	}
+
+	// IPv4 sources plus IPv6 networks
+	size_t ClientCount()
+	{
+		size_t count = 0;
+		for (size_t i = 0; i < (1 << SHARD_BITS); i++)
+		{
+			std::lock_guard<std::mutex> lock(shards[i].lock);
+			count += shards[i].table.Size();
+		}
+		for (size_t i = 0; i < (1 << SHARD_BITS_IPV6); i++)
+		{
+			std::lock_guard<std::mutex> lock(shards6[i].lock);
+			count += shards6[i].table.Size();
+		}
+		return count;
+	}
+
+	size_t BanCount()
+	{
+		size_t count = 0;
+		for (size_t i = 0; i < (1 << SHARD_BITS); i++)
+		{
+			std::lock_guard<std::mutex> lock(shards[i].lock);
+			count += shards[i].bans.Size();
+		}
+		for (size_t i = 0; i < (1 << SHARD_BITS_IPV6); i++)
+		{
+			std::lock_guard<std::mutex> lock(shards6[i].lock);
+			count += shards6[i].bans.Size();
+		}
+		return count;
+	}
+
+	BanWorkerStats WorkerStats() const
+	{
+		return worker.Stats();
+	}
+
+	void AddWhitelist(uint32_t addr)
+	{
+		classifier.AddWhitelistAddress(addr);
+		FirewallShard<uint32_t> &shard = shards[ShardIndex(addr)];
+		std::lock_guard<std::mutex> lock(shard.lock);
+		shard.whitelist.Insert(addr, true);
+	}
+
+	// Whitelists the network the address is tracked by, e.g. the one of a local interface
+	void AddWhitelist6(const IPv6Address &addr)
+	{
+		uint64_t network = NetworkKey6(addr);
+		FirewallShard<uint64_t> &shard = shards6[ShardIndex6(network)];
+		std::lock_guard<std::mutex> lock(shard.lock);
+		shard.whitelist.Insert(network, true);
+	}
+
+	// Registers a ban whose filter already exists, e.g. one kept from a previous run.
+	// Nothing is sent to the ban functions until it expires. The clock must be set first.
+	// Returns false if the address was banned already.
+	bool RestoreBan(uint32_t addr, tick_t duration = SECONDS_TO_TICKS(BAN_DURATION_FLOOD), BanReason reason = BanReason::Restored)
+	{
+		FirewallShard<uint32_t> &shard = shards[ShardIndex(addr)];
+		std::lock_guard<std::mutex> lock(shard.lock);
+		if (shard.bans.Find(addr) != NULL)
+		{
+			return false;
+		}
+		shard.Ban(addr, now.load(), duration, reason);
+		return true;
+	}
+
+	// Same as RestoreBan for an IPv6 network, keyed by its upper half
+	bool RestoreBan6(uint64_t network, tick_t duration = SECONDS_TO_TICKS(BAN_DURATION_FLOOD), BanReason reason = BanReason::Restored)
+	{
+		FirewallShard<uint64_t> &shard = shards6[ShardIndex6(network)];
+		std::lock_guard<std::mutex> lock(shard.lock);
+		if (shard.bans.Find(network) != NULL)
+		{
+			return false;
+		}
+		shard.Ban(network, now.load(), duration, reason);
+		return true;
+	}
+
+	// Tracks a client of a previous run as if its last packet arrived idle milliseconds ago.
+	// Its rate limit starts over. The clock must be set first.
+	void RestoreClient(const SnapshotClient &client)
+	{
+		tick_t current = now.load();
+		if (client.idle >= current || client.port_count == 0 || IsSpecialAddress(client.addr))
+		{
+			return;
+		}
+		tick_t last_seen = current - client.idle;
+		FirewallShard<uint32_t> &shard = shards[ShardIndex(client.addr)];
+		std::lock_guard<std::mutex> lock(shard.lock);
+		if (shard.bans.Find(client.addr) != NULL || shard.table.Find(client.addr) != NULL)
 		{
 			return;
 		}
-		for (auto it = table.begin(); it != table.end();)
+		const PolicyProfile *profile = Profile(client.dport);
+		if (profile == NULL)
+		{
+			shard.Track(client.addr, client.ports[0], client.dport, last_seen);
+		}
+		else
+		{
+			shard.Track(client.addr, client.ports[0], client.dport, last_seen, *profile);
+		}
+		AddressStatistics *entry = shard.table.Find(client.addr);
+		for (uint8_t i = 1; i < client.port_count && i < MAX_PORTS; i++)
+		{
+			entry->TouchPort(client.ports[i], last_seen);
+		}
+	}
+
+	// Copies the pending bans and, if clients is not NULL, the active clients. Safe while
+	// capture runs, every shard is only locked while it is copied.
+	void Snapshot(std::vector<SnapshotBan> &bans, std::vector<SnapshotBan6> &bans6, std::vector<SnapshotClient> *clients)
+	{
+		for (size_t i = 0; i < (1 << SHARD_BITS_IPV6); i++)
+		{
+			FirewallShard<uint64_t> &shard = shards6[i];
+			std::lock_guard<std::mutex> lock(shard.lock);
+			tick_t current = now.load();
+			shard.bans.ForEach([&bans6, current](uint64_t network, const BanInfo &ban)
+			{
+				if (!ban.TimedOut(current))
+				{
+					SnapshotBan6 saved = {};
+					saved.network = network;
+					saved.remaining = (uint32_t)(ban.expiry - current);
+					saved.reason = ban.reason;
+					bans6.push_back(saved);
+				}
+			});
+		}
+		for (size_t i = 0; i < (1 << SHARD_BITS); i++)
 		{
-			if (it->second.TimedOut())
+			FirewallShard<uint32_t> &shard = shards[i];
+			std::lock_guard<std::mutex> lock(shard.lock);
+			tick_t current = now.load();
+			shard.bans.ForEach([&bans, current](uint32_t addr, const BanInfo &ban)
+			{
+				if (!ban.TimedOut(current))
+				{
+					SnapshotBan saved = {};
+					saved.addr = addr;
+					saved.remaining = (uint32_t)(ban.expiry - current);
+					saved.reason = ban.reason;
+					bans.push_back(saved);
+				}
+			});
+			if (clients == NULL)
 			{
-				it = table.erase(it);
+				continue;
 			}
-			else
+			shard.table.ForEach([clients, current](uint32_t addr, const AddressStatistics &entry)
+			{
+				if (entry.TimedOut(current))
+				{
+					return;
+				}
+				SnapshotClient client = {};
+				client.addr = addr;
+				client.idle = (uint32_t)(current - entry.last_seen);
+				client.dport = entry.dport;
+				for (uint32_t p = 0; p < entry.port_count && client.port_count < SNAPSHOT_CLIENT_PORTS; p++)
+				{
+					if ((uint32_t)current - entry.ports[p].last_seen <= SECONDS_TO_TICKS(TIMEOUT))
+					{
+						client.ports[client.port_count++] = entry.ports[p].port;
+					}
+				}
+				if (client.port_count > 0)
+				{
+					clients->push_back(client);
+				}
+			});
+		}
+	}
+
+	// Not synchronized with ReceivePacket, set the lists before capture starts.
+	// Small exception lists are checked by the batch classifier, ReceiveBatch then
+	// skips their sources without logging them.
+	void SetBlacklist(const CIDRMatcher *pBlacklist = NULL, const CIDRMatcher *pExceptions = NULL)
+	{
+		blacklist = pBlacklist;
+		exceptions = pExceptions;
+		verdicts.Invalidate();
+		if (pExceptions == NULL || !classifier.SetWhitelistRanges(pExceptions->Ranges(), pExceptions->Size()))
+		{
+			classifier.SetWhitelistRanges(NULL, 0);
+		}
+	}
+
+	// Not synchronized with ReceivePacket6, set the lists before capture starts.
+	// Lists are matched against the full address of the first packet of a network.
+	void SetBlacklist6(const CIDR6Matcher *pBlacklist = NULL, const CIDR6Matcher *pExceptions = NULL)
+	{
+		blacklist6 = pBlacklist;
+		exceptions6 = pExceptions;
+	}
+
+	// Swaps the per port limits while capture runs, NULL applies DefaultPolicy everywhere.
+	// Packets being inspected may still use the old table, keep it alive for a while (see
+	// PolicyReloader). Clients keep their state, only the limits change.
+	void SetPolicy(const PolicyTable *policy)
+	{
+		policy_table.store(policy, std::memory_order_release);
+	}
+
+	// Swaps the lists while capture runs, the packet path never waits for it. Lookups
+	// already running may still use the old lists, keep them alive for a while (see
+	// ListReloader). Exceptions are then checked per source through the verdict cache.
+	void ReplaceLists(const CIDRMatcher *pBlacklist, const CIDRMatcher *pExceptions)
+	{
+		classifier.DropWhitelistRanges();
+		blacklist.store(pBlacklist, std::memory_order_release);
+		exceptions.store(pExceptions, std::memory_order_release);
+		verdicts.Invalidate();
+	}
+
+	// msg must be a string literal, records are formatted later on the writer thread
+	void Log(const char *msg, uint32_t addr, LogCategory category = LogCategory::Info)
+	{
+		logger.Log(category, msg, addr);
+	}
+
+	void Log6(const char *msg, const IPv6Address &addr, LogCategory category = LogCategory::Info)
+	{
+		logger.Log6(category, msg, NetworkKey6(addr), IPV6_PREFIX);
+	}
+
+	// Samples the monotonic clock, called once per receive batch
+	void UpdateClock()
+	{
+		SetClock(MonotonicTicks());
+	}
+
+	// Advances the firewall clock; it never moves backwards when several threads update it
+	void SetClock(tick_t ticks)
+	{
+		tick_t current = now.load(std::memory_order_relaxed);
+		while (ticks > current && !now.compare_exchange_weak(current, ticks, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	bool IsActive(uint32_t addr, unsigned int timeout = TIMEOUT)
+	{
+		FirewallShard<uint32_t> &shard = shards[ShardIndex(addr)];
+		std::lock_guard<std::mutex> lock(shard.lock);
+		AddressStatistics *entry = shard.table.Find(addr);
+		if (entry == NULL)
+		{
+			return false;
+		}
+		return !entry->TimedOut(now.load(std::memory_order_relaxed), SECONDS_TO_TICKS(timeout));
+	}
+
+	// Answers a verification query like IsActive. A source that was not tracked because of
+	// flood mode is admitted, from then on it is rate limited like any other client.
+	// idle, if not NULL, receives the ticks since the last packet of an active source.
+	bool Verify(uint32_t addr, unsigned int timeout = TIMEOUT, tick_t *idle = NULL)
+	{
+		FirewallShard<uint32_t> &shard = shards[ShardIndex(addr)];
+		std::lock_guard<std::mutex> lock(shard.lock);
+		tick_t current = now.load(std::memory_order_relaxed);
+		AddressStatistics *entry = shard.table.Find(addr);
+		if (entry != NULL)
+		{
+			if (idle != NULL)
 			{
-				it++;
+				*idle = current - entry->last_seen;
 			}
+			return !entry->TimedOut(current, SECONDS_TO_TICKS(timeout));
 		}
+		if (shard.Admit(addr, current, [this, addr]() { return Verdict(addr); }, [this](uint16_t dport) { return Profile(dport); }))
+		{
+			GlobalStatistics().Add(Stat::FloodAdmitted);
+			if (idle != NULL)
+			{
+				*idle = 0;
+			}
+			return true;
+		}
+		return false;
+	}
 
-		for (auto it = bans.begin(); it != bans.end();)
+	// Thread-safe: sources in different shards are processed without contention.
+	// dport selects the policy profile.
+	BanStatus ReceivePacket(uint32_t addr, uint16_t port, uint16_t dport = 0)
+	{
+		if (IsSpecialAddress(addr))
 		{
-			if (unban_function != NULL)
+			GlobalStatistics().Add(Stat::FilteredSpecial);
+			return BanStatus::Unbanned;
+		}
+		return Receive(addr, port, dport);
+	}
+
+	// Same as ReceivePacket for every packet, which needs the saddr, sport and dport members.
+	// Reserved networks and whitelisted sources are sorted out in one vector pass
+	// per batch and never reach the shards.
+	template <typename Packet>
+	void ReceiveBatch(const Packet *packets, size_t count)
+	{
+		uint32_t addrs[BATCH_CLASSIFIER_SIZE];
+		AddressClass classes[BATCH_CLASSIFIER_SIZE];
+		for (size_t offset = 0; offset < count; offset += BATCH_CLASSIFIER_SIZE)
+		{
+			size_t size = count - offset < BATCH_CLASSIFIER_SIZE ? count - offset : BATCH_CLASSIFIER_SIZE;
+			for (size_t i = 0; i < size; i++)
 			{
-				unban_function(it->first);
+				addrs[i] = packets[offset + i].saddr;
 			}
-			if (it->second.TimedOut())
+			classifier.Classify(addrs, size, classes);
+
+			uint64_t special = 0;
+			for (size_t i = 0; i < size; i++)
 			{
-				uint32_t addr = it->first;
-				Log("Unban:", addr);
-				it = bans.erase(it);
+				if (classes[i] == AddressClass::Inspect)
+				{
+					Receive(addrs[i], packets[offset + i].sport, packets[offset + i].dport);
+				}
+				else if (classes[i] == AddressClass::Special)
+				{
+					special++;
+				}
 			}
-			else
+			if (special > 0)
 			{
-				it++;
+				GlobalStatistics().Add(Stat::FilteredSpecial, special);
 			}
 		}
-		last_purge = now;
+	}
+
+	// Same as ReceivePacket for an IPv6 source, all addresses of its network share one state
+	BanStatus ReceivePacket6(const IPv6Address &addr, uint16_t port, uint16_t dport = 0)
+	{
+		if (IsSpecialAddress6(addr))
+		{
+			GlobalStatistics().Add(Stat::FilteredSpecial);
+			return BanStatus::Unbanned;
+		}
+		return Receive6(addr, port, dport);
+	}
+
+	// Same as ReceivePacket6 for every packet, which needs the saddr, sport and dport members
+	template <typename Packet>
+	void ReceiveBatch6(const Packet *packets, size_t count)
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			ReceivePacket6(packets[i].saddr, packets[i].sport, packets[i].dport);
+		}
+	}
+
+	void ClearOldEntries()
+	{
+		tick_t current = now.load();
+		tick_t last = last_purge.load();
+		if (current - last > SECONDS_TO_TICKS(PURGE_INTERVAL) && last_purge.compare_exchange_strong(last, current))
+		{
+			ExpireTimers();
+			DetectFlood(current);
+		}
 	}
 
 	~AttackFirewall()
 	{
-		if (out.is_open())
+		for (size_t i = 0; i < (1 << SHARD_BITS); i++)
+		{
+			shards[i].bans.ForEach([this](uint32_t addr, const BanInfo &)
+			{
+				ChangeBan(addr, false);
+			});
+		}
+		for (size_t i = 0; i < (1 << SHARD_BITS_IPV6); i++)
+		{
+			shards6[i].bans.ForEach([this](uint64_t network, const BanInfo &)
+			{
+				ChangeBan6(network, false);
+			});
+		}
+		worker.Stop();
+	}
+
+private:
+	// NULL when the destination port keeps DefaultPolicy
+	const PolicyProfile *Profile(uint16_t dport) const
+	{
+		const PolicyTable *table = policy_table.load(std::memory_order_acquire);
+		return table != NULL ? table->Find(dport) : NULL;
+	}
+
+	// Per-address state machine for sources outside of the reserved networks
+	BanStatus Receive(uint32_t addr, uint16_t port, uint16_t dport)
+	{
+		FirewallShard<uint32_t> &shard = shards[ShardIndex(addr)];
+		FirewallEvent event = { NULL, JournalEvent::None, BanReason::None };
+		BanStatus result;
+		const PolicyProfile *profile = Profile(dport);
+		auto verdict = [this, addr](bool cached) { return Verdict(addr, cached); };
+		bool changed, queued;
+		{
+			std::lock_guard<std::mutex> lock(shard.lock);
+
+			// Read under the lock so that no record ever sees the clock go backwards
+			tick_t current = now.load(std::memory_order_relaxed);
+			result = profile == NULL ? Inspect(shard, addr, port, dport, current, event, verdict, DefaultPolicy()) :
+				Inspect(shard, addr, port, dport, current, event, verdict, *profile);
+			changed = result == BanStatus::Ban || result == BanStatus::Unban;
+			queued = changed && QueueBan(addr, result == BanStatus::Ban);
+		}
+
+		// Side effects run outside of the shard lock, ban functions may block
+		if (event.msg != NULL)
+		{
+			Log(event.msg, addr, result == BanStatus::Ban ? LogCategory::Ban : result == BanStatus::Unban ? LogCategory::Unban : LogCategory::Source);
+			if (event_function != NULL)
+			{
+				event_function(event.type, event.reason, addr, port);
+			}
+		}
+		if (changed && !queued)
+		{
+			DirectBan(addr, result == BanStatus::Ban);
+		}
+		return result;
+	}
+
+	// Pushes a filter change to the ban worker. Called with the shard lock held, so the
+	// worker receives the changes of an address in the order the shard made them and an
+	// expiry cannot remove the filter of a ban pushed meanwhile. Returns false without a
+	// worker, the caller then calls DirectBan after releasing the lock.
+	bool QueueBan(uint32_t addr, bool banned)
+	{
+		if (!worker.Running())
+		{
+			return false;
+		}
+		worker.Push(addr, banned ? BanChange::Add : BanChange::Remove);
+		return true;
+	}
+
+	// Ban functions may block, never called with a shard lock held
+	void DirectBan(uint32_t addr, bool banned)
+	{
+		if (banned && ban_function != NULL)
+		{
+			ban_function(addr);
+		}
+		else if (!banned && unban_function != NULL)
+		{
+			unban_function(addr);
+		}
+	}
+
+	void ChangeBan(uint32_t addr, bool banned)
+	{
+		if (!QueueBan(addr, banned))
 		{
-			out.close();
+			DirectBan(addr, banned);
 		}
-		for (auto it = bans.begin(); it != bans.end(); it++)
+	}
+
+	// IPv6 counterpart of Receive, tracks the network of the source
+	BanStatus Receive6(const IPv6Address &addr, uint16_t port, uint16_t dport)
+	{
+		uint64_t network = NetworkKey6(addr);
+		FirewallShard<uint64_t> &shard = shards6[ShardIndex6(network)];
+		FirewallEvent event = { NULL, JournalEvent::None, BanReason::None };
+		BanStatus result;
+		const PolicyProfile *profile = Profile(dport);
+		auto verdict = [this, &addr](bool cached) { return Verdict6(addr, cached); };
+		bool changed, queued;
 		{
-			if (unban_function != NULL)
+			std::lock_guard<std::mutex> lock(shard.lock);
+			tick_t current = now.load(std::memory_order_relaxed);
+			result = profile == NULL ? Inspect(shard, network, port, dport, current, event, verdict, DefaultPolicy()) :
+				Inspect(shard, network, port, dport, current, event, verdict, *profile);
+			changed = result == BanStatus::Ban || result == BanStatus::Unban;
+			queued = changed && QueueBan6(network, result == BanStatus::Ban);
+		}
+
+		// The journal only holds IPv4 addresses, IPv6 events are logged only
+		if (event.msg != NULL)
+		{
+			Log6(event.msg, addr, result == BanStatus::Ban ? LogCategory::Ban : result == BanStatus::Unban ? LogCategory::Unban : LogCategory::Source);
+		}
+		if (changed && !queued)
+		{
+			DirectBan6(network, result == BanStatus::Ban);
+		}
+		return result;
+	}
+
+	// Same as QueueBan for an IPv6 network
+	bool QueueBan6(uint64_t network, bool banned)
+	{
+		if (!worker.Running6())
+		{
+			return false;
+		}
+		worker.Push6(network, banned ? BanChange::Add : BanChange::Remove);
+		return true;
+	}
+
+	void DirectBan6(uint64_t network, bool banned)
+	{
+		if (banned && ban6_function != NULL)
+		{
+			ban6_function(Network6(network));
+		}
+		else if (!banned && unban6_function != NULL)
+		{
+			unban6_function(Network6(network));
+		}
+	}
+
+	void ChangeBan6(uint64_t network, bool banned)
+	{
+		if (!QueueBan6(network, banned))
+		{
+			DirectBan6(network, banned);
+		}
+	}
+
+	// Advances the timers of one shard, expired bans are collected for their side effects
+	template <typename Key>
+	static void ExpireShard(FirewallShard<Key> &shard, tick_t current, std::vector<std::pair<Key, BanReason>> &expired)
+	{
+		shard.client_timers.Advance(current, [&shard, current](Key addr, tick_t deadline)
+		{
+			AddressStatistics *entry = shard.table.Find(addr);
+			if (entry == NULL || entry->timer != deadline)
+			{
+				return;
+			}
+			if (entry->TimedOut(current))
+			{
+				shard.table.Erase(addr);
+				return;
+			}
+
+			// Seen again since the timer was set
+			entry->timer = entry->last_seen + SECONDS_TO_TICKS(TIMEOUT) + 1;
+			shard.client_timers.Schedule(addr, entry->timer);
+		});
+
+		shard.ban_timers.Advance(current, [&shard, &expired](Key addr, tick_t deadline)
+		{
+			BanInfo *ban = shard.bans.Find(addr);
+			if (ban == NULL || ban->expiry != deadline)
+			{
+				return;
+			}
+			expired.push_back(std::make_pair(addr, ban->reason));
+			shard.bans.Erase(addr);
+		});
+	}
+
+	// Spoofed floods from random addresses stay below the per-source limits, so flood mode
+	// is switched on the aggregate rates since the previous purge. Untracked packets count
+	// as new sources only and packets of banned sources not at all: sources flooding from
+	// real addresses are tracked and banned, their packets cannot keep flood mode on.
+	void DetectFlood(tick_t current)
+	{
+		Statistics &stats = GlobalStatistics();
+		uint64_t untracked = stats.Get(Stat::FloodUntracked);
+		uint64_t ignored = untracked + stats.Get(Stat::BannedPackets);
+		uint64_t sources = stats.Get(Stat::NewSources) + untracked;
+		uint64_t received = stats.Get(Stat::PacketsReceived);
+		uint64_t packets = received > ignored ? received - ignored : 0;
+		tick_t elapsed = current - flood_sampled;
+		bool first = flood_sampled == 0;
+		uint64_t source_rate = first ? 0 : (sources - flood_sources) * TICKS_PER_SECOND / elapsed;
+		// The counters are read one after the other, the difference may lag behind by a few packets
+		uint64_t packet_rate = first || packets < flood_packets ? 0 : (packets - flood_packets) * TICKS_PER_SECOND / elapsed;
+		flood_sources = sources;
+		flood_packets = packets;
+		flood_sampled = current;
+
+		bool exceeded = source_rate >= FLOOD_NEW_SOURCES || packet_rate >= FLOOD_PACKETS;
+		if (exceeded)
+		{
+			flood_exceeded = current;
+		}
+		bool active = flood.load(std::memory_order_relaxed);
+		if (active ? current - flood_exceeded < SECONDS_TO_TICKS(FLOOD_COOLDOWN) : !exceeded)
+		{
+			return;
+		}
+		flood.store(!active, std::memory_order_relaxed);
+		if (!active)
+		{
+			stats.Add(Stat::FloodModes);
+		}
+		if (flood_function != NULL)
+		{
+			flood_function(!active, source_rate, packet_rate);
+		}
+	}
+
+	void ExpireTimers()
+	{
+		// Only the timers that fired are visited, the tables are never scanned
+		StatTimer timer(StatHistogram::PurgeDuration);
+		std::vector<std::pair<uint32_t, BanReason>> expired;
+		std::vector<std::pair<uint64_t, BanReason>> expired6;
+		bool queued = worker.Running();
+		bool queued6 = worker.Running6();
+		for (size_t i = 0; i < (1 << SHARD_BITS); i++)
+		{
+			std::lock_guard<std::mutex> lock(shards[i].lock);
+			size_t first = expired.size();
+			ExpireShard(shards[i], now.load(), expired);
+			for (size_t j = first; queued && j < expired.size(); j++)
+			{
+				QueueBan(expired[j].first, false);
+			}
+		}
+		for (size_t i = 0; i < (1 << SHARD_BITS_IPV6); i++)
+		{
+			std::lock_guard<std::mutex> lock(shards6[i].lock);
+			size_t first = expired6.size();
+			ExpireShard(shards6[i], now.load(), expired6);
+			for (size_t j = first; queued6 && j < expired6.size(); j++)
+			{
+				QueueBan6(expired6[j].first, false);
+			}
+		}
+
+		GlobalStatistics().Add(Stat::Unbans, expired.size() + expired6.size());
+		for (auto it = expired6.begin(); it != expired6.end(); it++)
+		{
+			logger.Log6(LogCategory::Unban, "Unban:", it->first, IPV6_PREFIX);
+			if (!queued6)
+			{
+				DirectBan6(it->first, false);
+			}
+		}
+		for (auto it = expired.begin(); it != expired.end(); it++)
+		{
+			Log("Unban:", it->first, LogCategory::Unban);
+			if (event_function != NULL)
+			{
+				event_function(JournalEvent::Unban, it->second, it->first, 0);
+			}
+			if (!queued)
 			{
-				unban_function(it->first);
+				DirectBan(it->first, false);
 			}
 		}
 	}
@@ -0,0 +1,176 @@
+#pragma once
+// Collapses banned addresses into prefix filters when a subnet floods
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "cidr.h"
+#include "flat_table.h"
+
+#define AGGREGATE_PREFIX 24 // prefix length of the collapsed filters
+#define AGGREGATE_THRESHOLD 16 // banned addresses inside one prefix before it is collapsed
+#define AGGREGATE_SPLIT (AGGREGATE_THRESHOLD / 2) // banned addresses below which a collapsed prefix is split again
+
+// Translates per-address ban changes into filter changes. Each prefix is in one of two
+// states: every banned address has its own /32 filter, or one filter covers the prefix.
+// The hysteresis between AGGREGATE_THRESHOLD and AGGREGATE_SPLIT keeps a subnet near
+// the limit from flapping. Not synchronized, the ban worker is its only caller.
+class BanAggregator
+{
+private:
+	struct Group
+	{
+		uint32_t count;
+		bool collapsed;
+	};
+
+	FlatTable<uint32_t, bool> banned;
+	FlatTable<uint32_t, Group> groups; // by prefix network
+	FlatTable<uint32_t, bool> exceptions; // prefixes that are never collapsed
+	std::unordered_map<CIDR, int> delta; // net filter change of the current batch
+
+	static uint32_t Network(uint32_t addr)
+	{
+		return addr & ~CIDRHostMask(AGGREGATE_PREFIX);
+	}
+
+	void Change(uint32_t network, uint8_t prefix, int change)
+	{
+		CIDR cidr = { network, prefix };
+		int &value = delta[cidr];
+		value += change;
+	}
+
+	// Adds or removes the /32 filters of every banned address inside the prefix
+	void ChangeMembers(uint32_t network, int change)
+	{
+		for (uint32_t offset = 0; offset <= CIDRHostMask(AGGREGATE_PREFIX); offset++)
+		{
+			if (banned.Find(network + offset) != NULL)
+			{
+				Change(network + offset, 32, change);
+			}
+		}
+	}
+
+	void Add(uint32_t addr)
+	{
+		if (banned.Find(addr) != NULL)
+		{
+			return;
+		}
+		banned.Insert(addr, true);
+
+		uint32_t network = Network(addr);
+		Group *group = groups.Find(network);
+		if (group == NULL)
+		{
+			group = groups.Insert(network);
+			group->count = 0;
+			group->collapsed = false;
+		}
+		group->count++;
+
+		if (group->collapsed)
+		{
+			return;
+		}
+		Change(addr, 32, 1);
+		if (group->count >= AGGREGATE_THRESHOLD && exceptions.Find(network) == NULL)
+		{
+			group->collapsed = true;
+			ChangeMembers(network, -1);
+			Change(network, AGGREGATE_PREFIX, 1);
+		}
+	}
+
+	void Remove(uint32_t addr)
+	{
+		if (!banned.Erase(addr))
+		{
+			return;
+		}
+
+		uint32_t network = Network(addr);
+		Group *group = groups.Find(network);
+		group->count--;
+		if (!group->collapsed)
+		{
+			Change(addr, 32, -1);
+		}
+		else if (group->count < AGGREGATE_SPLIT)
+		{
+			group->collapsed = false;
+			Change(network, AGGREGATE_PREFIX, -1);
+			ChangeMembers(network, 1);
+		}
+		if (group->count == 0)
+		{
+			groups.Erase(network);
+		}
+	}
+
+public:
+	// Prefixes containing addr are always banned address by address
+	void AddException(uint32_t addr)
+	{
+		exceptions.Insert(Network(addr), true);
+	}
+
+	// Counts an address whose /32 filter already exists, call before the first Reconcile
+	void Restore(uint32_t addr)
+	{
+		if (banned.Find(addr) != NULL)
+		{
+			return;
+		}
+		banned.Insert(addr, true);
+
+		uint32_t network = Network(addr);
+		Group *group = groups.Find(network);
+		if (group == NULL)
+		{
+			group = groups.Insert(network);
+			group->count = 0;
+			group->collapsed = false;
+		}
+		group->count++;
+	}
+
+	// Filter changes are returned with opposite changes of the same batch cancelled
+	void Reconcile(const uint32_t *add, size_t add_count, const uint32_t *remove, size_t remove_count,
+		std::vector<CIDR> &filter_add, std::vector<CIDR> &filter_remove)
+	{
+		for (size_t i = 0; i < remove_count; i++)
+		{
+			Remove(remove[i]);
+		}
+		for (size_t i = 0; i < add_count; i++)
+		{
+			Add(add[i]);
+		}
+
+		for (auto it = delta.begin(); it != delta.end(); it++)
+		{
+			if (it->second > 0)
+			{
+				filter_add.push_back(it->first);
+			}
+			else if (it->second < 0)
+			{
+				filter_remove.push_back(it->first);
+			}
+		}
+		delta.clear();
+	}
+
+	size_t Collapsed() const
+	{
+		size_t count = 0;
+		groups.ForEach([&count](uint32_t network, const Group &group)
+		{
+			count += group.collapsed ? 1 : 0;
+		});
+		return count;
+	}
+};
@@ -0,0 +1,290 @@
+#pragma once
+// Background thread applying ban changes to the packet filter
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "flat_table.h"
+#include "mpsc_queue.h"
+
+#define BAN_QUEUE_SIZE 4096 // pending commands, power of two
+#define BAN_WORKER_IDLE 100 // milliseconds between wakeups when nothing is queued
+
+enum class BanChange : uint8_t {
+	Add,
+	Remove
+};
+
+typedef void(*ReconcileFunction)(const uint32_t *add, size_t add_count, const uint32_t *remove, size_t remove_count);
+// IPv6 networks by the upper half of their address, see AttackFirewall::Network6
+typedef void(*ReconcileFunction6)(const uint64_t *add, size_t add_count, const uint64_t *remove, size_t remove_count);
+
+struct BanWorkerStats
+{
+	size_t depth;
+	size_t max_depth;
+	uint64_t commands;
+	uint64_t coalesced; // commands cancelled by an opposite one before being applied
+	uint64_t batches;
+	uint64_t stalls; // pushes that waited for a full queue
+	uint64_t last_latency; // microseconds from the oldest push of a batch to its commit
+	uint64_t max_latency; // microseconds
+};
+
+// Packet threads push commands into bounded lock-free MPSC queues, one per address family;
+// the worker drains them, coalesces commands per address and hands each batch to the
+// reconcile functions, so filter engine calls never run on a capture thread.
+class BanWorker
+{
+private:
+	template <typename Key>
+	struct Command
+	{
+		Key addr;
+		BanChange change;
+		uint64_t queued; // microseconds
+	};
+
+	// Commands of one address family and the batch they are coalesced into
+	template <typename Key>
+	struct Channel
+	{
+		MpscQueue<Command<Key>, BAN_QUEUE_SIZE> queue;
+		FlatTable<Key, BanChange> pending;
+		std::vector<Key> add;
+		std::vector<Key> remove;
+	};
+
+	Channel<uint32_t> channel;
+	Channel<uint64_t> channel6;
+
+	ReconcileFunction reconcile_function;
+	ReconcileFunction6 reconcile6_function;
+	std::thread thread;
+	std::mutex wake_lock;
+	std::condition_variable wake;
+	std::atomic<bool> idle;
+	std::atomic<bool> running;
+
+	std::atomic<size_t> max_depth;
+	std::atomic<uint64_t> commands;
+	std::atomic<uint64_t> coalesced;
+	std::atomic<uint64_t> batches;
+	std::atomic<uint64_t> stalls;
+	std::atomic<uint64_t> last_latency;
+	std::atomic<uint64_t> max_latency;
+
+	static uint64_t Microseconds()
+	{
+		return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	static void UpdateMax(std::atomic<uint64_t> &max, uint64_t value)
+	{
+		uint64_t current = max.load();
+		while (value > current && !max.compare_exchange_weak(current, value))
+		{
+		}
+	}
+
+	// Never drops a command: when the queue is full the caller waits for the worker to catch up
+	template <typename Key>
+	void Push(Channel<Key> &target, Key addr, BanChange change)
+	{
+		Command<Key> command = { addr, change, Microseconds() };
+		if (!target.queue.TryPush(command))
+		{
+			stalls++;
+			do
+			{
+				std::this_thread::yield();
+			} while (!target.queue.TryPush(command));
+		}
+
+		size_t depth = Depth();
+		size_t max = max_depth.load();
+		while (depth > max && !max_depth.compare_exchange_weak(max, depth))
+		{
+		}
+
+		if (idle.load())
+		{
+			std::lock_guard<std::mutex> lock(wake_lock);
+			wake.notify_one();
+		}
+	}
+
+	// Coalesces everything queued so far into the add and remove lists of the channel.
+	// Returns the number of commands, oldest receives the queue time of the first one.
+	template <typename Key>
+	size_t Collect(Channel<Key> &source, uint64_t &oldest)
+	{
+		Command<Key> command;
+		size_t count = 0;
+		while (source.queue.TryPop(command))
+		{
+			if (count++ == 0 && command.queued < oldest)
+			{
+				oldest = command.queued;
+			}
+			BanChange *previous = source.pending.Find(command.addr);
+			if (previous == NULL)
+			{
+				source.pending.Insert(command.addr, command.change);
+			}
+			else if (*previous != command.change)
+			{
+				// Opposite changes cancel out, the applied state is already the desired one
+				source.pending.Erase(command.addr);
+				coalesced += 2;
+			}
+		}
+		source.pending.ForEach([&source](Key addr, BanChange change)
+		{
+			(change == BanChange::Add ? source.add : source.remove).push_back(addr);
+		});
+		source.pending.Clear();
+		return count;
+	}
+
+	// Drains everything queued so far into one batch per address family, returns false if
+	// nothing was queued
+	bool Drain()
+	{
+		uint64_t oldest = UINT64_MAX;
+		size_t count = Collect(channel, oldest) + Collect(channel6, oldest);
+		if (count == 0)
+		{
+			return false;
+		}
+		commands += count;
+
+		bool applied = false;
+		if (!channel.add.empty() || !channel.remove.empty())
+		{
+			reconcile_function(channel.add.data(), channel.add.size(), channel.remove.data(), channel.remove.size());
+			batches++;
+			applied = true;
+		}
+		if (!channel6.add.empty() || !channel6.remove.empty())
+		{
+			reconcile6_function(channel6.add.data(), channel6.add.size(), channel6.remove.data(), channel6.remove.size());
+			batches++;
+			applied = true;
+		}
+		if (applied)
+		{
+			uint64_t latency = Microseconds() - oldest;
+			last_latency = latency;
+			UpdateMax(max_latency, latency);
+		}
+		channel.add.clear();
+		channel.remove.clear();
+		channel6.add.clear();
+		channel6.remove.clear();
+		return true;
+	}
+
+	void Run()
+	{
+		while (running.load())
+		{
+			if (Drain())
+			{
+				continue;
+			}
+			std::unique_lock<std::mutex> lock(wake_lock);
+			idle = true;
+			if (Depth() == 0 && running.load())
+			{
+				wake.wait_for(lock, std::chrono::milliseconds(BAN_WORKER_IDLE));
+			}
+			idle = false;
+		}
+		while (Drain())
+		{
+		}
+	}
+
+public:
+	BanWorker() : reconcile_function(NULL), reconcile6_function(NULL), idle(false), running(false), max_depth(0), commands(0),
+		coalesced(0), batches(0), stalls(0), last_latency(0), max_latency(0)
+	{
+	}
+
+	BanWorker(const BanWorker&) = delete;
+	BanWorker &operator=(const BanWorker&) = delete;
+
+	// IPv6 changes can only be pushed with a reconcile6 function
+	void Start(ReconcileFunction reconcile, ReconcileFunction6 reconcile6 = NULL)
+	{
+		reconcile_function = reconcile;
+		reconcile6_function = reconcile6;
+		running = true;
+		thread = std::thread(&BanWorker::Run, this);
+	}
+
+	// Applies everything still queued and joins the worker
+	void Stop()
+	{
+		if (!thread.joinable())
+		{
+			return;
+		}
+		{
+			std::lock_guard<std::mutex> lock(wake_lock);
+			running = false;
+		}
+		wake.notify_one();
+		thread.join();
+	}
+
+	bool Running() const
+	{
+		return thread.joinable();
+	}
+
+	bool Running6() const
+	{
+		return Running() && reconcile6_function != NULL;
+	}
+
+	void Push(uint32_t addr, BanChange change)
+	{
+		Push(channel, addr, change);
+	}
+
+	// network is the upper half of an IPv6 network address
+	void Push6(uint64_t network, BanChange change)
+	{
+		Push(channel6, network, change);
+	}
+
+	size_t Depth() const
+	{
+		return channel.queue.Depth() + channel6.queue.Depth();
+	}
+
+	BanWorkerStats Stats() const
+	{
+		BanWorkerStats stats;
+		stats.depth = Depth();
+		stats.max_depth = max_depth.load();
+		stats.commands = commands.load();
+		stats.coalesced = coalesced.load();
+		stats.batches = batches.load();
+		stats.stalls = stalls.load();
+		stats.last_latency = last_latency.load();
+		stats.max_latency = max_latency.load();
+		return stats;
+	}
+
+	~BanWorker()
+	{
+		Stop();
+	}
+};
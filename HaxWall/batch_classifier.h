@@ -0,0 +1,237 @@
+#pragma once
+// Vectorized pre-classification of receive batches against the reserved networks and small whitelists
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "cidr.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define BATCH_CLASSIFIER_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BATCH_CLASSIFIER_SSE2
+#endif
+
+#define BATCH_CLASSIFIER_SIZE 64 // addresses classified per pass
+#define BATCH_CLASSIFIER_RANGES 24 // reserved networks plus whitelist ranges checked in the vector pass
+#define BATCH_CLASSIFIER_ADDRESSES 16 // exact whitelist addresses checked in the vector pass, e.g. local interfaces
+
+enum class AddressClass : uint8_t {
+	Inspect, // needs the per-address state
+	Special,
+	Whitelisted
+};
+
+// Same networks as AttackFirewall::IsSpecialAddress, including its quirks (172.32.0.0/16)
+constexpr CIDRRange special_ranges[] = {
+	{ 0x00000000, 0x00FFFFFF }, // 0.0.0.0/8
+	{ 0x0A000000, 0x0AFFFFFF }, // 10.0.0.0/8
+	{ 0x64400000, 0x647FFFFF }, // 100.64.0.0/10
+	{ 0x7F000000, 0x7FFFFFFF }, // 127.0.0.0/8
+	{ 0xA9FE0000, 0xA9FEFFFF }, // 169.254.0.0/16
+	{ 0xAC100000, 0xAC20FFFF }, // 172.16.0.0 - 172.32.255.255
+	{ 0xC0000000, 0xC00000FF }, // 192.0.0.0/24
+	{ 0xC0000200, 0xC00002FF }, // 192.0.2.0/24
+	{ 0xC0586300, 0xC05863FF }, // 192.88.99.0/24
+	{ 0xC0A80000, 0xC0A8FFFF }, // 192.168.0.0/16
+	{ 0xC6120000, 0xC613FFFF }, // 198.18.0.0/15
+	{ 0xC6336400, 0xC63364FF }, // 198.51.100.0/24
+	{ 0xCB007100, 0xCB0071FF }, // 203.0.113.0/24
+	{ 0xE0000000, 0xFFFFFFFF } // 224.0.0.0/3
+};
+
+// Every address is compared against every range at once, which is cheaper than the
+// per-octet switch and hash lookups for the handful of networks involved. A range
+// matches when the unsigned offset from its start does not exceed its length; SSE2
+// only has signed compares, so both sides are biased by the sign bit.
+class BatchClassifier
+{
+private:
+	static const uint32_t BIAS = 0x80000000;
+#if defined(BATCH_CLASSIFIER_AVX2)
+	static const size_t LANES = 8;
+#elif defined(BATCH_CLASSIFIER_SSE2)
+	static const size_t LANES = 4;
+#else
+	static const size_t LANES = 1;
+#endif
+
+	// Constants are stored broadcast to a full vector, special ranges come first
+	uint32_t starts[BATCH_CLASSIFIER_RANGES][LANES];
+	uint32_t lengths[BATCH_CLASSIFIER_RANGES][LANES]; // end - start, biased
+	uint32_t addresses[BATCH_CLASSIFIER_ADDRESSES][LANES];
+	std::atomic<size_t> range_count;
+	size_t special_count;
+	std::atomic<size_t> address_count;
+
+	bool AddRange(const CIDRRange &range)
+	{
+		size_t count = range_count.load(std::memory_order_relaxed);
+		if (count == BATCH_CLASSIFIER_RANGES)
+		{
+			return false;
+		}
+		for (size_t lane = 0; lane < LANES; lane++)
+		{
+			starts[count][lane] = range.start;
+			lengths[count][lane] = (range.end - range.start) ^ BIAS;
+		}
+		range_count.store(count + 1, std::memory_order_release);
+		return true;
+	}
+
+	AddressClass ClassifyOne(uint32_t addr, size_t ranges, size_t known_addresses) const
+	{
+		for (size_t r = 0; r < special_count; r++)
+		{
+			if (addr - starts[r][0] <= (lengths[r][0] ^ BIAS))
+			{
+				return AddressClass::Special;
+			}
+		}
+		for (size_t r = special_count; r < ranges; r++)
+		{
+			if (addr - starts[r][0] <= (lengths[r][0] ^ BIAS))
+			{
+				return AddressClass::Whitelisted;
+			}
+		}
+		for (size_t a = 0; a < known_addresses; a++)
+		{
+			if (addr == addresses[a][0])
+			{
+				return AddressClass::Whitelisted;
+			}
+		}
+		return AddressClass::Inspect;
+	}
+
+public:
+	BatchClassifier() : range_count(0), address_count(0)
+	{
+		static_assert((int)AddressClass::Special == 1 && (int)AddressClass::Whitelisted == 2, "Classify packs the masks into these values");
+		for (size_t i = 0; i < sizeof(special_ranges) / sizeof(special_ranges[0]); i++)
+		{
+			AddRange(special_ranges[i]);
+		}
+		special_count = range_count.load(std::memory_order_relaxed);
+	}
+
+	// Replaces the whitelist ranges, returns false if they do not all fit.
+	// Not synchronized with Classify, called before capture starts.
+	bool SetWhitelistRanges(const CIDRRange *ranges, size_t count)
+	{
+		range_count.store(special_count, std::memory_order_relaxed);
+		if (count > BATCH_CLASSIFIER_RANGES - special_count)
+		{
+			return false;
+		}
+		for (size_t i = 0; i < count; i++)
+		{
+			AddRange(ranges[i]);
+		}
+		return true;
+	}
+
+	// Safe while other threads classify batches: the whitelist ranges are no longer
+	// checked, but the entries stay intact for classifications still reading them.
+	void DropWhitelistRanges()
+	{
+		range_count.store(special_count, std::memory_order_release);
+	}
+
+	// Safe while other threads classify batches. Returns false when the table is full,
+	// such addresses have to be checked by the caller.
+	bool AddWhitelistAddress(uint32_t addr)
+	{
+		size_t count = address_count.load(std::memory_order_relaxed);
+		for (size_t i = 0; i < count; i++)
+		{
+			if (addresses[i][0] == addr)
+			{
+				return true;
+			}
+		}
+		if (count == BATCH_CLASSIFIER_ADDRESSES)
+		{
+			return false;
+		}
+		for (size_t lane = 0; lane < LANES; lane++)
+		{
+			addresses[count][lane] = addr;
+		}
+		address_count.store(count + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Writes one class per address. Reserved networks take precedence over whitelists.
+	void Classify(const uint32_t *addrs, size_t count, AddressClass *classes) const
+	{
+		size_t ranges = range_count.load(std::memory_order_acquire);
+		size_t known_addresses = address_count.load(std::memory_order_acquire);
+		size_t i = 0;
+#if defined(BATCH_CLASSIFIER_AVX2)
+		const __m256i bias = _mm256_set1_epi32((int)BIAS);
+		for (; i + 8 <= count; i += 8)
+		{
+			__m256i values = _mm256_loadu_si256((const __m256i*)(addrs + i));
+			__m256i special_outside = _mm256_set1_epi32(-1); // cleared in lanes inside of a range
+			__m256i whitelist_outside = _mm256_set1_epi32(-1);
+			for (size_t r = 0; r < special_count; r++)
+			{
+				__m256i offset = _mm256_xor_si256(_mm256_sub_epi32(values, _mm256_loadu_si256((const __m256i*)starts[r])), bias);
+				special_outside = _mm256_and_si256(special_outside, _mm256_cmpgt_epi32(offset, _mm256_loadu_si256((const __m256i*)lengths[r])));
+			}
+			for (size_t r = special_count; r < ranges; r++)
+			{
+				__m256i offset = _mm256_xor_si256(_mm256_sub_epi32(values, _mm256_loadu_si256((const __m256i*)starts[r])), bias);
+				whitelist_outside = _mm256_and_si256(whitelist_outside, _mm256_cmpgt_epi32(offset, _mm256_loadu_si256((const __m256i*)lengths[r])));
+			}
+			for (size_t a = 0; a < known_addresses; a++)
+			{
+				whitelist_outside = _mm256_andnot_si256(_mm256_cmpeq_epi32(values, _mm256_loadu_si256((const __m256i*)addresses[a])), whitelist_outside);
+			}
+
+			// 1 for special, else 2 for whitelisted, narrowed to one byte per lane
+			__m256i result = _mm256_andnot_si256(special_outside, _mm256_set1_epi32(1));
+			result = _mm256_or_si256(result, _mm256_and_si256(special_outside, _mm256_andnot_si256(whitelist_outside, _mm256_set1_epi32(2))));
+			__m128i packed = _mm_packs_epi32(_mm256_castsi256_si128(result), _mm256_extracti128_si256(result, 1));
+			_mm_storel_epi64((__m128i*)(classes + i), _mm_packus_epi16(packed, packed));
+		}
+#elif defined(BATCH_CLASSIFIER_SSE2)
+		const __m128i bias = _mm_set1_epi32((int)BIAS);
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128i values = _mm_loadu_si128((const __m128i*)(addrs + i));
+			__m128i special_outside = _mm_set1_epi32(-1); // cleared in lanes inside of a range
+			__m128i whitelist_outside = _mm_set1_epi32(-1);
+			for (size_t r = 0; r < special_count; r++)
+			{
+				__m128i offset = _mm_xor_si128(_mm_sub_epi32(values, _mm_loadu_si128((const __m128i*)starts[r])), bias);
+				special_outside = _mm_and_si128(special_outside, _mm_cmpgt_epi32(offset, _mm_loadu_si128((const __m128i*)lengths[r])));
+			}
+			for (size_t r = special_count; r < ranges; r++)
+			{
+				__m128i offset = _mm_xor_si128(_mm_sub_epi32(values, _mm_loadu_si128((const __m128i*)starts[r])), bias);
+				whitelist_outside = _mm_and_si128(whitelist_outside, _mm_cmpgt_epi32(offset, _mm_loadu_si128((const __m128i*)lengths[r])));
+			}
+			for (size_t a = 0; a < known_addresses; a++)
+			{
+				whitelist_outside = _mm_andnot_si128(_mm_cmpeq_epi32(values, _mm_loadu_si128((const __m128i*)addresses[a])), whitelist_outside);
+			}
+
+			// 1 for special, else 2 for whitelisted, narrowed to one byte per lane
+			__m128i result = _mm_andnot_si128(special_outside, _mm_set1_epi32(1));
+			result = _mm_or_si128(result, _mm_and_si128(special_outside, _mm_andnot_si128(whitelist_outside, _mm_set1_epi32(2))));
+			__m128i packed = _mm_packs_epi32(result, result);
+			*(int32_t*)(classes + i) = _mm_cvtsi128_si32(_mm_packus_epi16(packed, packed));
+		}
+#endif
+		for (; i < count; i++)
+		{
+			classes[i] = ClassifyOne(addrs[i], ranges, known_addresses);
+		}
+	}
+};
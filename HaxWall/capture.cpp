@@ -0,0 +1,447 @@
+// Capture engine: one raw socket and receive thread per interface, driven by an I/O completion port
+
+#include "stdafx.h"
+#include "capture.h"
+#include <iostream>
+
+#pragma comment(lib, "Ws2_32.lib")
+
+#ifndef STATUS_BUFFER_OVERFLOW
+#define STATUS_BUFFER_OVERFLOW ((DWORD)0x80000005L) // datagram was truncated to the receive buffer
+#endif
+
+#define CAPTURE_STOP_KEY 1 // completion key posted to wake up the receive threads on shutdown
+
+CaptureEngine::CaptureEngine(PacketBatchHandler batchHandler, PacketBatchHandler6 batchHandler6)
+	: handler(batchHandler), handler6(batchHandler6), stopping(false), active(0), rio_loaded(false)
+{
+	ZeroMemory(&rio, sizeof(rio));
+}
+
+CaptureEngine::~CaptureEngine()
+{
+	Stop();
+}
+
+SOCKET CaptureEngine::OpenSocket(const sockaddr *bind_addr, int bind_len, DWORD flags)
+{
+	// SIO_RCVALL needs IPPROTO_IPV6 on IPv6 sockets, the IPv6 header is delivered as well
+	int family = bind_addr->sa_family;
+	SOCKET sock = WSASocket(family, SOCK_RAW, family == AF_INET6 ? IPPROTO_IPV6 : IPPROTO_IP, NULL, 0, flags);
+	if (sock == INVALID_SOCKET)
+	{
+		std::cerr << "Failed to create socket: " << WSAGetLastError() << std::endl;
+		return INVALID_SOCKET;
+	}
+	if (bind(sock, bind_addr, bind_len) != 0)
+	{
+		std::cerr << "Failed to bind socket: " << WSAGetLastError() << std::endl;
+		closesocket(sock);
+		return INVALID_SOCKET;
+	}
+	DWORD ret;
+#ifdef CAPTURE_SOCKET_LEVEL_ONLY
+	unsigned int level = RCVALL_SOCKETLEVELONLY;
+	if (WSAIoctl(sock, SIO_RCVALL, &level, sizeof(level), 0, 0, &ret, 0, 0) == 0)
+	{
+		return sock;
+	}
+	std::cerr << "Socket level capture unavailable (" << WSAGetLastError() << "), capturing at IP level." << std::endl;
+#endif
+	unsigned int opt = RCVALL_IPLEVEL;
+	if (WSAIoctl(sock, SIO_RCVALL, &opt, sizeof(opt), 0, 0, &ret, 0, 0) != 0)
+	{
+		std::cerr << "Failed to enable promiscuous mode: " << WSAGetLastError() << std::endl;
+		closesocket(sock);
+		return INVALID_SOCKET;
+	}
+	return sock;
+}
+
+bool CaptureEngine::AddInterface(const SOCKADDR_IN &bind_addr)
+{
+	return AddInterface((const sockaddr*)&bind_addr, sizeof(bind_addr));
+}
+
+bool CaptureEngine::AddInterface(const SOCKADDR_IN6 &bind_addr)
+{
+	if (handler6 == NULL)
+	{
+		return false;
+	}
+	return AddInterface((const sockaddr*)&bind_addr, sizeof(bind_addr));
+}
+
+bool CaptureEngine::AddInterface(const sockaddr *bind_addr, int bind_len)
+{
+#ifdef CAPTURE_REGISTERED_IO
+	if (AddRegisteredInterface(bind_addr, bind_len))
+	{
+		return true;
+	}
+	std::cerr << "Registered I/O unavailable, using overlapped receives." << std::endl;
+#endif
+
+	SOCKET sock = OpenSocket(bind_addr, bind_len, WSA_FLAG_OVERLAPPED);
+	if (sock == INVALID_SOCKET)
+	{
+		return false;
+	}
+
+	HANDLE port = CreateIoCompletionPort((HANDLE)sock, NULL, 0, 1);
+	if (port == NULL)
+	{
+		std::cerr << "Failed to create completion port: " << GetLastError() << std::endl;
+		closesocket(sock);
+		return false;
+	}
+
+	interfaces.emplace_back();
+	Interface &iface = interfaces.back();
+	iface.sock = sock;
+	iface.family = bind_addr->sa_family;
+	iface.port = port;
+	iface.receives.resize(CAPTURE_OUTSTANDING_RECEIVES);
+	iface.pending = 0;
+	iface.registered = false;
+
+	for (auto it = iface.receives.begin(); it != iface.receives.end(); it++)
+	{
+		PostReceive(iface, *it);
+	}
+	if (iface.pending == 0)
+	{
+		std::cerr << "Failed to receive on socket: " << WSAGetLastError() << std::endl;
+		closesocket(sock);
+		CloseHandle(port);
+		interfaces.pop_back();
+		return false;
+	}
+
+	active++;
+	iface.thread = std::thread(&CaptureEngine::Run, this, std::ref(iface));
+	return true;
+}
+
+bool CaptureEngine::PostReceive(Interface &iface, Receive &receive)
+{
+	ZeroMemory(&receive.overlapped, sizeof(receive.overlapped));
+	receive.buffer.buf = (char*)receive.data;
+	receive.buffer.len = sizeof(receive.data);
+	receive.flags = 0;
+
+	if (WSARecv(iface.sock, &receive.buffer, 1, NULL, &receive.flags, &receive.overlapped, NULL) == SOCKET_ERROR)
+	{
+		int error = WSAGetLastError();
+		if (error != WSA_IO_PENDING && error != WSAEMSGSIZE) // Truncated datagrams still complete through the port
+		{
+			return false;
+		}
+	}
+	iface.pending++;
+	return true;
+}
+
+bool CaptureEngine::ParseInto(const Interface &iface, const unsigned char *data, size_t bytes, CapturedPacket *batch, CapturedPacket6 *batch6, size_t count)
+{
+	if (iface.family == AF_INET6)
+	{
+		return ParsePacket6(data, bytes, batch6[count]);
+	}
+	return ParsePacket(data, bytes, batch[count]);
+}
+
+void CaptureEngine::Deliver(const Interface &iface, const CapturedPacket *batch, const CapturedPacket6 *batch6, size_t count)
+{
+	if (iface.family == AF_INET6)
+	{
+		handler6(batch6, count);
+	}
+	else
+	{
+		handler(batch, count);
+	}
+}
+
+void CaptureEngine::Run(Interface &iface)
+{
+	OVERLAPPED_ENTRY entries[CAPTURE_BATCH_SIZE];
+	CapturedPacket batch[CAPTURE_BATCH_SIZE];
+	CapturedPacket6 batch6[CAPTURE_BATCH_SIZE];
+
+	while (iface.pending > 0)
+	{
+		ULONG removed = 0;
+		if (!GetQueuedCompletionStatusEx(iface.port, entries, CAPTURE_BATCH_SIZE, &removed, INFINITE, FALSE))
+		{
+			std::cerr << "Error: Completion port failed. " << GetLastError() << std::endl;
+			break;
+		}
+
+		size_t count = 0;
+		ULONG received = 0;
+		for (ULONG i = 0; i < removed; i++)
+		{
+			if (entries[i].lpCompletionKey == CAPTURE_STOP_KEY)
+			{
+				// Cancelled on this thread, so no receive can be posted after the cancellation.
+				// The cancelled receives complete through the port and are not posted again.
+				CancelIoEx((HANDLE)iface.sock, NULL);
+				continue;
+			}
+			received++;
+
+			Receive *receive = CONTAINING_RECORD(entries[i].lpOverlapped, Receive, overlapped);
+			DWORD status = (DWORD)receive->overlapped.Internal;
+			iface.pending--;
+
+			if ((status == 0 || status == STATUS_BUFFER_OVERFLOW)
+				&& ParseInto(iface, receive->data, entries[i].dwNumberOfBytesTransferred, batch, batch6, count))
+			{
+				count++;
+			}
+
+			if (!stopping && !PostReceive(iface, *receive))
+			{
+				std::cerr << "An error occured." << std::endl;
+			}
+		}
+		GlobalStatistics().Add(Stat::PacketsReceived, received);
+
+		if (count > 0 && !stopping)
+		{
+			Deliver(iface, batch, batch6, count);
+		}
+	}
+	active--;
+}
+
+bool CaptureEngine::AddRegisteredInterface(const sockaddr *bind_addr, int bind_len)
+{
+	SOCKET sock = OpenSocket(bind_addr, bind_len, WSA_FLAG_REGISTERED_IO);
+	if (sock == INVALID_SOCKET)
+	{
+		return false;
+	}
+
+	if (!rio_loaded)
+	{
+		GUID functionTableId = WSAID_MULTIPLE_RIO;
+		DWORD bytes = 0;
+		if (WSAIoctl(sock, SIO_GET_MULTIPLE_EXTENSION_FUNCTION_POINTER, &functionTableId, sizeof(functionTableId),
+			&rio, sizeof(rio), &bytes, NULL, NULL) != 0)
+		{
+			closesocket(sock);
+			return false;
+		}
+		rio_loaded = true;
+	}
+
+	HANDLE port = CreateIoCompletionPort(INVALID_HANDLE_VALUE, NULL, 0, 1);
+	if (port == NULL)
+	{
+		closesocket(sock);
+		return false;
+	}
+
+	interfaces.emplace_back();
+	Interface &iface = interfaces.back();
+	iface.sock = sock;
+	iface.family = bind_addr->sa_family;
+	iface.port = port;
+	iface.pending = 0;
+	iface.registered = true;
+	iface.completions = RIO_INVALID_CQ;
+	iface.requests = RIO_INVALID_RQ;
+	iface.buffer_id = RIO_INVALID_BUFFERID;
+	iface.slots = NULL;
+	ZeroMemory(&iface.notification, sizeof(iface.notification));
+
+	// All receive slots share one page-aligned registered buffer
+	DWORD size = CAPTURE_OUTSTANDING_RECEIVES * CAPTURE_BUFFER_SIZE;
+	iface.slots = (unsigned char*)VirtualAlloc(NULL, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+	if (iface.slots != NULL)
+	{
+		iface.buffer_id = rio.RIORegisterBuffer((PCHAR)iface.slots, size);
+	}
+
+	RIO_NOTIFICATION_COMPLETION notify = { RIO_IOCP_COMPLETION };
+	notify.Iocp.IocpHandle = port;
+	notify.Iocp.CompletionKey = NULL;
+	notify.Iocp.Overlapped = &iface.notification;
+	if (iface.buffer_id != RIO_INVALID_BUFFERID)
+	{
+		iface.completions = rio.RIOCreateCompletionQueue(CAPTURE_OUTSTANDING_RECEIVES + 1, &notify);
+	}
+	if (iface.completions != RIO_INVALID_CQ)
+	{
+		iface.requests = rio.RIOCreateRequestQueue(sock, CAPTURE_OUTSTANDING_RECEIVES, 1, 1, 1,
+			iface.completions, iface.completions, NULL);
+	}
+	if (iface.requests == RIO_INVALID_RQ)
+	{
+		CloseRegistered(iface);
+		interfaces.pop_back();
+		return false;
+	}
+
+	for (ULONG slot = 0; slot < CAPTURE_OUTSTANDING_RECEIVES; slot++)
+	{
+		PostRegisteredReceive(iface, slot, RIO_MSG_DEFER);
+	}
+	if (iface.pending == 0 || !rio.RIOReceive(iface.requests, NULL, 0, RIO_MSG_COMMIT_ONLY, NULL)
+		|| rio.RIONotify(iface.completions) != ERROR_SUCCESS)
+	{
+		CloseRegistered(iface);
+		interfaces.pop_back();
+		return false;
+	}
+
+	active++;
+	iface.thread = std::thread(&CaptureEngine::RunRegistered, this, std::ref(iface));
+	return true;
+}
+
+bool CaptureEngine::PostRegisteredReceive(Interface &iface, ULONG slot, DWORD flags)
+{
+	RIO_BUF buffer;
+	buffer.BufferId = iface.buffer_id;
+	buffer.Offset = slot * CAPTURE_BUFFER_SIZE;
+	buffer.Length = CAPTURE_BUFFER_SIZE;
+
+	if (!rio.RIOReceive(iface.requests, &buffer, 1, flags, (PVOID)(ULONG_PTR)slot))
+	{
+		return false;
+	}
+	iface.pending++;
+	return true;
+}
+
+void CaptureEngine::RunRegistered(Interface &iface)
+{
+	RIORESULT results[CAPTURE_BATCH_SIZE];
+	CapturedPacket batch[CAPTURE_BATCH_SIZE];
+	CapturedPacket6 batch6[CAPTURE_BATCH_SIZE];
+
+	while (iface.pending > 0)
+	{
+		DWORD bytes = 0;
+		ULONG_PTR key = 0;
+		LPOVERLAPPED overlapped = NULL;
+		if (!GetQueuedCompletionStatus(iface.port, &bytes, &key, &overlapped, INFINITE) || key == CAPTURE_STOP_KEY)
+		{
+			break;
+		}
+
+		// Drain everything that completed before asking for the next notification
+		ULONG removed;
+		while ((removed = rio.RIODequeueCompletion(iface.completions, results, CAPTURE_BATCH_SIZE)) > 0
+			&& removed != RIO_CORRUPT_CQ)
+		{
+			GlobalStatistics().Add(Stat::PacketsReceived, removed);
+			size_t count = 0;
+			for (ULONG i = 0; i < removed; i++)
+			{
+				ULONG slot = (ULONG)results[i].RequestContext;
+				iface.pending--;
+
+				// Parse in place, the registered buffer is never copied
+				if ((results[i].Status == 0 || results[i].Status == WSAEMSGSIZE)
+					&& ParseInto(iface, iface.slots + slot * CAPTURE_BUFFER_SIZE, results[i].BytesTransferred, batch, batch6, count))
+				{
+					count++;
+				}
+
+				if (!stopping && !PostRegisteredReceive(iface, slot, RIO_MSG_DEFER))
+				{
+					std::cerr << "An error occured." << std::endl;
+				}
+			}
+			rio.RIOReceive(iface.requests, NULL, 0, RIO_MSG_COMMIT_ONLY, NULL);
+
+			if (count > 0 && !stopping)
+			{
+				Deliver(iface, batch, batch6, count);
+			}
+		}
+		if (removed == RIO_CORRUPT_CQ)
+		{
+			std::cerr << "Error: Registered I/O completion queue corrupted." << std::endl;
+			break;
+		}
+		if (rio.RIONotify(iface.completions) != ERROR_SUCCESS)
+		{
+			std::cerr << "Error: Registered I/O notification failed." << std::endl;
+			break;
+		}
+	}
+	active--;
+}
+
+void CaptureEngine::CloseRegistered(Interface &iface)
+{
+	if (iface.sock != INVALID_SOCKET)
+	{
+		closesocket(iface.sock);
+		iface.sock = INVALID_SOCKET;
+	}
+	if (iface.completions != RIO_INVALID_CQ)
+	{
+		rio.RIOCloseCompletionQueue(iface.completions);
+		iface.completions = RIO_INVALID_CQ;
+	}
+	if (iface.buffer_id != RIO_INVALID_BUFFERID)
+	{
+		rio.RIODeregisterBuffer(iface.buffer_id);
+		iface.buffer_id = RIO_INVALID_BUFFERID;
+	}
+	if (iface.slots != NULL)
+	{
+		VirtualFree(iface.slots, 0, MEM_RELEASE);
+		iface.slots = NULL;
+	}
+	CloseHandle(iface.port);
+	iface.port = NULL;
+}
+
+void CaptureEngine::Wait()
+{
+	for (auto it = interfaces.begin(); it != interfaces.end(); it++)
+	{
+		if (it->thread.joinable())
+		{
+			it->thread.join();
+		}
+	}
+}
+
+bool CaptureEngine::Running() const
+{
+	return active.load() > 0;
+}
+
+void CaptureEngine::Stop()
+{
+	stopping = true;
+
+	// Every receive thread is woken up through its port. Overlapped threads cancel their own receives
+	// and exit once those have drained, sockets and queues are only released after the threads stopped.
+	for (auto it = interfaces.begin(); it != interfaces.end(); it++)
+	{
+		PostQueuedCompletionStatus(it->port, 0, CAPTURE_STOP_KEY, NULL);
+	}
+	Wait();
+	for (auto it = interfaces.begin(); it != interfaces.end(); it++)
+	{
+		if (it->registered)
+		{
+			CloseRegistered(*it);
+		}
+		else
+		{
+			closesocket(it->sock);
+			CloseHandle(it->port);
+		}
+	}
+	interfaces.clear();
+}
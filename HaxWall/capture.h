@@ -0,0 +1,169 @@
+#pragma once
+// Capture engine: one raw socket and receive thread per interface, driven by an I/O completion port
+
+#include <Winsock2.h>
+#include <Ws2tcpip.h>
+#include <Mswsock.h>
+#include <Mstcpip.h>
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <thread>
+#include <vector>
+#include "cidr6.h"
+#include "packet_view.h"
+#include "stats.h"
+
+#define CAPTURE_OUTSTANDING_RECEIVES 64 // overlapped receives kept pending per interface
+#define CAPTURE_BUFFER_SIZE 128 // bytes per receive (IP header with options plus UDP header fit), only saves copying payloads, every packet still costs a completion
+#define CAPTURE_GAME_PORT_MIN 1024 // local ports of interest, lower ports are services like DNS
+#define CAPTURE_GAME_PORT_MAX 65535
+#define CAPTURE_BATCH_SIZE 64 // maximum number of completions dequeued per wakeup
+
+//#define CAPTURE_REGISTERED_IO // uncomment to receive through Winsock Registered I/O where available
+//#define CAPTURE_SOCKET_LEVEL_ONLY // uncomment to request RCVALL_SOCKETLEVELONLY, falls back to RCVALL_IPLEVEL where it is not implemented
+
+struct CapturedPacket
+{
+	uint32_t saddr;
+	uint16_t sport;
+	uint16_t dport;
+};
+
+struct CapturedPacket6
+{
+	IPv6Address saddr;
+	uint16_t sport;
+	uint16_t dport;
+};
+
+// Returns false for ports the firewall ignores
+inline bool FilterPorts(uint16_t sport, uint16_t dport)
+{
+#if CAPTURE_GAME_PORT_MAX < 65535
+	bool outside = dport < CAPTURE_GAME_PORT_MIN || dport > CAPTURE_GAME_PORT_MAX;
+#else
+	bool outside = dport < CAPTURE_GAME_PORT_MIN;
+#endif
+	if (sport < 1024 || outside || dport == 3389) // Allow incoming and outgoing low port services like DNS and do not ban RDP packets.
+	{
+		// The source port check actually decreases the effectiveness of the firewall.
+		// However, the usual skid will hardly be able to make it around this check.
+		GlobalStatistics().Add(Stat::FilteredPort);
+		return false;
+	}
+	return true;
+}
+
+// Counts packets without a usable UDP header
+inline bool AcceptParse(PacketParse result)
+{
+	if (result == PacketParse::Udp)
+	{
+		return true;
+	}
+	GlobalStatistics().Add(result == PacketParse::Fragment ? Stat::FilteredFragment : Stat::FilteredProtocol);
+	return false;
+}
+
+// Extracts the UDP source of a raw IPv4 packet. Returns false for packets the firewall ignores.
+inline bool ParsePacket(const unsigned char *data, size_t count, CapturedPacket &packet)
+{
+	Ipv4View ip = { data, count };
+	UdpView udp;
+	if (!AcceptParse(ip.Udp(udp)))
+	{
+		return false;
+	}
+	packet.saddr = ip.Source();
+	packet.sport = udp.SourcePort();
+	packet.dport = udp.DestinationPort();
+	return FilterPorts(packet.sport, packet.dport);
+}
+
+// Same as ParsePacket for a raw IPv6 packet
+inline bool ParsePacket6(const unsigned char *data, size_t count, CapturedPacket6 &packet)
+{
+	Ipv6View ip = { data, count };
+	UdpView udp;
+	if (!AcceptParse(ip.Udp(udp)))
+	{
+		return false;
+	}
+	packet.saddr = IPv6FromBytes(ip.Source());
+	packet.sport = udp.SourcePort();
+	packet.dport = udp.DestinationPort();
+	return FilterPorts(packet.sport, packet.dport);
+}
+
+// Called from the receive threads with every batch of parsed packets
+typedef void(*PacketBatchHandler)(const CapturedPacket *packets, size_t count);
+typedef void(*PacketBatchHandler6)(const CapturedPacket6 *packets, size_t count);
+
+class CaptureEngine
+{
+private:
+	struct Receive
+	{
+		WSAOVERLAPPED overlapped;
+		WSABUF buffer;
+		DWORD flags;
+		unsigned char data[CAPTURE_BUFFER_SIZE];
+	};
+
+	struct Interface
+	{
+		SOCKET sock;
+		int family; // AF_INET or AF_INET6
+		HANDLE port;
+		std::vector<Receive> receives;
+		size_t pending;
+		std::thread thread;
+
+		// Registered I/O state, the receive slots live in one registered buffer
+		bool registered;
+		RIO_CQ completions;
+		RIO_RQ requests;
+		RIO_BUFFERID buffer_id;
+		unsigned char *slots;
+		OVERLAPPED notification;
+	};
+
+	PacketBatchHandler handler;
+	PacketBatchHandler6 handler6;
+	std::list<Interface> interfaces;
+	std::atomic<bool> stopping;
+	std::atomic<size_t> active; // receive threads that have not returned yet
+	RIO_EXTENSION_FUNCTION_TABLE rio;
+	bool rio_loaded;
+
+	SOCKET OpenSocket(const sockaddr *bind_addr, int bind_len, DWORD flags);
+	bool AddInterface(const sockaddr *bind_addr, int bind_len);
+	bool PostReceive(Interface &iface, Receive &receive);
+	void Run(Interface &iface);
+
+	bool AddRegisteredInterface(const sockaddr *bind_addr, int bind_len);
+
+	// Parses a received packet into slot count of the batch of its family
+	bool ParseInto(const Interface &iface, const unsigned char *data, size_t bytes, CapturedPacket *batch, CapturedPacket6 *batch6, size_t count);
+	void Deliver(const Interface &iface, const CapturedPacket *batch, const CapturedPacket6 *batch6, size_t count);
+	bool PostRegisteredReceive(Interface &iface, ULONG slot, DWORD flags);
+	void RunRegistered(Interface &iface);
+	void CloseRegistered(Interface &iface);
+
+public:
+	CaptureEngine(PacketBatchHandler batchHandler, PacketBatchHandler6 batchHandler6 = NULL);
+	~CaptureEngine();
+
+	// Binds a raw socket to the interface address, enables SIO_RCVALL and starts its receive thread
+	bool AddInterface(const SOCKADDR_IN &bind_addr);
+	bool AddInterface(const SOCKADDR_IN6 &bind_addr);
+
+	// Blocks until every receive thread has terminated
+	void Wait();
+
+	// False once every receive thread has terminated, e.g. because all of them failed
+	bool Running() const;
+
+	void Stop();
+};
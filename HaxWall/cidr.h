@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+typedef struct CIDR_S
+{
+	uint32_t network;
+	uint8_t prefix;
+	
+	bool operator==(const CIDR_S &other) const
+	{
+		return network == other.network && prefix == other.prefix;
+	}
+} CIDR;
+
+namespace std
+{
+	template <> struct hash<CIDR_S>
+	{
+		std::size_t operator()(const CIDR_S& k) const
+		{
+			return (hash<uint32_t>()(k.network)) ^ (hash<uint8_t>()(k.prefix));
+		}
+	};
+}
+
+// Inclusive address range [start, end] covering one or more merged networks
+typedef struct CIDR_RANGE_S
+{
+	uint32_t start;
+	uint32_t end;
+} CIDRRange;
+
+constexpr uint32_t CIDRHostMask(uint8_t prefix)
+{
+	return prefix >= 32 ? 0 : (0xFFFFFFFF >> prefix);
+}
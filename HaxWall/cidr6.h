@@ -0,0 +1,172 @@
+#pragma once
+// IPv6 addresses, networks and the range matcher for IPv6 lists
+
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+// Host order halves, high holds the first 8 bytes on the wire
+typedef struct IPV6_ADDRESS_S
+{
+	uint64_t high;
+	uint64_t low;
+
+	bool operator==(const IPV6_ADDRESS_S &other) const
+	{
+		return high == other.high && low == other.low;
+	}
+
+	bool operator<(const IPV6_ADDRESS_S &other) const
+	{
+		return high < other.high || (high == other.high && low < other.low);
+	}
+
+	bool operator<=(const IPV6_ADDRESS_S &other) const
+	{
+		return !(other < *this);
+	}
+} IPv6Address;
+
+typedef struct CIDR6_S
+{
+	IPv6Address network;
+	uint8_t prefix;
+
+	bool operator==(const CIDR6_S &other) const
+	{
+		return network == other.network && prefix == other.prefix;
+	}
+} CIDR6;
+
+namespace std
+{
+	template <> struct hash<CIDR6_S>
+	{
+		std::size_t operator()(const CIDR6_S& k) const
+		{
+			return hash<uint64_t>()(k.network.high) ^ hash<uint64_t>()(k.network.low) ^ hash<uint8_t>()(k.prefix);
+		}
+	};
+}
+
+// Inclusive address range [start, end] covering one or more merged networks
+typedef struct CIDR6_RANGE_S
+{
+	IPv6Address start;
+	IPv6Address end;
+} CIDR6Range;
+
+constexpr uint64_t CIDR6HostMask(int prefix)
+{
+	return prefix <= 0 ? 0xFFFFFFFFFFFFFFFFULL : prefix >= 64 ? 0 : (0xFFFFFFFFFFFFFFFFULL >> prefix);
+}
+
+// Host bits of the network, set in end and cleared in start
+inline IPv6Address IPv6HostBits(uint8_t prefix)
+{
+	return IPv6Address{ CIDR6HostMask(prefix), CIDR6HostMask(prefix - 64) };
+}
+
+inline IPv6Address IPv6FromBytes(const unsigned char *bytes)
+{
+	IPv6Address addr = { 0, 0 };
+	for (int i = 0; i < 8; i++)
+	{
+		addr.high = addr.high << 8 | bytes[i];
+		addr.low = addr.low << 8 | bytes[i + 8];
+	}
+	return addr;
+}
+
+inline void IPv6ToBytes(const IPv6Address &addr, unsigned char *bytes)
+{
+	for (int i = 0; i < 8; i++)
+	{
+		bytes[i] = (unsigned char)(addr.high >> (56 - 8 * i));
+		bytes[i + 8] = (unsigned char)(addr.low >> (56 - 8 * i));
+	}
+}
+
+// Range matcher built at runtime from an IPv6 CIDR list, searched like CIDRRangeMatcher
+class CIDR6RangeSet
+{
+private:
+	std::vector<CIDR6Range> ranges;
+
+	static bool Follows(const IPv6Address &end, const IPv6Address &start)
+	{
+		// start <= end + 1 without overflowing end
+		return start <= end || (end.low == 0xFFFFFFFFFFFFFFFFULL ? start.high == end.high + 1 && start.low == 0 :
+			start.high == end.high && start.low == end.low + 1);
+	}
+
+public:
+	CIDR6RangeSet(const CIDR6 *networks, size_t size)
+	{
+		ranges.reserve(size);
+		for (size_t i = 0; i < size; i++)
+		{
+			if (networks[i].prefix > 128)
+			{
+				continue;
+			}
+			IPv6Address host = IPv6HostBits(networks[i].prefix);
+			if ((networks[i].network.high & host.high) != 0 || (networks[i].network.low & host.low) != 0)
+			{
+				// Same rule as CIDRRangeSet, networks with host bits set never match
+				continue;
+			}
+			IPv6Address end = { networks[i].network.high | host.high, networks[i].network.low | host.low };
+			ranges.push_back(CIDR6Range{ networks[i].network, end });
+		}
+
+		std::sort(ranges.begin(), ranges.end(), [](const CIDR6Range &a, const CIDR6Range &b)
+		{
+			return a.start < b.start;
+		});
+
+		// Merge overlapping and adjacent ranges
+		size_t merged = 0;
+		for (size_t i = 0; i < ranges.size(); i++)
+		{
+			if (merged != 0 && Follows(ranges[merged - 1].end, ranges[i].start))
+			{
+				ranges[merged - 1].end = std::max(ranges[merged - 1].end, ranges[i].end);
+				continue;
+			}
+			ranges[merged++] = ranges[i];
+		}
+		ranges.resize(merged);
+		ranges.shrink_to_fit();
+	}
+
+	CIDR6RangeSet(const CIDR6RangeSet&) = delete;
+	CIDR6RangeSet& operator=(const CIDR6RangeSet&) = delete;
+
+	bool Contains(const IPv6Address &address) const
+	{
+		size_t remaining = ranges.size();
+		if (remaining == 0)
+		{
+			return false;
+		}
+
+		// Find the last range starting at or below the address
+		const CIDR6Range *base = ranges.data();
+		while (remaining > 1)
+		{
+			size_t half = remaining / 2;
+			base = (base[half].start <= address) ? base + half : base;
+			remaining -= half;
+		}
+		return base->start <= address && address <= base->end;
+	}
+
+	size_t Size() const
+	{
+		return ranges.size();
+	}
+};
+
+typedef CIDR6RangeSet CIDR6Matcher;
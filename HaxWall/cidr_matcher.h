@@ -1,38 +1,19 @@
+#pragma once
+
 #include <cstdint>
+#include <algorithm>
 #include <unordered_set>
+#include <vector>
+#include "cidr.h"
 
-typedef struct CIDR_S
-{
-	uint32_t network;
-	uint8_t prefix;
-	
-	bool operator==(const CIDR_S &other) const
-	{
-		return network == other.network && prefix == other.prefix;
-	}
-} CIDR;
-
-namespace std
-{
-	template <> struct hash<CIDR_S>
-	{
-		std::size_t operator()(const CIDR_S& k) const
-		{
-			return (hash<uint32_t>()(k.network)) ^ (hash<uint8_t>()(k.prefix));
-		}
-	};
-}
-
-
-#include "data_centers.h"
-
-class CIDRMatcher
+// Original engine: probes the hash set once per possible prefix length (33 lookups on a miss)
+class CIDRHashMatcher
 {
 private:
 	std::unordered_set<CIDR> cidrs;
 
 public:
-	CIDRMatcher(CIDR* networks, int count)
+	CIDRHashMatcher(const CIDR* networks, int count)
 	{
 		cidrs.reserve(count);
 		for(int i = 0; i < count; i++)
@@ -41,7 +22,7 @@ public:
 		}
 	}
 
-	bool Contains(uint32_t address)
+	bool Contains(uint32_t address) const
 	{
 		CIDR cidr;
 		cidr.network = address;
@@ -64,4 +45,161 @@ public:
 	}
 };
 
-CIDRMatcher DataCenters(data_centers, sizeof(data_centers) / sizeof(data_centers[0]));
+constexpr CIDRRange CIDRToRange(const CIDR &cidr)
+{
+	return CIDRRange{ cidr.network, cidr.network | CIDRHostMask(cidr.prefix) };
+}
+
+// Compile-time check for hand-written range tables (keep them small, this recurses once per entry)
+template <size_t N>
+constexpr bool IsRangeTable(const CIDRRange (&table)[N], size_t i = 0)
+{
+	return i >= N || (table[i].start <= table[i].end
+		&& (i == 0 || table[i - 1].end < table[i].start)
+		&& IsRangeTable(table, i + 1));
+}
+
+// Sorted and non-overlapping ranges searched by a branchless binary search.
+// The matcher does not own the ranges, constant tables are used in place.
+class CIDRRangeMatcher
+{
+protected:
+	const CIDRRange *ranges;
+	size_t count;
+
+public:
+	constexpr CIDRRangeMatcher(const CIDRRange *table, size_t size) : ranges(table), count(size)
+	{
+	}
+
+	template <size_t N>
+	constexpr CIDRRangeMatcher(const CIDRRange (&table)[N]) : ranges(table), count(N)
+	{
+	}
+
+	bool Contains(uint32_t address) const
+	{
+		size_t remaining = count;
+		if (remaining == 0)
+		{
+			return false;
+		}
+
+		// Find the last range starting at or below the address
+		const CIDRRange *base = ranges;
+		while (remaining > 1)
+		{
+			size_t half = remaining / 2;
+			base = (base[half].start <= address) ? base + half : base;
+			remaining -= half;
+		}
+		return base->start <= address && address <= base->end;
+	}
+
+	size_t Size() const
+	{
+		return count;
+	}
+
+	const CIDRRange *Ranges() const
+	{
+		return ranges;
+	}
+};
+
+// Ranges of table not covered by any range of exceptions, both sorted and non-overlapping
+inline std::vector<CIDRRange> SubtractRanges(const CIDRRangeMatcher &table, const CIDRRangeMatcher *exceptions)
+{
+	std::vector<CIDRRange> result;
+	result.reserve(table.Size());
+	const CIDRRange *cut = exceptions != NULL ? exceptions->Ranges() : NULL;
+	const CIDRRange *cut_end = exceptions != NULL ? cut + exceptions->Size() : NULL;
+	for (size_t i = 0; i < table.Size(); i++)
+	{
+		CIDRRange range = table.Ranges()[i];
+		while (cut != cut_end && cut->end < range.start)
+		{
+			cut++;
+		}
+
+		// Emit the pieces left of every exception overlapping this range
+		bool remaining = true;
+		for (const CIDRRange *it = cut; it != cut_end && it->start <= range.end; it++)
+		{
+			if (it->start > range.start)
+			{
+				result.push_back(CIDRRange{ range.start, it->start - 1 });
+			}
+			if (it->end >= range.end)
+			{
+				remaining = false;
+				break;
+			}
+			range.start = it->end + 1;
+		}
+		if (remaining)
+		{
+			result.push_back(range);
+		}
+	}
+	return result;
+}
+
+// Range matcher built at runtime from an arbitrary CIDR list
+class CIDRRangeSet : public CIDRRangeMatcher
+{
+private:
+	std::vector<CIDRRange> storage;
+
+public:
+	CIDRRangeSet(const CIDR* networks, int size) : CIDRRangeMatcher(NULL, 0)
+	{
+		storage.reserve(size);
+		for (int i = 0; i < size; i++)
+		{
+			if (networks[i].prefix > 32)
+			{
+				continue;
+			}
+			CIDRRange range = CIDRToRange(networks[i]);
+			if (range.start != networks[i].network)
+			{
+				// Networks with host bits set never matched the hash engine either
+				continue;
+			}
+			storage.push_back(range);
+		}
+
+		std::sort(storage.begin(), storage.end(), [](const CIDRRange &a, const CIDRRange &b)
+		{
+			return a.start < b.start;
+		});
+
+		// Merge overlapping and adjacent ranges
+		size_t merged = 0;
+		for (size_t i = 0; i < storage.size(); i++)
+		{
+			if (merged != 0 && (storage[merged - 1].end == 0xFFFFFFFF || storage[i].start <= storage[merged - 1].end + 1))
+			{
+				storage[merged - 1].end = std::max(storage[merged - 1].end, storage[i].end);
+				continue;
+			}
+			storage[merged++] = storage[i];
+		}
+		storage.resize(merged);
+		storage.shrink_to_fit();
+
+		ranges = storage.data();
+		count = storage.size();
+	}
+
+	CIDRRangeSet(const CIDRRangeSet&) = delete;
+	CIDRRangeSet& operator=(const CIDRRangeSet&) = delete;
+};
+
+typedef CIDRRangeMatcher CIDRMatcher;
+
+// Pre-merged table generated by scripts/generate_ranges.py, lives in read-only data
+#include "data_center_ranges.h"
+
+constexpr CIDRMatcher DataCenters(data_center_ranges);
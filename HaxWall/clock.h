@@ -0,0 +1,18 @@
+#pragma once
+// Monotonic clock for the firewall timers. Time is kept in integer milliseconds that are
+// unaffected by wall-clock changes; the firewall samples it once per receive batch.
+
+#include <chrono>
+#include <cstdint>
+
+typedef uint64_t tick_t;
+
+#define TICKS_PER_SECOND 1000
+#define SECONDS_TO_TICKS(seconds) ((tick_t)((seconds) * TICKS_PER_SECOND))
+
+inline tick_t MonotonicTicks()
+{
+	// steady_clock is backed by QueryPerformanceCounter on Windows
+	return (tick_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
@@ -0,0 +1,1683 @@
+// Generated by scripts/generate_ranges.py from data_centers.h. Do not edit.
+const CIDRRange data_center_ranges[] = {
+	{16777216,16777471},{16843008,16843263},{16909056,16909311},{16974592,16974847},{29949952,30015487},{34603008,35127295},{70633728,70633983},{72207616,72207871},
+	{72323328,72323583},{72328736,72328767},{83952128,83952639},{83969024,83969535},{83972864,83973119},{83974144,83974399},{83976192,83978239},{83982336,83984383},
+	{84414976,84415231},{84419584,84420095},{84420352,84420607},{84421632,84422655},{84475904,84541439},{84545536,84549631},{84557824,84574207},{84627456,84629503},
+	{85391360,85401599},{85405696,85407743},{85735424,85737471},{85770240,85786623},{86159360,86161407},{86175744,86177791},{86228992,86231039},{86237184,86245375},
+	{86441984,86474751},{86484992,86487039},{86489088,86491135},{86497280,86499327},{86773760,86777855},{86779904,86780159},{86781184,86781439},{86781696,86781951},
+	{86795264,86795775},{86796288,86797311},{86809088,86809343},{86824960,86827007},{86829056,86831103},{86840064,86840319},{86849536,86855679},{86856704,86858751},
+	{86859776,86867967},{86880256,86882303},{86884352,86900735},{87560192,87562239},{87564288,87564543},{87566080,87566335},{87590144,87590399},{87592960,87597055},
+	{87890688,87890943},{87891968,87896063},{87947264,87950847},{87951360,87958271},{87958528,87962623},{87963648,87965695},{87981568,87982079},{87988224,87990271},
+	{88051712,88053759},{88940544,88948735},{89022464,89023487},{89079808,89096191},{89325568,89327615},{89333760,89335807},{89336576,89336831},{89358336,89362431},
+	{89364224,89364991},{89365248,89365503},{89366528,89367039},{90515456,90515711},{90529792,90537983},{90540032,90544127},{90548224,90554367},{90560512,90562559},
+	{90607616,90609663},{90613760,90615807},{90617856,90619903},{90707968,90710015},{90728448,90730495},{90736640,90738687},{92569600,92585983},{92647424,92659711},
+	{92667904,92669951},{92696576,92698623},{92733440,92798975},{93431808,93433855},{93626368,93634559},{93693952,93695999},{93749248,93753343},{93765632,93782015},
+	{93892608,93893119},{93893376,93893631},{93896704,93904895},{93913088,93929471},{93970432,93974527},{94022144,94022655},{94025216,94025471},{94026240,94026751},
+	{94035968,94036479},{94038016,94038271},{94040832,94041087},{94175232,94191615},{94195712,94197759},{94294016,94296063},{94362112,94362623},{94363648,94366719},
+	{95354880,95363071},{95365120,95367167},{95387648,95420415},{95567872,95569919},{95571968,95574015},{95637504,95641599},{96141312,96143359},{96145408,96150271},
+	{96209664,96209919},{96222976,96223231},{96229120,96229375},{96230400,96231423},{96266240,96266495},{96305152,96321535},{96323584,96325631},{96731136,96796671},
+	{96925696,96927743},{96960512,96964607},{96968704,96972799},{96993280,97001471},{98566144,98697215},{98705408,98707455},{98740992,98741247},{98741504,98741759},
+	{98959360,99090431},{100237312,100247551},{100311040,100313087},{100532224,100536319},{100548352,100573183},{100597760,100622335},{100646912,100663295},{134348800,134349055},
+	{134379520,134380287},{134415616,134416383},{134421504,134422015},{134422528,134422783},{134488576,134489087},{134490112,134496255},{134545408,134545919},{134595584,134595839},
+	{134604544,134604799},{134611456,134611967},{134612992,134613503},{134614784,134615039},{134629888,134630911},{134660352,134660607},{134672384,134672895},{134736128,134736383},
+	{134738944,134739199},{134743040,134743295},{134744064,134744319},{134808320,134809343},{134809600,134810111},{134810368,134810623},{134811392,134812159},{134815232,134815743},
+	{134816768,134817279},{134875136,134875391},{134903808,134904063},{134914048,134914815},{135008256,135010303},{135020544,135021055},{135021568,135022591},{135045632,135046399},
+	{135156736,135157759},{135172352,135173119},{135252480,135252735},{135259904,135260159},{135361280,135361535},{135395584,135396607},{135420928,135421439},{135422464,135422975},
+	{135424000,135424255},{135425024,135425279},{135430144,135430399},{135432192,135434751},{135441408,135441663},{135442432,135446527},{135466496,135466751},{135488512,135489535},
+	{135511040,135512063},{135524352,135524607},{135556608,135556863},{135582976,135583231},{135590144,135590399},{135590656,135590911},{135604480,135604735},{135700736,135700991},
+	{135710720,135712767},{135716864,135717375},{135717888,135720703},{135733248,135737343},{135774208,135774719},{135774976,135775231},{135792640,135794687},{135847936,135852031},
+	{135854080,135856127},{135890944,135892991},{135908096,135908351},{135910912,135911167},{135926784,135927807},{135945728,135945983},{136148992,136155135},{136157184,136159231},
+	{136163328,136167423},{136175616,136175871},{136215552,136215807},{136224768,136226815},{136237056,136239103},{136282112,136282879},{136404992,136407039},{136413184,136415743},
+	{136421376,136425471},{136454656,136454911},{136499200,136503295},{136520448,136520703},{136560640,136564735},{136587264,136589311},{136699904,136703999},{136727552,136728575},
+	{136833536,136834047},{136901120,136901631},{136951808,136952063},{202773504,202773759},{202815424,202815487},{203737088,203737599},{203739648,203740159},{203779072,203780095},
+	{206040064,206040319},{207659008,207661055},{209537568,209537571},{211550208,211552255},{213121536,213121791},{215502848,215503103},{215718144,215718399},{216178176,216178431},
+	{220200960,220463103},{221511680,222035967},{225443840,225705983},{226230272,226492415},{231735296,231997439},{233046016,233832447},{234356736,234618879},{234951680,234952703},
+	{234971136,234972159},{241602560,241604607},{241607680,241608703},{241609728,241610751},{243271936,243272703},{243339008,243339263},{243343104,243343359},{243346176,243347455},
+	{243347968,243348223},{243351296,243351551},{243355392,243355647},{243359488,243359743},{243363328,243366143},{243386368,243386623},{247480320,247482367},{247791616,247857151},
+	{259784704,259850239},{259915776,260046847},{314703872,314966015},{316145664,316669951},{317128704,317194239},{385880064,385892351},{385896448,385900543},{385908736,385917695},
+	{385918976,385920767},{385921024,385925119},{385926144,385934847},{385935104,385936895},{385937408,385937919},{385938432,385938943},{385939456,385942527},{385943552,385944575},
+	{385945600,385947647},{385948672,385949695},{385950464,385950719},{385952768,385961983},{385970176,385978367},{385982464,385990655},{385994752,385999359},{385999872,386000383},
+	{386000896,386001151},{386001920,386002431},{386002944,386003967},{386004992,386006015},{386007552,386010623},{386011136,386012159},{386012672,386015487},{386015744,386026495},
+	{386027520,386028543},{386030592,386031615},{386035712,386052095},{386056192,386073087},{386073344,386073599},{386074624,386074879},{386075136,386075647},{386075904,386076159},
+	{386076416,386084863},{386089984,386090495},{386090752,386092031},{386093056,386094079},{386095616,386099711},{386101248,386105343},{386106368,386107391},{386107904,386109439},
+	{386113536,386121727},{386134016,386154495},{386158592,386170879},{386179072,386187263},{386191360,386207743},{386211840,386232319},{386244608,386244863},{386245120,386245887},
+	{386246656,386248703},{386252800,386281471},{386285568,386298879},{386300160,386319871},{386322432,386326527},{386342912,386351103},{386355200,386359295},{386367488,386371583},
+	{386379776,386396159},{386397440,386397695},{386398208,386408447},{386412544,386433023},{386441216,386453503},{386457600,386461695},{386465792,386469887},{386473984,386482175},
+	{386486272,386494463},{386498560,386523135},{386527232,386547711},{386555904,386589695},{386591744,386592255},{386592768,386593023},{386593280,386593791},{386594816,386595327},
+	{386595584,386609151},{386621440,386625535},{386633728,386637823},{386647040,386648319},{386648576,386649599},{386650112,386654207},{386658304,386660351},{386661376,386666495},
+	{386670848,386671103},{386672896,386673151},{386674688,386682879},{386686976,386700799},{386719744,386727935},{386744320,386748415},{386764800,386777087},{386781184,386782207},
+	{386783232,386783743},{386784000,386784255},{386785280,386797567},{386806784,386807807},{386814976,386815487},{386816000,386818047},{386826240,386826495},{386826752,386827263},
+	{386828288,386829311},{386830336,386842623},{386859264,386859519},{386859776,386867199},{386867456,386867711},{386868736,386868991},{386869248,386869503},{386869760,386887679},
+	{386891776,386893311},{386893568,386893823},{386895360,386904063},{386905088,386907647},{386908160,386908671},{386909184,386909695},{386910720,386920447},{386920960,386924543},
+	{387121152,387448831},{387579904,387710975},{387792896,387796991},{387805184,387817471},{387973632,387974143},{387974400,387975679},{387976192,387976703},{387977216,387977727},
+	{387978240,387980799},{387981056,387981311},{387983360,387984383},{387985408,387988735},{387988992,387994623},{387996160,387997695},{388001792,388029439},{388030464,388038655},
+	{388042752,388050943},{388051968,388052991},{388054016,388055039},{388059136,388070399},{388071424,388084735},{388086016,388086271},{388096000,388097023},{388099072,388100095},
+	{388101120,388105215},{388108288,388132863},{388137984,388139263},{388139520,388208383},{388208640,388225279},{388225536,388227071},{388231168,388239359},{388243456,388244479},
+	{388245504,388252671},{388253696,388254719},{388255744,388284415},{388285440,388286463},{388288512,388292607},{388296704,388300799},{388308992,388358143},{388362240,388370431},
+	{388374528,388386815},{388390912,388395007},{388395520,388396543},{388397056,388411391},{388415488,388440063},{388444160,388468735},{388476928,388485119},{388493312,388509695},
+	{388514304,388523007},{388523264,388523519},{388524032,388526079},{388542464,388554751},{388558848,388567039},{388571136,388605439},{388606976,388612095},{388616192,388617215},
+	{388620288,388689919},{388694016,388706815},{388707328,388708351},{388709376,388743167},{388751360,388767743},{388771840,388784383},{388784640,388784895},{388785152,388816895},
+	{388825088,388837375},{388841472,388841727},{388842240,388844543},{388844800,388845055},{388845568,388848639},{388849664,388857855},{388860928,388861951},{388862976,388876287},
+	{388877312,388894207},{388894720,388896255},{388897280,388897791},{388898816,388919295},{388923392,388931583},{388935680,388939775},{388940800,388943615},{388943872,388944383},
+	{388945920,388968447},{388974592,388984319},{388984832,388988159},{388988928,388993023},{388995072,389017599},{389021696,389046271},{389050368,389054463},{389058560,389059583},
+	{389060096,389061631},{389062656,389064703},{389066752,389070847},{389072896,389073151},{389073920,389074943},{389076224,389088767},{389090304,389091327},{389095424,389099519},
+	{389101824,389102079},{389102592,389103359},{389107712,389136383},{389140480,389154815},{389155840,389201919},{389206016,389234687},{389242880,389251071},{389259264,389272575},
+	{389273600,389296127},{389300224,389317631},{389319168,389331967},{389341184,389349375},{389350656,389350911},{389353472,389365759},{389369856,389381119},{389381632,389405695},
+	{389405952,389407999},{389408512,389410815},{389414912,389421055},{389421568,389422079},{389422592,389422847},{389423104,389427199},{389431296,389443583},{389447680,389490175},
+	{389490432,389492735},{389494784,389495807},{389496832,389539839},{389540096,389541887},{389545984,389562367},{389570816,389571071},{389573376,389582847},{389591040,389607423},
+	{389611520,389628415},{389628672,389628927},{389629184,389629951},{389630464,389636095},{389640192,389642239},{389643264,389652479},{389660672,389698047},{389698560,389699583},
+	{389699840,389701119},{389705728,389730303},{389730560,389730815},{389732352,389750783},{389764096,389795839},{389808128,389816319},{389825792,389828607},{389836800,389847039},
+	{389848064,389849087},{389852672,389853183},{389857280,389874175},{389875712,389898239},{389902336,389903871},{389905408,389906431},{389914624,389925375},{389925632,389925887},
+	{389926400,389926655},{389926912,389936127},{389936384,389937151},{389937408,389940223},{389940736,389943039},{389951488,389951999},{389952768,389963775},{389964288,389965055},
+	{389965312,389966847},{389967104,389967359},{389967872,389977087},{389978112,389979647},{389984256,389997567},{389997824,389998079},{389998336,389999871},{390000128,390011903},
+	{390012928,390021119},{390025216,390029311},{390029824,390063103},{390063616,390066175},{390070272,390071295},{390073856,390082559},{390086656,390094847},{390098944,390105599},
+	{390131712,390141695},{390142976,390143999},{390152192,390156287},{390160384,390165503},{390166528,390167039},{390167552,390167807},{390168064,390182143},{390182400,390213631},
+	{390221824,390232063},{390234112,390242303},{390250496,390260223},{390260992,390275071},{390275328,390275583},{390275840,390276351},{390276608,390276863},{390277376,390278655},
+	{390278912,390279167},{390280192,390281983},{390283264,390285311},{390286848,390287359},{390295552,390305279},{390305792,390328831},{390330368,390332415},{390594560,390652927},
+	{390653952,390654975},{390655488,390665215},{390667264,390668287},{390694656,390694911},{390696448,390706687},{390708224,390728191},{390728704,390729727},{390731776,390733055},
+	{390737920,390750207},{390754304,390768639},{390769664,390778879},{390791168,390795775},{390796288,390796799},{390797312,390807551},{390808576,390811647},{390815744,390846975},
+	{390848512,390856703},{390873088,390877183},{390882304,390883327},{390885376,390893567},{390894080,390894335},{390895872,390896127},{390905856,390906879},{390909440,390909951},
+	{390922240,390930431},{390944768,390946815},{390955008,390971903},{390972160,390973439},{390974976,390976511},{390977024,390977535},{390979584,390983679},{390984704,390986751},
+	{390987776,391004159},{391020544,391032831},{391044096,391045119},{391053312,391063551},{391064576,391073791},{391077888,391094271},{391102464,391110655},{391114752,391115007},
+	{391115520,391116543},{391117568,391118079},{391118592,391380991},{391643136,391790591},{391839744,391847935},{391860480,391860735},{391864320,391872511},{391888896,391897087},
+	{391909376,391913471},{391917568,391929855},{391933952,391938047},{391950336,391951359},{391953920,391954431},{391958528,391962623},{392036352,392167423},{392691712,393215999},
+	{394346496,394346751},{395837440,395837695},{396361728,396361983},{396558336,396558591},{396656640,396656895},{397180928,397181183},{398000128,398000383},{398470144,398471167},
+	{398479360,398488063},{398488576,398489599},{398490624,398491135},{398499840,398501887},{398512128,398513407},{398513664,398519295},{398520064,398520319},{398528512,398536703},
+	{398537728,398538751},{398540800,398548991},{398565888,398566399},{398566912,398567423},{398568448,398568703},{398568960,398577663},{398578688,398580735},{398589952,398598143},
+	{398615552,398619135},{398619392,398621695},{398622720,398625279},{398625792,398639103},{398640128,398644223},{398644736,398645759},{398647296,398656511},{398657536,398693375},
+	{398712832,398721023},{398721536,398799871},{398802432,398812159},{398849024,398853119},{398854144,398877183},{398877440,398897151},{398926848,398927871},{398929408,398929919},
+	{398939136,398940671},{398942208,398958591},{398970880,398975999},{398977024,398979071},{398987264,399004159},{399004672,399004927},{399005184,399006207},{399007232,399015935},
+	{399016960,399017983},{399019008,399028223},{399036416,399053823},{399054336,399073535},{399073792,399075327},{399076352,399077375},{399086592,399088639},{399089664,399114239},
+	{399122432,399123711},{399125504,399126527},{399134720,399143935},{399155200,399159295},{399163392,399172607},{399172864,399192575},{399193088,399193599},{399194112,399195647},
+	{399205376,399216639},{399220736,399224319},{399224576,399243263},{399244288,399253503},{399261696,399271423},{399271936,399274495},{399275008,399276031},{399276544,399279103},
+	{399280128,399294463},{399302656,399321087},{399323136,399331327},{399339776,399340287},{399341312,399341567},{399341824,399342079},{399342336,399342591},{399343104,399353343},
+	{399353856,399355391},{399355904,399364095},{399365120,399388671},{399396864,399428095},{399429632,399433727},{399434752,399437823},{399438336,399474687},{399484928,399485183},
+	{399486976,399491071},{399493376,399493631},{399494144,399514623},{399515136,399525887},{399526912,399536127},{399540224,399552511},{399561728,399583231},{399583744,399591935},
+	{399593472,399597055},{399597312,399601663},{399605760,399613951},{399619072,399619327},{399619584,399619839},{399620096,399621119},{399622144,399638527},{399640064,399657471},
+	{399657728,399661055},{399662080,399662591},{399663104,399671295},{399687680,399688191},{399688704,399691775},{399693056,399693311},{399693568,399719423},{399719680,399729663},
+	{399732992,399734527},{399735808,399736319},{399737856,399738367},{399740928,399753215},{399763968,399770623},{399770880,399771135},{399771648,399781887},{399782144,399782655},
+	{399782912,399783423},{399783936,399784447},{399784960,399795199},{399795456,399795711},{399797248,399798271},{399806464,399816703},{399816960,399817215},{399818752,399830271},
+	{399830528,399830783},{399835136,399869439},{399869952,399870463},{399870976,399881215},{399882496,399883263},{399884288,399900671},{399908864,399919103},{399919616,399932415},
+	{399933440,399951615},{399951872,399953919},{399958016,399969535},{399970048,399970303},{399980032,399980287},{399980544,399982079},{399982592,399991039},{399991296,399993343},
+	{399993600,399993855},{399994880,400000511},{400000768,400001023},{400021248,400021503},{400033280,400035839},{400045056,400045823},{400046080,400047103},{400047616,400047871},
+	{400048128,400052223},{400056320,400081919},{400083456,400084991},{400093184,400111103},{400112128,400113663},{400121856,400122367},{400123392,400124927},{400125952,400130559},
+	{400131072,400133119},{400133632,400134143},{400144384,400146431},{400147456,400148479},{400148736,400148991},{400149504,400201215},{400202752,400203775},{400211968,400221183},
+	{400223232,400224255},{400244736,400249343},{400251904,400252415},{400252928,400261119},{400261632,400261887},{400262144,400263167},{400263680,400264703},{400265216,400269311},
+	{400269568,400269823},{400270848,400271871},{400272640,400273407},{400277504,400281599},{400283648,400285695},{400302080,400310271},{400318464,400331263},{400331776,400345855},
+	{400346624,400365567},{400367616,400379903},{400384000,400392191},{400429568,400431103},{400432128,400470015},{400474112,400482303},{400494592,400527359},{400531456,400539647},
+	{400543744,400687103},{400691200,400695295},{400699392,400707583},{400719872,400720383},{400721664,400721919},{400732160,400736255},{400744448,400748543},{400769024,400777215},
+	{400785408,400805887},{400834560,400850943},{400867328,401047551},{401113088,401145855},{401244160,401276927},{401285120,401289215},{401309696,401334271},{401354752,401359103},
+	{401359360,401359871},{401360128,401362943},{401367040,401547263},{401555456,401563647},{401572096,401572607},{401572864,401573119},{401573376,401573887},{401574912,401575167},
+	{401576192,401576703},{401577472,401577983},{401579264,401580031},{401866752,401997823},{402046976,402128895},{402169856,402194431},{402235392,402239487},{402248192,402249727},
+	{402250240,402250751},{402251776,402252543},{402252800,402253823},{402259968,402341887},{402350080,402366463},{402382848,402391039},{402407936,402408191},{402415616,402423807},
+	{402452480,402587647},{405180416,405184511},{409550848,409567231},{411726080,411726335},{412041216,412045567},{412046592,412047615},{412048896,412049407},{417583872,417584127},
+	{418055168,418055679},{418672640,418676735},{452984832,452985855},{452986880,452987903},{453036032,453036543},{453044480,453045247},{456278016,456294399},{456544256,456548351},
+	{459542528,459544575},{459547648,459548159},{459548416,459548671},{460210176,460212223},{460263168,460263423},{460280320,460280831},{460281088,460281343},{460281600,460283903},
+	{460354048,460354303},{460942336,460943359},{460983296,460984319},{460994560,460995583},{461010944,461011967},{461051904,461053951},{461054976,461055231},{461055744,461055999},
+	{461139968,461144063},{461586432,461602815},{462643200,462647295},{469630976,469696511},{520291584,520292351},{520329216,520331263},{520343552,520355839},{520486912,520495615},
+	{520495872,520503295},{520504320,520505343},{520552448,520553471},{520566784,520568831},{520597504,520601599},{520822784,520826879},{520883200,520884223},{521000704,521000959},
+	{521004032,521004543},{521016832,521017343},{521021440,521022463},{521024512,521027583},{521029632,521030655},{521035776,521036799},{521043968,521048063},{521067264,521067519},
+	{521075712,521075967},{521562112,521563135},{521565440,521566207},{521670656,521670911},{521674752,521678847},{521705472,521707519},{521719808,521721855},{521723904,521725951},
+	{521740288,521742335},{521969664,521977855},{522133504,522135551},{522143744,522145791},{522835968,522838015},{523018240,523022335},{523025408,523025919},{528680704,528680959},
+	{528684032,528684543},{528685824,528686079},{528742400,528746495},{528809984,528812031},{529818368,529818623},{529827840,529829887},{529849088,529849599},{529850368,529852415},
+	{529855488,529856511},{531238912,531243007},{531245568,531246079},{531261440,531263487},{531265536,531267583},{531275776,531277823},{531333120,531335167},{531351552,531353599},
+	{531361792,531365887},{531382272,531390463},{531427328,531431423},{532209664,532210687},{532307968,532310015},{532324352,532328447},{532341504,532342271},{532344320,532344575},
+	{532365312,532366079},{532366336,532367359},{532368640,532369407},{532372480,532373503},{532375552,532375807},{532376320,532377599},{532703232,532705279},{532742144,532746239},
+	{532774912,532779007},{532785152,532787199},{533479424,533481471},{533494784,533503999},{533659648,533676031},{533864448,533889023},{533915648,533917695},{533966848,533968895},
+	{534154496,534154751},{534156544,534156799},{534158592,534158847},{534172672,534172927},{534179840,534181887},{534261760,534263807},{534512896,534513151},{534513664,534514687},
+	{534515200,534515455},{534515712,534517759},{534519552,534521855},{534523904,534527999},{534538240,534541311},{534659072,534663167},{583008256,587202559},{597164032,600834047},
+	{620706816,620707839},{620709888,620711935},{620716288,620717055},{620727296,620728319},{620743680,620744703},{620745728,620746751},{620761088,620763135},{620787712,620789759},
+	{620859392,620860415},{620871680,620879871},{621358080,621359103},{621359360,621359615},{621361152,621379583},{621430528,621430783},{621441024,621441279},{621821952,621823999},
+	{621913088,621914111},{621928448,621930495},{621947392,621947647},{621952000,621952767},{621955584,621956607},{621981696,621982719},{622487552,622489599},{622522368,622524415},
+	{623077376,623079423},{623689728,623693823},{623697920,623702015},{623773696,623774719},{623775232,623775743},{623790080,623792127},{623800320,623804415},{623806464,623808511},
+	{623820800,623822335},{623822592,623824895},{623919104,623935487},{624001024,624005119},{624025600,624026367},{624026624,624027647},{624564224,624566271},{624568320,624569343},
+	{624570368,624590847},{624623616,624689151},{624701440,624705535},{624724224,624724479},{624746496,624754687},{624803840,624812031},{624814080,624816127},{625518592,625520639},
+	{625522688,625524735},{625711104,625713151},{627216384,627218431},{628236288,628238847},{628239104,628244479},{628248576,628250623},{628662272,628670463},{628787200,628791295},
+	{628805632,628807679},{628846592,628848639},{628850688,628867071},{628871168,628873215},{628875264,628877311},{629192704,629194751},{629334016,629337087},{629866496,629874687},
+	{629879808,629880063},{629882880,629884927},{629964800,629981183},{630136832,630137855},{630138112,630138879},{630170112,630171647},{630171904,630172415},{630507520,630509567},
+	{630720512,630722559},{630817792,630818047},{630819328,630819839},{630827008,630829055},{630988800,630989311},{631095296,631097343},{631107584,631111679},{633012224,633077759},
+	{633880576,633882623},{633888768,633890815},{634068992,634071039},{634114048,634116095},{634193920,634195199},{635174912,635187199},{635197440,635201535},{635281408,635285503},
+	{635289600,635291647},{635293696,635295743},{635305984,635371519},{635723776,635724287},{635725824,635727871},{635731968,635732479},{635740160,635744255},{635863040,635864063},
+	{635864832,635865087},{635869184,635870207},{635884544,635885055},{635893760,635894015},{636170240,636174335},{636180480,636186623},{636188672,636189183},{636189696,636190719},
+	{636956672,636958719},{636973056,636975103},{637272832,637273087},{637296640,637296895},{637298176,637298431},{637319168,637321215},{637329408,637337599},{641747968,641748223},
+	{641748480,641748735},{641752064,641753087},{641769216,641769471},{641800192,641801215},{641993728,641994751},{642073088,642073343},{642113536,642115583},{642287616,642288639},
+	{642304000,642305023},{642319360,642320383},{642385920,642387967},{642437120,642441215},{642827264,642828287},{642852864,642853887},{642966528,642967551},{643006464,643007487},
+	{643057152,643057407},{643205120,643206143},{643269632,643270655},{643408128,643408383},{643417088,643418111},{643662080,643662335},{643679232,643680255},{643787776,643788799},
+	{643829248,643829503},{643858432,643858943},{643863552,643863807},{643870208,643870719},{643875584,643875839},{643965440,643965951},{644009472,644009983},{644018944,644019711},
+	{644033024,644033535},{644040192,644040447},{644049920,644050431},{644086784,644087807},{644137216,644137983},{644138240,644138495},{644155488,644155495},{644173312,644173567},
+	{644186112,644186367},{644203520,644204031},{644254720,644255743},{644276736,644277247},{644279296,644279807},{644280320,644280575},{644282368,644282879},{644325632,644325887},
+	{644420608,644423679},{644423936,644424191},{644482048,644482559},{644487936,644488191},{644491264,644491519},{644494336,644494591},{644520704,644520959},{644604160,644604415},
+	{644604928,644605951},{644611072,644611583},{644630016,644630271},{644633088,644633343},{644657152,644657663},{644686848,644687103},{644751360,644752383},{644835328,644836351},
+	{644895040,644895071},{644895232,644895487},{644896768,644897023},{644914176,644914431},{644920576,644920831},{644923904,644924159},{644932096,644932351},{644987904,644989439},
+	{644992000,644993023},{644995072,644996095},{645030144,645030655},{645115136,645115391},{645139200,645139455},{645143040,645143295},{645144576,645145599},{645186048,645186303},
+	{645202176,645202431},{645207808,645208063},{645211136,645211391},{645218816,645219071},{645252352,645252607},{645287680,645287935},{645307904,645308415},{645477376,645477887},
+	{645483520,645484031},{645797888,645799935},{645882880,645883903},{646029312,646031103},{646031360,646033407},{646035456,646037503},{646103040,646113279},{646209536,646217727},
+	{646380544,646381567},{653426688,653459455},{680488960,680489215},{691904512,691905535},{692625408,692629503},{692756480,692760575},{692822016,692830207},{692887552,692889599},
+	{692930560,692932607},{692940800,692942847},{692968960,692969215},{692983808,692984831},{693073920,693074943},{693086208,693087231},{693088000,693088255},{693107712,693108735},
+	{693420032,693429247},{696909824,696918015},{696964096,696965119},{700337152,700338175},{700366848,700375039},{700402688,700403711},{700556032,700556287},{701171712,701177855},
+	{701288448,701292543},{701448192,701456383},{701572608,701572863},{701668352,701668607},{701759488,701792255},{702046208,702054399},{702143488,702144511},{702146560,702148607},
+	{702283776,702287871},{702325248,702325759},{702337024,702339327},{702369792,702373887},{702402560,702406655},{702455808,702457855},{702501888,702502911},{703747072,703748095},
+	{704650240,704651263},{704723968,704724991},{705691648,705757183},{711173120,711173375},{712712192,712713215},{713850880,713883647},{715653120,715915263},{736108544,736109567},
+	{736122880,736123903},{736134144,736136191},{736139264,736140287},{736163840,736164351},{736177152,736178175},{736186368,736187391},{736192512,736194559},{736214016,736215039},
+	{736289792,736290303},{736290560,736290815},{736301056,736302079},{736402432,736403455},{736423424,736423935},{736424960,736425983},{736432640,736433151},{736500224,736500479},
+	{736509952,736510719},{736528384,736529407},{736542464,736542719},{736544768,736545791},{736560128,736561151},{736577536,736578047},{736606208,736607231},{736611328,736612351},
+	{736618496,736619519},{737105920,737106943},{737111040,737111807},{737118208,737120255},{737128448,737129471},{737140736,737141759},{737152000,737154047},{737180672,737180927},
+	{737181184,737181439},{737208320,737209343},{737224704,737225727},{737229824,737230847},{737231872,737232895},{737264640,737265663},{737290240,737290495},{737290752,737291007},
+	{737297408,737298431},{737307648,737308671},{737312768,737313535},{737324032,737325055},{737350656,737350911},{737367040,737368063},{737375232,737376255},{737389056,737389567},
+	{737486848,737487871},{737488896,737490943},{737491968,737492991},{737494016,737495039},{737506304,737507327},{737517568,737520639},{737526784,737527807},{737571072,737571839},
+	{737586176,737588223},{737594368,737595391},{737675264,737675519},{737746944,737747967},{737748480,737748991},{737757184,737758207},{737759232,737760255},{737771520,737772543},
+	{737786880,737787903},{737806336,737807359},{737822720,737823743},{737831680,737831935},{737849088,737849343},{737853440,737853951},{737856512,737857535},{737864448,737864703},
+	{737867776,737868799},{737871872,737872895},{737873920,737874431},{737898496,737899263},{737910784,737912831},{737915904,737916927},{737923072,737924095},{737944576,737945599},
+	{737954816,737955839},{737957888,737958143},{737958400,737958911},{737980416,737981439},{737988608,737990655},{737993728,737994751},{738079744,738080767},{738121728,738122751},
+	{738153216,738153471},{738170880,738171903},{738180096,738181119},{738187264,738188287},{739509248,739509503},{740450304,740450559},{741111040,741111295},{741345280,741346303},
+	{744682752,744683007},{745406464,745406719},{747094272,747094527},{747145728,747146239},{747148800,747149311},{747149824,747150335},{747161856,747162111},{755179520,755183615},
+	{755185408,755187711},{755369984,755370239},{757071872,757170175},{757176320,757176575},{757178112,757178367},{757202944,757334015},{757465088,757596159},{757604352,757612543},
+	{757624832,757645311},{757661696,757678079},{757696256,757696511},{757697536,757698559},{757710848,757727231},{757729280,757731327},{757760000,757799423},{757799936,757809151},
+	{757815296,757817343},{757841920,757850111},{757956608,757989375},{758513664,758546431},{758579200,758644735},{758661120,758677503},{758677760,758678015},{758678272,758678527},
+	{758681600,758683391},{758683648,758684415},{758684672,758685695},{758693888,758694143},{758700032,758701055},{758743040,758775807},{758788096,758791679},{758791936,758792191},
+	{758804480,758824959},{758845440,758846463},{758846720,758849535},{758859776,758860799},{758871808,758872063},{758872320,758872575},{758872832,758873087},{758873856,758890495},
+	{758980608,758984703},{759001088,759005183},{759007232,759013375},{759020544,759021567},{759046144,759054335},{759062528,759070719},{759087104,759136255},{759187968,759188479},
+	{759195648,759196671},{759197696,759198207},{759201792,759203839},{759212032,759213055},{759237632,759238655},{759245824,759246079},{759693312,759726079},{759802368,759803391},
+	{759803904,759804927},{759824640,759825151},{759825408,759828479},{759828736,759831295},{759833344,759834111},{759834368,759834623},{759834880,759835903},{759836160,759836415},
+	{759838976,759840767},{759889920,760102911},{760107008,760111103},{760123648,760124671},{760124928,760125439},{760125696,760126463},{760126720,760127231},{760152064,760217599},
+	{762331136,762332159},{762400768,762401023},{762413056,762414079},{762447872,762448895},{762451968,762452991},{762475520,762476031},{762517760,762518527},{762520576,762520831},
+	{762521344,762521599},{762541824,762542079},{762579968,762580991},{762596352,762598399},{762620928,762622975},{762668032,762669055},{762673152,762674175},{762682368,762683391},
+	{762684416,762685439},{762701312,762701567},{762734592,762735615},{762739712,762740735},{762741760,762742783},{762772480,762773503},{762783744,762784767},{762786816,762787839},
+	{762805504,762805759},{762812416,762813439},{762813696,762813951},{762824704,762825727},{762826752,762827775},{762840064,762841087},{762846208,762847231},{762865664,762866687},
+	{762873856,762874111},{762876928,762877951},{762878976,762879487},{762890240,762891263},{762941440,762942463},{762953728,762958847},{762962944,762963967},{763058176,763059199},
+	{763061248,763062271},{763064320,763065343},{763065600,763065855},{763071488,763073535},{763083776,763084799},{763117568,763118591},{763119616,763120639},{763128832,763129343},
+	{763129856,763130879},{763142144,763143167},{763155456,763156479},{763165696,763166719},{763175424,763175679},{763183104,763184127},{763208960,763209727},{763227136,763228159},
+	{763229184,763230207},{763233280,763234303},{763251200,763251455},{763274240,763275263},{763285504,763286527},{763287552,763288575},{763293696,763294719},{763322368,763323391},
+	{763326464,763328511},{763350528,763351039},{768016384,768081919},{769476096,769476607},{771241472,771241983},{771249152,771250175},{771306496,771306751},{771316480,771316735},
+	{771350272,771350527},{771505152,771506175},{771538176,771538687},{771683328,771684351},{771685376,771686399},{771719168,771720191},{771973120,771981311},{771997696,772001791},
+	{772005888,772079615},{772285696,772285951},{772317184,772325375},{772800512,772802559},{772803584,772804095},{772804352,772804607},{772808704,772810751},{772841472,772843519},
+	{772847616,772849663},{772851712,772853759},{772866048,772868095},{772869632,772870143},{772880384,772882431},{772888576,772892671},{772933632,772935679},{772993024,772995071},
+	{772997120,772998143},{773023744,773025791},{773031936,773036031},{773070848,773074943},{773091328,773095423},{773120000,773124095},{773165056,773169151},{773226496,773230591},
+	{773239808,773242879},{773275648,773279743},{773599232,773601279},{773603328,773605375},{773613568,773615615},{773638144,773640191},{773650176,773650431},{773656576,773658623},
+	{773675008,773677055},{773683200,773685247},{773693952,773694207},{773694720,773694975},{773699584,773701631},{773715968,773718015},{773728256,773730303},{773847040,773849087},
+	{773906432,773914623},{773931008,773939199},{773996800,773997055},{773997568,774003199},{774003712,774004735},{774094848,774103039},{774119424,774127615},{774162432,774163455},
+	{774166528,774168575},{774176768,774184959},{774217728,774225919},{774299648,774307839},{774569984,774586367},{774733824,774735871},{774736128,774750207},{775127040,775147519},
+	{775149568,775159807},{775618560,775651327},{778371072,778436607},{778466560,778466815},{778474496,778475775},{778481152,778481407},{778496000,778496511},{778498048,778500351},
+	{778500608,778500863},{778633216,778698751},{780697600,780699647},{780730368,780795903},{781455360,781459455},{781672448,781674495},{781701120,781703167},{782306304,782306815},
+	{782310144,782310399},{782317568,782319615},{782450688,782467071},{782614528,782630911},{782663680,782669823},{782671360,782680063},{782700544,782702591},{782706688,782708735},
+	{782710784,782712831},{783679488,783681535},{783685632,783689727},{783702016,783702271},{783703040,783704063},{783706112,783708159},{783710208,783712255},{783724544,783726591},
+	{783734784,783736831},{783779840,783782143},{783782400,783783935},{783800320,783802367},{786565120,786567167},{786573312,786575359},{786583552,786585599},{786589696,786591743},
+	{786601984,786604031},{786638848,786640895},{786644992,786647039},{786743296,786747391},{786771456,786771967},{786800640,786804735},{786913536,786913791},{786917376,786923519},
+	{786941952,786943999},{786980864,786989055},{786993152,786995199},{787013632,787015679},{787031552,787031807},{787111936,787120127},{787154176,787154431},{787191808,787193087},
+	{787193600,787193855},{787210240,787212287},{787214336,787216383},{787677184,787679231},{787689472,787691519},{787712512,787713279},{787713536,787714047},{787714560,787714815},
+	{787715072,787715327},{787715584,787715839},{787716096,787718143},{787721472,787721727},{787726336,787728383},{787730432,787731199},{787731968,787734527},{787749888,787750911},
+	{787767296,787768319},{787771392,787772415},{787873792,787906559},{788078592,788086783},{788259072,788259327},{788259584,788259839},{788262656,788262911},{788271104,788275199},
+	{788283392,788291583},{788303872,788307967},{788316160,788320255},{788381696,788385791},{788400128,788402175},{788473856,788475903},{789790720,789790975},{825376768,825393151},
+	{825419776,825420799},{825421824,825425919},{832311296,832312319},{837599232,837603327},{838263296,838263807},{838265088,838265855},{838991872,839122943},{839319552,839385087},
+	{839909376,840171519},{840282112,840286207},{840302592,840433663},{840695808,840720383},{840744960,840757247},{840835072,840839167},{840892416,840925183},{840942592,840943103},
+	{840953344,840953599},{840953856,840954879},{840956928,840957951},{842530816,842661887},{842681088,842681343},{842792960,843055103},{844431360,844496895},{845004800,845008895},
+	{845217792,845283327},{846200832,846266367},{846331904,846397439},{846401536,846409727},{846426112,846430207},{846438400,846442495},{846454784,846458879},{846462976,846495743},
+	{846528512,846561279},{846626816,846725119},{852010496,852010751},{852050432,852050687},{872284160,875446271},{875450368,875452415},{875495424,877330431},{877395968,877658111},
+	{877837056,877837311},{877854720,878453759},{878454784,878465023},{878466048,878468095},{878508032,878579711},{878579968,878580223},{878580736,878580991},{878581760,878582271},
+	{878582784,878583295},{878583808,878593023},{878594048,878595071},{878596096,878605311},{878627840,878638079},{878640128,878643199},{878643712,878648319},{878648832,878649343},
+	{878649856,878651391},{878653440,878656511},{878657536,878669311},{878669568,878694399},{878695424,878696447},{878698496,878698751},{878702592,878706431},{880214784,880215039},
+	{880246784,880279551},{880574464,880607231},{880809984,880811263},{880902144,880934911},{881852416,881856511},{881868800,881876991},{881884672,881917951},{884998144,885129215},
+	{885260288,887029759},{887078912,887095295},{908328960,908591103},{910163968,910393343},{910426112,912261119},{915406848,917766143},{917897216,917900287},{917901312,917902335},
+	{917929984,917938175},{917938688,917940991},{917941760,917945343},{917946112,917950463},{917950720,920518655},{920649728,922746879},{968835072,968836095},{977338368,977346559},
+	{977577984,977586175},{977741440,977741503},{978593792,978594815},{979370240,979370495},{981991424,982122495},{982760192,982760703},{995231744,995233791},{999784448,999785471},
+	{999786496,999787519},{999793664,999794687},{999795712,999796735},{999848960,999849983},{999885824,999886847},{999898112,999899135},{999920640,999921663},{1002434560,1002438655},
+	{1009295104,1009295359},{1021978624,1021979135},{1021985536,1021986047},{1021986560,1021987071},{1021987584,1021987839},{1022000896,1022001151},{1023312128,1023313919},{1023314944,1023316991},
+	{1023318016,1023319039},{1023322112,1023323135},{1023323392,1023324159},{1023325184,1023327231},{1024000000,1024032767},{1024376832,1024378879},{1024385024,1024386047},{1025294592,1025294847},
+	{1025296128,1025296383},{1025298688,1025298943},{1027219456,1027223551},{1028174336,1028175871},{1029354496,1029354751},{1029355520,1029355775},{1030259968,1030260223},{1030414336,1030418431},
+	{1030909952,1030914047},{1031311360,1031315455},{1036537856,1036541951},{1037406208,1037418495},{1039499264,1039499775},{1039500288,1039500543},{1039501312,1039503103},{1039503616,1039503871},
+	{1039504128,1039504383},{1039504896,1039505663},{1039863808,1039867903},{1039884288,1039888383},{1040449536,1040457727},{1040465920,1040474111},{1040728064,1040736255},{1041760256,1041768447},
+	{1041891328,1042022399},{1043464192,1043488767},{1043496960,1043505151},{1043529728,1043595263},{1044246528,1044247551},{1044587712,1044587743},{1044589056,1044589311},{1044590464,1044590527},
+	{1044590592,1044591103},{1044591872,1044592127},{1044592160,1044592175},{1044592192,1044592255},{1044627456,1044627711},{1044629504,1044629759},{1044630528,1044630783},{1044632320,1044632575},
+	{1044633344,1044633599},{1044636416,1044636671},{1044637696,1044638207},{1044638224,1044638239},{1044745984,1044746239},{1044754432,1044758527},{1044971520,1044979711},{1045012480,1045020671},
+	{1045135360,1045168127},{1045233408,1045233663},{1045299200,1045307391},{1045430272,1045446655},{1045454848,1045463039},{1045708800,1045716991},{1045753856,1045754879},{1045815296,1045823487},
+	{1046323200,1046347775},{1046760192,1046760959},{1046791168,1046792191},{1046793216,1046794239},{1046794496,1046795007},{1046908928,1046910463},{1046910720,1046910975},{1047117824,1047134207},
+	{1047273472,1047281663},{1047527424,1047531007},{1047535104,1047535359},{1047642112,1047658495},{1047789568,1047797759},{1047805952,1047822335},{1047838720,1047846911},{1048193024,1048195071},
+	{1048225792,1048227839},{1048246272,1048248319},{1048576000,1048584191},{1048608768,1048616959},{1048625152,1048633343},{1049231360,1049247743},{1049264128,1049284607},{1049288192,1049288447},
+	{1049292544,1049292799},{1049369888,1049369919},{1049370240,1049370255},{1049436160,1049444351},{1049624576,1049690111},{1049755648,1049821183},{1049952256,1049968639},{1049985024,1050017791},
+	{1050124288,1050126335},{1050128384,1050130431},{1051541504,1051557887},{1051566080,1051574271},{1051754496,1051762687},{1052125696,1052127231},{1052141056,1052141567},{1052155904,1052157951},
+	{1052794880,1052803071},{1053032448,1053097983},{1053106176,1053114367},{1053892608,1053900799},{1053949952,1054015487},{1054097408,1054105599},{1054400512,1054416895},{1054662656,1054666751},
+	{1054669824,1054670847},{1054866944,1054867199},{1055193088,1055193343},{1055358976,1055367167},{1055465472,1055490047},{1055973376,1055981567},{1056243712,1056251903},{1056309248,1056374783},
+	{1056943616,1056944127},{1060372480,1060380671},{1061979136,1061979391},{1062079488,1062080511},{1062145024,1062145535},{1062152192,1062154239},{1062484736,1062484991},{1062544384,1062544639},
+	{1062996992,1062998015},{1063733248,1063735295},{1063895040,1063899135},{1064011008,1064011263},{1066007552,1066008575},{1066139648,1066141695},{1066217472,1066217727},{1066219520,1066219775},
+	{1066237952,1066246143},{1066254336,1066262527},{1066311680,1066315775},{1066332160,1066338303},{1066344448,1066352639},{1066516480,1066516735},{1066533376,1066533631},{1066692864,1066693119},
+	{1066798080,1066798335},{1066903808,1066904831},{1067440128,1067440639},{1067464704,1067465215},{1067557376,1067557631},{1067673088,1067673343},{1068004608,1068004863},{1068070912,1068072959},
+	{1068425728,1068425983},{1070632448,1070632703},{1070659584,1070660095},{1070669824,1070671359},{1070680064,1070682111},{1070718976,1070723071},{1070764288,1070764543},{1070765056,1070765567},
+	{1070821120,1070821375},{1070849280,1070849535},{1070852354,1070852354},{1071031296,1071032319},{1071073792,1071074047},{1071077376,1071077631},{1071077888,1071078143},{1071093504,1071093759},
+	{1071120384,1071644671},{1071880704,1071881215},{1072249856,1072250367},{1072370688,1072371199},{1072466432,1072466687},{1072556288,1072556543},{1072565248,1072566783},{1072793600,1072793855},
+	{1072922624,1072955391},{1073088768,1073089023},{1073091328,1073091583},{1073094144,1073094399},{1073115136,1073119231},{1073168384,1073176575},{1073291008,1073291263},{1073315840,1073348607},
+	{1073373184,1073381375},{1073397760,1073405951},{1073418240,1073422335},{1073438720,1073439743},{1073440768,1073441791},{1073442816,1073443839},{1073445888,1073446911},{1073458688,1073458943},
+	{1073463296,1073463551},{1073465856,1073466111},{1073471488,1073472511},{1073473024,1073474559},{1073475072,1073476607},{1073478656,1073479679},{1074020352,1074028543},{1074077696,1074085887},
+	{1074159616,1074163711},{1074229248,1074233343},{1074250752,1074252287},{1074256384,1074256639},{1074364928,1074365183},{1074369024,1074369279},{1074371584,1074372095},{1074375936,1074376191},
+	{1074405376,1074409471},{1074528256,1074593791},{1074642944,1074659327},{1074741248,1074745343},{1074753536,1074765823},{1074790400,1074806783},{1074847744,1074860031},{1074864128,1074868223},
+	{1074960896,1074961407},{1075036160,1075044351},{1075060736,1075068927},{1075073024,1075077119},{1075109888,1075167231},{1075200000,1075216383},{1075249152,1075281919},{1075388416,1075392511},
+	{1075445760,1075462143},{1075504640,1075504895},{1075646464,1075650559},{1075679232,1075683327},{1075746560,1075747327},{1075747840,1075748095},{1075748352,1075748607},{1075773440,1075789823},
+	{1075838976,1075847167},{1075904512,1075937279},{1075972096,1075974143},{1075976192,1075998719},{1076000000,1076031743},{1076032256,1076032511},{1076033536,1076035583},{1076079616,1076079871},
+	{1076178944,1076199423},{1076281344,1076305919},{1076367360,1076371711},{1076372224,1076372479},{1076400128,1076404223},{1076445184,1076461567},{1076756480,1076760575},{1076781056,1076789247},
+	{1076969472,1076981759},{1077002240,1077018623},{1077055488,1077059583},{1077149696,1077157887},{1077171200,1077172223},{1077428224,1077430271},{1077465088,1077465343},{1077510144,1077510399},
+	{1077511168,1077511679},{1077511936,1077512191},{1077526528,1077530623},{1077538816,1077542911},{1077562368,1077563391},{1077571584,1077575679},{1077624832,1077641215},{1077848576,1077848831},
+	{1077850880,1077851135},{1077852416,1077852671},{1077853696,1077853951},{1077856512,1077856767},{1077863424,1077863679},{1077864192,1077864447},{1077869824,1077870079},{1077960960,1077965311},
+	{1077966080,1077968639},{1077992960,1078018047},{1078099968,1078116351},{1078247424,1078247679},{1078251264,1078251519},{1078280192,1078288383},{1078362112,1078394879},{1078403072,1078411263},
+	{1078433792,1078434047},{1078437632,1078437887},{1078489088,1078493183},{1078513664,1078517759},{1078575104,1078583295},{1078598656,1078598911},{1078601472,1078601727},{1078602752,1078603007},
+	{1078605312,1078605567},{1078608640,1078608895},{1078627584,1078627839},{1078628608,1078628863},{1078643968,1078644223},{1078648576,1078648831},{1078652928,1078657023},{1078837248,1078838271},
+	{1078844160,1078844415},{1078943744,1078947839},{1078951936,1078960127},{1078970624,1078971391},{1078973440,1078973695},{1079318528,1079319551},{1079377920,1079443455},{1079451648,1079459839},
+	{1079541760,1079558143},{1079648256,1079656447},{1079664640,1079668735},{1079762944,1079771135},{1079795712,1079803903},{1079853056,1079861247},{1079909120,1079909375},{1079926784,1079927039},
+	{1079942656,1079942911},{1079943168,1079951359},{1079973120,1079973375},{1079974912,1079975423},{1079975936,1079980031},{1079981056,1079981311},{1079992320,1079996415},{1080005632,1080006655},
+	{1080008192,1080009215},{1080164352,1080229887},{1080983808,1080984575},{1081032704,1081036799},{1081040896,1081049087},{1081155584,1081163775},{1081495552,1081499647},{1081606144,1081671679},
+	{1081875968,1081876223},{1081910784,1081911295},{1081980672,1081980927},{1082160128,1082160639},{1082179072,1082179583},{1082429440,1082429695},{1082753024,1082785791},{1082941440,1082945535},
+	{1082953728,1082955263},{1082956800,1082961919},{1083260928,1083269119},{1083405312,1083405567},{1083709696,1083709951},{1083736064,1083736319},{1083761664,1083762175},{1083835392,1083836415},
+	{1083867184,1083867199},{1083867360,1083867375},{1083969024,1083969279},{1084014592,1084015615},{1084020480,1084020735},{1084032000,1084032255},{1084061696,1084062207},{1084062464,1084062719},
+	{1084087296,1084087807},{1084133888,1084134399},{1085669376,1085734911},{1085906944,1085915135},{1085923328,1085927423},{1085931520,1085939711},{1085984768,1085988863},{1086021632,1086027775},
+	{1086029824,1086038015},{1086052352,1086058495},{1086062592,1086070783},{1086259200,1086291967},{1086308352,1086316543},{1086340864,1086341119},{1086347776,1086348287},{1086356736,1086356991},
+	{1086507520,1086508031},{1086854144,1086856191},{1086903552,1086903807},{1086976000,1086980095},{1086988288,1086990335},{1086991360,1086991615},{1086991872,1086992383},{1087008768,1087009279},
+	{1087021056,1087029247},{1087242240,1087307775},{1087340544,1087365119},{1087375360,1087375615},{1087388672,1087389695},{1087421184,1087421439},{1087437824,1087438847},{1087498240,1087498495},
+	{1087500288,1087500543},{1087517184,1087517695},{1087585792,1087586303},{1087664640,1087665151},{1087678976,1087679487},{1087736832,1087737855},{1087837696,1087837951},{1089052672,1089060863},
+	{1089150976,1089159167},{1089196608,1089196623},{1089203552,1089203583},{1089206528,1089206783},{1089208320,1089273855},{1089282048,1089290239},{1089299712,1089299967},{1089301248,1089301759},
+	{1089304320,1089304575},{1089305856,1089306623},{1089404928,1089437695},{1089442560,1089442815},{1089450240,1089450495},{1089451008,1089451775},{1089465344,1089466367},{1089556224,1089556479},
+	{1089863680,1089880063},{1089904640,1089912831},{1089929216,1089945599},{1090162688,1090166783},{1090191360,1090199551},{1090240512,1090244607},{1091567616,1091571711},{1091727360,1091756031},
+	{1091801856,1091802111},{1091809792,1091810047},{1091812096,1091812351},{1091960832,1092026367},{1093026048,1093026303},{1093107712,1093140479},{1093736448,1093736703},{1093745664,1093745919},
+	{1093748992,1093749247},{1093754112,1093754367},{1093903616,1093903871},{1094317824,1094318079},{1094439168,1094439423},{1094451200,1094467583},{1094549504,1094565887},{1095237632,1095303167},
+	{1095495680,1095499775},{1095598080,1095600127},{1095601152,1095601407},{1096227328,1096227583},{1096888320,1096892415},{1096941568,1096974335},{1097056256,1097072639},{1097797632,1097801727},
+	{1097834496,1097842687},{1097887744,1097887999},{1098167040,1098167295},{1098321152,1098321407},{1098444288,1098444543},{1098780672,1098780927},{1098838016,1098839039},{1101148160,1101149183},
+	{1101185024,1101186047},{1101326848,1101327359},{1101454848,1101455359},{1101675520,1101675775},{1102004224,1102020607},{1102397440,1102413823},{1103635200,1103635455},{1104001536,1104001791},
+	{1104118272,1104118783},{1104409600,1104410623},{1104736256,1104736511},{1106522624,1106523135},{1106808832,1106809087},{1107173376,1107181567},{1107238912,1107243007},{1107345408,1107346431},
+	{1107697664,1107698175},{1107771392,1107779583},{1107792896,1107793407},{1107804160,1107812351},{1108027136,1108027391},{1108045824,1108046591},{1108046848,1108047103},{1108047360,1108047871},
+	{1108048384,1108049407},{1108443904,1108444159},{1108448768,1108449279},{1108450304,1108450815},{1108472576,1108472831},{1108852736,1108865023},{1109137664,1109138175},{1109159424,1109159935},
+	{1109160192,1109160447},{1109160704,1109160959},{1109168128,1109168639},{1109171456,1109171711},{1109178112,1109178367},{1109185024,1109186559},{1109196800,1109229567},{1109458944,1109491711},
+	{1109508096,1109516287},{1109524480,1109590015},{1109626880,1109627135},{1109627648,1109627903},{1109749760,1109753855},{1109901312,1109909503},{1110126592,1110130687},{1110260480,1110260735},
+	{1110267392,1110267903},{1110302720,1110310911},{1110645504,1110646271},{1110679552,1110683647},{1110700032,1110704127},{1110856704,1110857727},{1110870016,1110870527},{1110888960,1110889471},
+	{1110894592,1110895615},{1110919168,1110919423},{1110919680,1110919935},{1110920192,1110920959},{1110921216,1110925311},{1110933504,1110941695},{1110946816,1110947071},{1110947584,1110947839},
+	{1111187456,1111195647},{1111244800,1111252991},{1111332864,1111334911},{1111465984,1111474175},{1111916544,1111949311},{1111982080,1111998463},{1112408064,1112424447},{1112506368,1112514559},
+	{1112670208,1112735743},{1112873472,1112873983},{1112878080,1112879103},{1112889600,1112889855},{1112899584,1112915967},{1112928256,1112930303},{1113210880,1113227263},{1113464832,1113465855},
+	{1113513984,1113518079},{1113608192,1113612287},{1113636864,1113653247},{1113751552,1113784319},{1113954560,1113954815},{1113980928,1113985023},{1114038272,1114038527},{1114050560,1114054655},
+	{1114443776,1114447871},{1114505216,1114537983},{1114619904,1114636287},{1114673664,1114673919},{1114674176,1114674431},{1114674688,1114675199},{1114675712,1114675967},{1114689536,1114693631},
+	{1114728704,1114728959},{1114734592,1114767359},{1114774528,1114779647},{1114963968,1114968063},{1115054080,1115058175},{1115688448,1115688703},{1115733248,1115738111},{1115795456,1115799551},
+	{1115979776,1116012543},{1116030976,1116033023},{1116033792,1116034303},{1116036864,1116037119},{1116151808,1116159999},{1116424192,1116426239},{1116879872,1116880127},{1116925952,1116930047},
+	{1116975616,1116976127},{1117130752,1117132799},{1117146880,1117147135},{1117151488,1117151743},{1117157632,1117157887},{1117166848,1117167103},{1117176576,1117176831},{1117219328,1117219583},
+	{1117228544,1117228799},{1117231616,1117231871},{1117232256,1117232383},{1117243136,1117243391},{1117251328,1117251583},{1117262336,1117262591},{1117298688,1117306879},{1117413376,1117421567},
+	{1117454336,1117455359},{1117463552,1117464575},{1117466624,1117468671},{1117744128,1117745151},{1117818112,1117818367},{1117819136,1117819391},{1117830912,1117831167},{1118003200,1118007295},
+	{1118019584,1118027775},{1118095360,1118099455},{1118109696,1118142463},{1118158336,1118158847},{1118167040,1118175231},{1118316032,1118316543},{1118511104,1118513151},{1118560256,1118568447},
+	{1118584832,1118593023},{1118818304,1118822399},{1118824448,1118826495},{1119027712,1119028223},{1119044608,1119045119},{1119113216,1119117311},{1119240192,1119248383},{1119390720,1119391743},
+	{1119407104,1119408127},{1119417344,1119418367},{1119453184,1119461375},{1119485952,1119502335},{1119576064,1119580159},{1119595520,1119600639},{1119989248,1119989759},{1120003584,1120004095},
+	{1120020480,1120020991},{1120049152,1120049663},{1120071168,1120071679},{1120079872,1120080895},{1120107520,1120108543},{1120125952,1120126975},{1120137216,1120138239},{1120140288,1120140543},
+	{1120157696,1120174079},{1120239616,1120321535},{1120333824,1120337919},{1120370688,1120387071},{1120471040,1120473087},{1120485376,1120501759},{1120516864,1120517119},{1120796672,1120808959},
+	{1120845824,1120849919},{1120872448,1120874495},{1120903168,1120909823},{1121048832,1121049087},{1121068800,1121069055},{1121193984,1121198079},{1121202176,1121206271},{1121468416,1121484799},
+	{1121599488,1121603583},{1121606656,1121607679},{1121632256,1121636351},{1121652736,1121673215},{1121714176,1121714687},{1121719552,1121719807},{1121779712,1121845247},{1122058240,1122074623},
+	{1122091520,1122092031},{1122092288,1122092799},{1122093952,1122094079},{1122094208,1122094335},{1122095104,1122095359},{1122098688,1122098943},{1122100992,1122101631},{1122103040,1122103295},
+	{1122104064,1122104319},{1122106368,1122106623},{1122106880,1122115583},{1122169856,1122170111},{1122174720,1122174975},{1122176000,1122177023},{1122197504,1122201599},{1122239744,1122239999},
+	{1122240256,1122240511},{1122246656,1122254847},{1122267136,1122271231},{1122287616,1122295807},{1122480640,1122480895},{1122525184,1122533375},{1122533632,1122534399},{1122534656,1122535423},
+	{1122631680,1122635775},{1122858752,1122859007},{1122860288,1122861055},{1123074048,1123090431},{1123119104,1123123199},{1123155968,1123160063},{1123323904,1123327999},{1123397632,1123401727},
+	{1123418112,1123483647},{1123581952,1123590143},{1123601408,1123602687},{1123615232,1123615487},{1123616256,1123616511},{1123618816,1123619327},{1123621376,1123621887},{1123631104,1123639295},
+	{1123696896,1123697151},{1123707392,1123707647},{1123716096,1123716351},{1123812264,1123812267},{1123817472,1123817727},{1123818496,1123819519},{1123990528,1123991551},{1125031936,1125040127},
+	{1125056512,1125122047},{1125195776,1125199871},{1125253120,1125384191},{1125396480,1125396991},{1125398016,1125398783},{1125399808,1125400063},{1125457920,1125458943},{1125466112,1125474303},
+	{1125507072,1125515263},{1125530624,1125530879},{1125548032,1125552127},{1125580800,1125593087},{1125597184,1125605375},{1125621760,1125629951},{1125638144,1125646335},{1125937152,1125938175},
+	{1126009856,1126010879},{1126073344,1126074367},{1126891520,1126895615},{1126928384,1126932479},{1126948864,1126952959},{1126957056,1127219199},{1127694336,1127710719},{1127899136,1127903231},
+	{1131054848,1131055103},{1131058688,1131058943},{1131106048,1131106303},{1131109632,1131109887},{1132663040,1132663071},{1132718080,1132718335},{1132738432,1132738559},{1132853248,1132854271},
+	{1133379584,1133453311},{1134440448,1134444543},{1134448640,1134452735},{1134477312,1134485503},{1134493696,1134510079},{1134551040,1134559231},{1136656384,1136721919},{1136852992,1136885759},
+	{1136889856,1136891903},{1136902144,1136903167},{1136910336,1136911359},{1136913408,1136914431},{1136918528,1136984063},{1137082368,1137115135},{1137151488,1137151743},{1137152512,1137152767},
+	{1137178624,1137178879},{1137246208,1137248255},{1137254144,1137254399},{1137256448,1137256703},{1137258496,1137259007},{1137311744,1137344511},{1137377280,1137393663},{1137508352,1137557503},
+	{1137655808,1137663999},{1137672192,1137680383},{1137686528,1137687807},{1137688320,1137692671},{1137733632,1137737727},{1137799168,1137811455},{1137815552,1137819647},{1137897472,1137901567},
+	{1137909760,1137917951},{1137983488,1137991679},{1137999872,1138003967},{1138008064,1138016255},{1138024448,1138028543},{1138032640,1138036735},{1138049024,1138057215},{1138065408,1138066431},
+	{1138085888,1138089983},{1138152448,1138152703},{1138155264,1138155519},{1138163712,1138167807},{1138184192,1138184447},{1138192384,1138196479},{1138221056,1138229247},{1138249728,1138253823},
+	{1138278400,1138289407},{1138290432,1138290687},{1138307072,1138311167},{1138336000,1138336255},{1138337280,1138337535},{1138393088,1138401279},{1138417664,1138425855},{1138429952,1138434047},
+	{1138450432,1138466815},{1138470912,1138471935},{1138515968,1138524159},{1138526464,1138526975},{1138527232,1138527743},{1138531840,1138532095},{1138536448,1138549759},{1138550272,1138550527},
+	{1138551040,1138551295},{1138551808,1138552063},{1138552320,1138552575},{1138552832,1138554111},{1138554368,1138554879},{1138555392,1138555903},{1138565120,1138573311},{1138618368,1138630655},
+	{1138649344,1138649599},{1138655232,1138663423},{1138675712,1138683903},{1138712576,1138716671},{1138733056,1138737151},{1138851840,1138884607},{1138933760,1138941951},{1138950144,1138952191},
+	{1138956032,1138956287},{1138956544,1138956799},{1138958080,1138966527},{1138982912,1139146751},{1139187712,1139195903},{1139273728,1139277823},{1145077760,1145094143},{1145141248,1145142271},
+	{1145160192,1145160447},{1145204736,1145208831},{1145225216,1145241599},{1145257984,1145262079},{1145312256,1145312511},{1145315328,1145323519},{1145331712,1145335807},{1145352192,1145352447},
+	{1145354240,1145355263},{1145368576,1145372671},{1145511936,1145520127},{1145524224,1145528319},{1150214144,1150220543},{1150221568,1150221823},{1151868928,1151877119},{1151889408,1151897599},
+	{1151913984,1151918079},{1151934464,1151941631},{1152032768,1152036863},{1152098304,1152102399},{1152548864,1152581631},{1152679936,1152684031},{1152688128,1152688383},{1152696320,1152712703},
+	{1156096000,1156104191},{1156128768,1156132863},{1156170752,1156171519},{1156177920,1156186111},{1157660672,1157693439},{1157710336,1157710591},{1157711104,1157711615},{1157711872,1157712127},
+	{1157712384,1157712639},{1157713920,1157714431},{1157714944,1157716735},{1157716992,1157717247},{1157910528,1157914623},{1157947392,1157951487},{1158021120,1158041599},{1158196992,1158197247},
+	{1158225920,1158234111},{1158258688,1158266879},{1158291456,1158299647},{1158307328,1158307583},{1158428672,1158438911},{1158441472,1158441983},{1158479872,1158545407},{1158709248,1158742015},
+	{1158873088,1158905855},{1158938624,1158971391},{1159102464,1159118847},{1159269888,1159270143},{1159276032,1159276287},{1159282432,1159282687},{1159287040,1159287295},{1159296000,1159296255},
+	{1159305728,1159305983},{1159317504,1159318015},{1159330304,1159330815},{1159372800,1159376895},{1159379200,1159379455},{1159382016,1159382271},{1159438336,1159442431},{1159475200,1159479295},
+	{1159480064,1159480319},{1159498400,1159498431},{1159501056,1159501311},{1159512064,1159528447},{1159643136,1159696383},{1159921664,1159987199},{1159995392,1159999487},{1160028160,1160036351},
+	{1160239104,1160239359},{1160241152,1160245247},{1160326656,1160327423},{1160355840,1160364031},{1160370176,1160370943},{1160371200,1160380415},{1160392704,1160404991},{1160421376,1160425471},
+	{1160534016,1160536063},{1160597248,1160597503},{1160598528,1160599295},{1160642560,1160650751},{1160658944,1160667135},{1160814592,1160814847},{1160817152,1160817407},{1160863744,1160867839},
+	{1160869888,1160870399},{1160870656,1160871935},{1160904704,1160908799},{1160962048,1160970239},{1160978176,1160978431},{1161244672,1161248767},{1161330688,1161363455},{1161396224,1161412607},
+	{1161428992,1161433087},{1161457664,1161461759},{1161560064,1161568255},{1161584640,1161592831},{1161782528,1161782783},{1161830400,1161838591},{1161859072,1161863167},{1161883648,1161904127},
+	{1161918208,1161918463},{1162330112,1162334207},{1162338304,1162412031},{1162444800,1162461183},{1162895360,1162901503},{1162928128,1162932223},{1163221504,1163221759},{1163384832,1163386879},
+	{1163390976,1163395071},{1163428352,1163428607},{1163430400,1163430655},{1163435008,1163435519},{1163460608,1163464703},{1163476992,1163485183},{1163526144,1163556351},{1163556608,1163589631},
+	{1163590144,1163591679},{1163722752,1163821055},{1163849216,1163849471},{1167278080,1167294463},{1167319040,1167327231},{1167912960,1167915007},{1168121856,1168125951},{1168154880,1168155135},
+	{1168157440,1168157695},{1168158464,1168158719},{1168175104,1168179199},{1168228352,1168230399},{1168261120,1168293887},{1168318464,1168322559},{1168326656,1168330751},{1168343040,1168375807},
+	{1168424960,1168433151},{1168437248,1168441343},{1168457728,1168458751},{1168459776,1168465919},{1168508928,1168509439},{1168605184,1168621567},{1168695296,1168695807},{1168696320,1168697855},
+	{1168698112,1168698623},{1168726528,1168727039},{1168850944,1168855039},{1168949248,1168965631},{1169037824,1169038079},{1169038336,1169038591},{1169038848,1169039359},{1169040384,1169041407},
+	{1169043456,1169043711},{1169044480,1169044991},{1169045760,1169046271},{1169046528,1169047551},{1169053440,1169053695},{1169055744,1169057791},{1169060096,1169060863},{1169092608,1169095679},
+	{1169096192,1169129471},{1169182720,1169186815},{1170211328,1170212351},{1170212864,1170214911},{1170219008,1170231295},{1170239488,1170276351},{1170341888,1170374655},{1170382848,1170383615},
+	{1170384128,1170385151},{1170391040,1170391807},{1170392064,1170393343},{1170393600,1170394623},{1170399232,1170403327},{1170458112,1170458623},{1170464256,1170464767},{1170538496,1170554879},
+	{1170571264,1170587647},{1176502272,1176514815},{1176518656,1176543231},{1176616960,1176633343},{1176641536,1176649727},{1176657920,1176662015},{1176682496,1176698879},{1176719360,1176723455},
+	{1176748032,1176752127},{1176784896,1176788991},{1176895488,1176928255},{1176977408,1177026559},{1177165824,1177169919},{1177173248,1177173503},{1177174016,1177178111},{1177193984,1177194239},
+	{1177202944,1177203199},{1177212928,1177214975},{1177485312,1177550847},{1178005512,1178005519},{1179910144,1180172287},{1180771840,1180772351},{1184241664,1184242175},{1191458816,1191459327},
+	{1191608320,1191641087},{1192460288,1192466431},{1192473600,1192474111},{1192474624,1192475135},{1192476672,1192477183},{1192480256,1192480767},{1192483328,1192483839},{1192488960,1192493055},
+	{1208188928,1208221695},{1208250368,1208254463},{1208258560,1208262655},{1208305664,1208306175},{1208322560,1208322815},{1208327168,1208327423},{1208328192,1208329215},{1208335616,1208335871},
+	{1208336128,1208336383},{1208351488,1208351743},{1208500224,1208532991},{1208582144,1208590335},{1208606720,1208614911},{1208623104,1208639487},{1208655872,1208659967},{1208713216,1208721407},
+	{1208803328,1208807423},{1208832000,1208836095},{1208922112,1208942591},{1209188352,1209192447},{1209270272,1209286655},{1209294848,1209303039},{1209384960,1209393151},{1209688064,1209696255},
+	{1209712640,1209720831},{1209860096,1209868287},{1209876480,1209892863},{1209925632,1209933823},{1209977856,1209978111},{1209978880,1209979903},{1209982976,1209985023},{1209987072,1209991167},
+	{1210056704,1210122239},{1210314752,1210317823},{1210380288,1210384383},{1210420224,1210420479},{1210421504,1210421759},{1210423296,1210423551},{1210428160,1210428415},{1210436608,1210436863},
+	{1210438144,1210438399},{1210440192,1210440703},{1210440960,1210443775},{1210445056,1210445311},{1210446336,1210447103},{1210447360,1210448383},{1210851328,1210864639},{1210866688,1210866943},
+	{1210867456,1210867711},{1211006976,1211015167},{1211088896,1211105279},{1211301888,1211307007},{1211308032,1211309055},{1211309312,1211309823},{1211310080,1211318271},{1211367680,1211367935},
+	{1211386880,1211387135},{1211400192,1211432959},{1211482112,1211482367},{1211482624,1211482879},{1211483904,1211484927},{1211486208,1211487231},{1211596800,1211613183},{1214251008,1216348159},
+	{1218859520,1218859775},{1218904064,1219231743},{1219248128,1219256319},{1219276800,1219280895},{1223170048,1223172095},{1223176192,1223178239},{1223192576,1223194623},{1223537664,1223537919},
+	{1223538688,1223538943},{1224085504,1224085759},{1224086272,1224087551},{1224087808,1224088063},{1224088576,1224089599},{1224090624,1224092159},{1224092416,1224092671},{1224092928,1224094207},
+	{1224094464,1224096255},{1224096768,1224098303},{1224098816,1224099839},{1224100864,1224110079},{1224111360,1224111615},{1224112128,1224130559},{1224131840,1224132095},{1224132608,1224134655},
+	{1224136704,1224140799},{1224142848,1224143871},{1224144128,1224144383},{1224144640,1224144895},{1224145920,1224150015},{1224151040,1224152575},{1224153088,1224155135},{1224156416,1224156671},
+	{1224157440,1224158207},{1224160256,1224161279},{1224162304,1224163327},{1224166400,1224171519},{1224173568,1224177663},{1224179200,1224181759},{1224184064,1224184831},{1224185856,1224187903},
+	{1224190976,1224196607},{1224197120,1224202239},{1224202752,1224203263},{1224205312,1224206335},{1224206848,1224207359},{1224208384,1224209663},{1224209920,1224210175},{1224210432,1224212479},
+	{1224278016,1224327167},{1224458240,1224474623},{1227195136,1227195143},{1241908224,1241909247},{1241915392,1241939967},{1241948160,1241965567},{1241970688,1241972735},{1244807168,1244823551},
+	{1244889088,1244893183},{1244909568,1244913663},{1244921856,1245183999},{1245650944,1245675519},{1245691904,1245708287},{1246838784,1246840831},{1246844928,1246846975},{1246879744,1246887935},
+	{1246888704,1246888959},{1246889216,1246889471},{1246897408,1246897663},{1246898944,1246899199},{1246901760,1246902015},{1246902528,1246902783},{1246937088,1246945279},{1247125504,1247133695},
+	{1247150080,1247215615},{1247477760,1247481855},{1247485952,1247490559},{1247493120,1247494143},{1247498240,1247502335},{1247507456,1247507711},{1247509248,1247509503},{1248860928,1248861695},
+	{1248867328,1248868351},{1248887808,1248888319},{1248897024,1248899071},{1248905216,1248907263},{1248918016,1248918527},{1248923648,1248925695},{1248931328,1248931583},{1248956416,1248957439},
+	{1248991232,1248993279},{1248997376,1248998399},{1249007616,1249008639},{1249014784,1249015807},{1249017856,1249018879},{1249022976,1249023999},{1249050624,1249052415},{1249054720,1249056767},
+	{1249062912,1249063935},{1249093632,1249093887},{1249103872,1249105919},{1249124352,1249126399},{1249137664,1249137919},{1249146880,1249147903},{1249165312,1249167359},{1249180672,1249181695},
+	{1249190912,1249191935},{1249196032,1249198079},{1249220608,1249222655},{1249225728,1249226239},{1249242112,1249243135},{1249280000,1249281023},{1249296384,1249297407},{1249324032,1249325055},
+	{1249349632,1249350655},{1249368064,1249369087},{1249373696,1249373951},{1249381376,1249382399},{1249409024,1249410047},{1249425920,1249426943},{1249434624,1249435647},{1249457664,1249458175},
+	{1249464320,1249464575},{1249481728,1249482751},{1249489920,1249492991},{1249525760,1249527807},{1249528832,1249529855},{1249546752,1249547007},{1249550336,1249551359},{1249553664,1249554431},
+	{1249558528,1249560575},{1249637376,1249638399},{1249640448,1249648639},{1249689600,1249697791},{1249705984,1249771519},{1249808384,1249818623},{1249819136,1249819647},{1249837056,1249853439},
+	{1254644992,1254645759},{1254652160,1254652671},{1254684672,1254686975},{1254699264,1254699519},{1254700800,1254701055},{1254703616,1254704383},{1254704896,1254705663},{1254715392,1254715903},
+	{1254719488,1254752255},{1254884608,1254884863},{1254948864,1254981631},{1254992640,1254992895},{1255055360,1255063551},{1255071744,1255079935},{1255137280,1255211007},{1255243776,1255251967},
+	{1255366656,1255374847},{1255669760,1255694335},{1255742464,1255743487},{1255747584,1255751679},{1255756288,1255757055},{1255773696,1255773951},{1255774208,1255780351},{1255792640,1255796735},
+	{1255993344,1255997439},{1256051200,1256052735},{1256052992,1256053247},{1256053504,1256054015},{1256054272,1256054783},{1256095744,1256112127},{1263263744,1263271935},{1263403008,1263404031},
+	{1263404800,1263405055},{1263427584,1263429631},{1264624896,1264625151},{1264717824,1264718079},{1264721920,1264726015},{1264728064,1264734207},{1264754688,1264758783},{1264943104,1264975871},
+	{1264978432,1264978687},{1264982784,1264983039},{1264984320,1264984831},{1264985600,1264986111},{1264986624,1264986879},{1264987904,1264988159},{1266139136,1266147327},{1266483200,1266618367},
+	{1266630656,1266640895},{1266644992,1266647039},{1275599872,1275600895},{1275920384,1275953151},{1279827968,1279832063},{1279852544,1279885311},{1279945728,1279945983},{1279950848,1279983615},
+	{1280159744,1280163839},{1285628160,1285628415},{1285865472,1285877759},{1287606528,1287607295},{1294270464,1294303231},{1296171008,1296203775},{1296236544,1296269311},{1296302080,1296334847},
+	{1296585216,1296585727},{1296615424,1296617471},{1296694656,1296695039},{1296699392,1296701439},{1296740352,1296741375},{1296741632,1296741887},{1296742144,1296742399},{1296744448,1296746495},
+	{1296769024,1296771071},{1296787456,1296789503},{1296791552,1296793599},{1296820224,1296820735},{1297154304,1297154559},{1297155584,1297156095},{1297179136,1297179391},{1297180672,1297182463},
+	{1297182720,1297185279},{1297185792,1297186815},{1297195008,1297196543},{1297202176,1297202687},{1297211392,1297217535},{1297477376,1297477631},{1297514496,1297547263},{1297612800,1297629183},
+	{1297664000,1297670143},{1297674240,1297678335},{1297838080,1297838335},{1297860608,1297864703},{1297868800,1297870847},{1297891328,1297899519},{1297907712,1297915903},{1297989632,1298006015},
+	{1298022912,1298030591},{1298078720,1298079743},{1298694144,1298710527},{1306316032,1306316287},{1306345216,1306345471},{1306365952,1306366975},{1306404864,1306406911},{1306407424,1306411007},
+	{1306460160,1306468351},{1306497024,1306497535},{1307092992,1307095039},{1307172864,1307181055},{1307191296,1307193343},{1307254784,1307262975},{1307336704,1307338751},{1307435520,1307436543},
+	{1307490048,1307490303},{1307533312,1307541503},{1307574272,1307578367},{1307602944,1307607039},{1307631616,1307635711},{1307639808,1307643903},{1307664128,1307664383},{1307815936,1307820031},
+	{1307889664,1307893759},{1307897856,1307901951},{1307915264,1307915519},{1307917312,1307922431},{1307967488,1307971583},{1308008448,1308012543},{1308078080,1308080127},{1308884992,1309147135},
+	{1310197760,1310199807},{1310228480,1310230527},{1310242816,1310244863},{1310656512,1310657535},{1310666752,1310668799},{1310670848,1310672895},{1310683136,1310685183},{1310705664,1310707711},
+	{1311252480,1311254527},{1311272448,1311272959},{1311295488,1311297535},{1311324160,1311326207},{1311348736,1311350783},{1311637504,1311768575},{1315713024,1315717119},{1315770368,1315774463},
+	{1315807232,1315811327},{1315872768,1315876863},{1315921920,1315926015},{1315954688,1315958783},{1317109760,1317142527},{1317175296,1317175551},{1317486592,1317502975},{1317629952,1317634047},
+	{1317683200,1317699583},{1317830656,1317847039},{1317961728,1317978111},{1317986304,1317994495},{1318687744,1318688767},{1318699008,1318707199},{1318830080,1318834175},{1318836224,1318838271},
+	{1318961152,1318969343},{1319067648,1319075839},{1331849216,1331851263},{1331855360,1331857407},{1331884032,1331886079},{1331898368,1331900415},{1332613376,1332614143},{1332615424,1332615679},
+	{1332616192,1332616447},{1332616960,1332617215},{1332625408,1332629503},{1332633600,1332637695},{1332662272,1332670463},{1333460992,1333493759},{1333592064,1333624831},{1334124544,1334132735},
+	{1334143488,1334143743},{1334312960,1334345727},{1334378496,1334411263},{1334620160,1334624255},{1334722560,1334726655},{1334784000,1334784255},{1334792192,1334793215},{1334816768,1334820863},
+	{1336551424,1336553471},{1336569856,1336571903},{1336613888,1336614143},{1336614400,1336614655},{1336614912,1336616959},{1336648448,1336648959},{1336649216,1336649727},{1336664064,1336666111},
+	{1336721408,1336737791},{1336842240,1336844287},{1346439168,1346441215},{1346445312,1346449407},{1346497280,1346497535},{1346568192,1346576383},{1346584576,1346596863},{1346654208,1346658303},
+	{1346678784,1346682879},{1346808832,1346809855},{1346830336,1346838527},{1347028992,1347030015},{1347059712,1347067903},{1347072000,1347076095},{1347108864,1347112959},{1347252224,1347256319},
+	{1347293184,1347297279},{1347350528,1347354623},{1347358720,1347362815},{1347367424,1347367679},{1347387392,1347391487},{1347567616,1347569407},{1347570688,1347571711},{1347604480,1347608575},
+	{1347641344,1347649535},{1347694592,1347698687},{1347739648,1347747839},{1347764224,1347772415},{1347787520,1347787775},{1347809280,1347813375},{1347833856,1347837951},{1347854336,1347862527},
+	{1347874816,1347878911},{1347964928,1347969023},{1347985408,1347989503},{1348001792,1348005887},{1348014080,1348018175},{1348124672,1348128767},{1348284416,1348286463},{1348292608,1348296703},
+	{1348317184,1348321279},{1348325376,1348329471},{1348444160,1348448255},{1348452352,1348456447},{1353187328,1353252863},{1353449472,1353515007},{1354629120,1354694655},{1355935744,1355936767},
+	{1356005376,1356068863},{1357316096,1357381631},{1357742080,1357774847},{1357932288,1357932543},{1357933568,1357934079},{1357934336,1357934591},{1357938688,1357942783},{1357983744,1357985791},
+	{1358024704,1358028799},{1358041088,1358045183},{1358134272,1358134783},{1358135296,1358139391},{1358147584,1358151679},{1358213120,1358217215},{1358311424,1358315519},{1358413824,1358422015},
+	{1358487552,1358491647},{1358503936,1358508031},{1358573568,1358577663},{1358712832,1358716927},{1358821376,1358822399},{1358860288,1358864383},{1358888960,1358893055},{1359134720,1359151103},
+	{1359159296,1359167487},{1359233024,1359249407},{1359382016,1359382527},{1359413248,1359429631},{1360072704,1360076799},{1360093184,1360101375},{1360117760,1360119807},{1360130048,1360134143},
+	{1360224256,1360228351},{1360281600,1360289791},{1360347136,1360351231},{1360424960,1360425215},{1360494592,1360498687},{1360527360,1360531455},{1360642048,1360646143},{1360699392,1360703487},
+	{1360740352,1360748543},{1360769024,1360773119},{1360809984,1360814079},{1360818176,1360822271},{1360851456,1360851967},{1360904192,1360912383},{1360957440,1360961535},{1360986112,1360998399},
+	{1362018304,1362032639},{1364733952,1364738047},{1364811776,1364815871},{1364844544,1364852735},{1364869120,1364873215},{1364885504,1364889599},{1365028864,1365032959},{1365039104,1365039615},
+	{1365094400,1365098495},{1365102592,1365106687},{1365139456,1365143551},{1365164032,1365168127},{1365172224,1365176319},{1365180416,1365184511},{1365209088,1365213183},{1365217280,1365221375},
+	{1370062848,1370095615},{1370128384,1370226687},{1370312704,1370316799},{1371275264,1371340799},{1372027904,1372028927},{1372030976,1372031999},{1372151808,1372164095},{1372684288,1372717055},
+	{1375782400,1375782911},{1375853824,1375854079},{1382023168,1382039551},{1382137856,1382138367},{1382138880,1382139391},{1382139648,1382140159},{1382187008,1382203391},{1382205440,1382213631},
+	{1382417408,1382417663},{1382418432,1382420479},{1382514688,1382531071},{1382809600,1383071743},{1383096320,1383104511},{1383329792,1383330047},{1383469056,1383471103},{1383524864,1383525375},
+	{1383579648,1383587839},{1385242624,1385250815},{1385273344,1385275391},{1385287680,1385291775},{1385312256,1385314303},{1385365504,1385373695},{1385512960,1385521151},{1385578240,1385578495},
+	{1385601024,1385601279},{1386432512,1386433279},{1386433792,1386434559},{1386545152,1386610687},{1388331008,1388339199},{1388380160,1388388351},{1388462080,1388470271},{1388576768,1388580863},
+	{1388601344,1388609535},{1388634112,1388642303},{1388658688,1388666879},{1388675072,1388683263},{1388789760,1388797951},{1388806144,1388814335},{1389019136,1389035519},{1389496320,1389496575},
+	{1389641728,1389658111},{1390239744,1390256127},{1390346240,1390411775},{1398833152,1398865919},{1398979328,1398979583},{1398982144,1398982399},{1400635392,1400897535},{1400963072,1401028607},
+	{1401225216,1401290751},{1401442304,1401446399},{1401448448,1401450495},{1401470976,1401473023},{1401516032,1401518079},{1401520128,1401522175},{1401691136,1401708543},{1401715712,1401718015},
+	{1401718272,1401741311},{1401821184,1401823231},{1401833472,1401837567},{1401847808,1401849855},{1401872384,1401874431},{1401901056,1401903103},{1401911296,1401913343},{1401927680,1401929727},
+	{1401942016,1401944063},{1402060800,1402077183},{1402290176,1402306559},{1402355712,1402372095},{1402437632,1402454015},{1403510784,1403518975},{1403584512,1403600895},{1403666432,1403682815},
+	{1406748928,1406749183},{1406751744,1406753023},{1406787584,1406795775},{1406959616,1406967807},{1407025152,1407033343},{1407115264,1407123455},{1407132160,1407132415},{1407148032,1407156223},
+	{1407680512,1407713279},{1408307200,1408307455},{1408436224,1408438271},{1408581120,1408581631},{1408630784,1408634879},{1410392064,1410400255},{1410408448,1410416639},{1410531328,1410539519},
+	{1410572288,1410580479},{1410596864,1410605055},{1410629632,1410637823},{1410662400,1410670591},{1410768896,1410777087},{1410809856,1410818047},{1410875392,1410879487},{1411448832,1411514367},
+	{1411710976,1411776511},{1411777536,1411778559},{1411796480,1411796735},{1411809792,1411810047},{1411810304,1411810559},{1411810816,1411811327},{1411833856,1411837951},{1411870720,1411872767},
+	{1411907840,1411908351},{1411908864,1411910655},{1411910912,1411911167},{1412235264,1412268031},{1412792320,1412808703},{1422445824,1422446079},{1422463232,1422463743},{1422475264,1422508031},
+	{1422852096,1422917631},{1424588800,1424621567},{1424625664,1424629759},{1424982016,1425014783},{1425260544,1425276927},{1425434624,1425436671},{1425440000,1425440767},{1425459200,1425463295},
+	{1425469440,1425471487},{1425473792,1425474047},{1425474560,1425475583},{1425478656,1425478911},{1425481728,1425482751},{1425483776,1425484799},{1425488640,1425488895},{1425489408,1425489663},
+	{1425522688,1425539071},{1426767616,1426784255},{1426849792,1426882559},{1426964480,1426980863},{1427030016,1427046399},{1427177472,1427243007},{1427374080,1427439615},{1427668992,1427767295},
+	{1428119552,1428121599},{1428142080,1428144127},{1431838720,1431846911},{1432018944,1432027135},{1432035328,1432035839},{1432133376,1432133631},{1432158208,1432166399},{1432174848,1432175615},
+	{1432178688,1432178943},{1432179456,1432179711},{1432180736,1432182783},{1432349952,1432351999},{1433403392,1433411583},{1433567232,1433575423},{1433600000,1433608191},{1433829376,1433831423},
+	{1433874432,1433875199},{1433901056,1433903103},{1433913600,1433913855},{1433919488,1433921535},{1436106752,1436107007},{1436150272,1436151807},{1436154880,1436155903},{1436432384,1436434431},
+	{1436448768,1436450815},{1436456960,1436459007},{1436469248,1436471295},{1436473600,1436473855},{1436481536,1436483583},{1436506112,1436508159},{1436516096,1436516351},{1436520448,1436521727},
+	{1436530688,1436532735},{1436536832,1436538879},{1436542976,1436545023},{1438173184,1438179327},{1438351360,1438359551},{1438553856,1438554111},{1438573568,1438574591},{1438576896,1438577151},
+	{1438580224,1438580479},{1438859264,1438875647},{1439305728,1439309823},{1439368960,1439369727},{1439370496,1439370751},{1439371008,1439374079},{1439375360,1439376127},{1439376384,1439379199},
+	{1439444992,1439446015},{1439451648,1439451903},{1439460096,1439460351},{1439462656,1439462911},{1439464448,1439464703},{1439470592,1439471615},{1439473664,1439474687},{1439956992,1440219135},
+	{1441275904,1441284095},{1441382400,1441390591},{1441431552,1441439743},{1441456128,1441460223},{1441497088,1441505279},{1441644544,1441652735},{1442346752,1442347263},{1442710784,1442711039},
+	{1442713600,1442714623},{1442715648,1442716671},{1442717696,1442719743},{1442745856,1442746367},{1442746624,1442746879},{1442775040,1442779135},{1445429248,1445462015},{1446903808,1446920191},
+	{1447010304,1447018495},{1449659136,1449659391},{1449659904,1449660159},{1449661440,1449662463},{1449702656,1449702911},{1449709824,1449710079},{1449710336,1449710591},{1449714688,1449715199},
+	{1449719808,1449721343},{1449722112,1449722367},{1449723136,1449723391},{1449724160,1449724415},{1449726464,1449726719},{1449728256,1449728511},{1449748480,1449749503},{1449761536,1449761791},
+	{1449762816,1449763839},{1449769728,1449769983},{1449772032,1449772287},{1449776128,1449776639},{1449776896,1449777151},{1449779968,1449780223},{1449782016,1449782271},{1449786880,1449787391},
+	{1449806592,1449806847},{1449810176,1449810431},{1449813504,1449813759},{1449818112,1449818367},{1449820928,1449821183},{1449822464,1449822719},{1449863680,1449863935},{1449865216,1449865727},
+	{1449880576,1449881087},{1449885696,1449889791},{1449901312,1449901823},{1449914880,1449915391},{1449988096,1449989119},{1450008576,1450016767},{1450026752,1450027007},{1450160128,1450164223},
+	{1450170368,1450170623},{1464602624,1464602879},{1464991744,1465384959},{1466073088,1466105855},{1466564608,1466630143},{1467219968,1467236351},{1467302912,1467303167},{1467334656,1467351039},
+	{1467367424,1467383807},{1467465728,1467473919},{1467484416,1467484671},{1467505152,1467505407},{1467578368,1467578623},{1474396160,1474428927},{1474625536,1474658303},{1474691072,1474723839},
+	{1474887680,1474953215},{1475108864,1475110911},{1475133440,1475135487},{1475139328,1475141631},{1475147008,1475147519},{1475164160,1475166207},{1475180544,1475182591},{1475196928,1475198975},
+	{1475205120,1475205887},{1475206656,1475207167},{1475219456,1475223551},{1475235840,1475237887},{1475256320,1475258367},{1475282944,1475284991},{1475313664,1475315711},{1475344640,1475344895},
+	{1475379200,1475395583},{1475772416,1475776511},{1475866624,1475868671},{1475897344,1475897599},{1475899136,1475899391},{1476059136,1476067327},{1476075520,1476083711},{1476182016,1476190207},
+	{1476257792,1476258559},{1481678848,1481695231},{1481744384,1481752575},{1481760768,1481768959},{1481981952,1481990143},{1482055680,1482063871},{1482072064,1482080255},{1482883072,1482948607},
+	{1485266944,1485271039},{1486225408,1486290943},{1486315520,1486317567},{1486333952,1486335999},{1486344192,1486346239},{1489371136,1489436671},{1489678336,1489682431},{1489690624,1489692671},
+	{1490026496,1490042879},{1490075648,1490092031},{1490309120,1490313215},{1490321408,1490323455},{1490878464,1490943999},{1494261760,1494269951},{1494335488,1494343679},{1494478848,1494480895},
+	{1494548480,1494556671},{1494645760,1494646783},{1495174400,1495174655},{1495238656,1495240703},{1495255040,1495257087},{1495259136,1495261183},{1495263232,1495265279},{1495279616,1495279871},
+	{1495302656,1495303167},{1495306240,1495308287},{1495316480,1495316735},{1495321344,1495321599},{1495336960,1495337215},{1495351296,1495351551},{1495362304,1495362559},{1495363072,1495363583},
+	{1495385344,1495385599},{1495387904,1495388159},{1495397888,1495398399},{1495407360,1495407615},{1495428864,1495429119},{1495432192,1495432703},{1495438848,1495439103},{1495444224,1495444479},
+	{1495446784,1495447039},{1495460864,1495461375},{1495465984,1495466495},{1495466752,1495467007},{1495479296,1495479551},{1495480576,1495480831},{1495507968,1495508991},{1495511552,1495511807},
+	{1495537664,1495541247},{1495554560,1495555071},{1495555328,1495555583},{1495580672,1495580927},{1495584768,1495585791},{1495588864,1495589119},{1495590912,1495592959},{1495604224,1495604479},
+	{1495622912,1495623167},{1495629824,1495630079},{1495645184,1495646207},{1495652352,1495653375},{1495655424,1495656447},{1495657472,1495658495},{1495674880,1495676927},{1495687168,1495688191},
+	{1495689728,1495690239},{1495723520,1495724031},{1495754752,1495755775},{1495766272,1495766783},{1495772160,1495772671},{1495781888,1495782399},{1495797760,1495798783},{1495799040,1495799295},
+	{1495802880,1495804159},{1495804672,1495804927},{1495811584,1495812095},{1495820288,1495820799},{1495821312,1495821823},{1495836160,1495836415},{1495838720,1495839743},{1495840000,1495840255},
+	{1495848960,1495849471},{1495849728,1495849983},{1495853312,1495853567},{1495874560,1495875071},{1495931392,1495931903},{1495932672,1495932927},{1495934976,1495935231},{1495935488,1495935743},
+	{1495937024,1495937535},{1495959296,1495959551},{1495960576,1495961087},{1495979008,1495979519},{1495979776,1495980031},{1496003328,1496003583},{1496005632,1496005887},{1496006144,1496006399},
+	{1496007680,1496008191},{1496010240,1496010495},{1496034816,1496035071},{1496082176,1496082431},{1496091136,1496091647},{1496109568,1496109823},{1496110336,1496110591},{1496123904,1496124159},
+	{1496144128,1496144383},{1496163584,1496163839},{1496179200,1496179711},{1496184832,1496186879},{1496195072,1496197119},{1496203008,1496209151},{1496212480,1496215551},{1496217856,1496218111},
+	{1496218368,1496218879},{1496219136,1496219647},{1496220672,1496221695},{1496228864,1496229887},{1496236032,1496238079},{1496249856,1496250111},{1496256256,1496256511},{1496268544,1496268799},
+	{1496274944,1496275199},{1496299264,1496299519},{1496315648,1496315903},{1496316160,1496316415},{1500028928,1500037119},{1500136192,1500136447},{1500136704,1500136959},{1500137728,1500138239},
+	{1500138752,1500139263},{1500140800,1500141823},{1500142080,1500143103},{1500155904,1500157951},{1500184576,1500186623},{1500188672,1500190719},{1500200960,1500203007},{1500231680,1500233727},
+	{1500266496,1500282879},{1500446720,1500463103},{1500905472,1501036543},{1502609408,1502625791},{1502691328,1502707711},{1502969856,1502986239},{1503887360,1503920127},{1504149504,1504151551},
+	{1504157696,1504157951},{1504165888,1504169983},{1505271808,1505279999},{1505304576,1505312767},{1505353728,1505361919},{1505378304,1505386495},{1505402880,1505411071},{1505443840,1505452031},
+	{1505460224,1505468415},{1505504256,1505504511},{1505746944,1505751039},{1506341376,1506341631},{1506443264,1506476031},{1506705408,1506738175},{1506781184,1506783231},{1507696640,1507700735},
+	{1507708928,1507713023},{1508468736,1508470783},{1508544000,1508544511},{1508545536,1508546047},{1508553728,1508554751},{1508802560,1508818943},{1509429248,1509433343},{1509445632,1509449727},
+	{1509466112,1509470207},{1509500928,1509501439},{1509507072,1509511167},{1509535744,1509537791},{1509543936,1509544191},{1509568512,1509572607},{1509588992,1509593087},{1509734400,1509735423},
+	{1509736448,1509737471},{1509750528,1509750783},{1509948928,1509949439},{1532647424,1532649471},{1532688320,1532688351},{1532774144,1532774399},{1532783616,1532783871},{1532784640,1532785151},
+	{1533427712,1533429759},{1533433856,1533435903},{1533450240,1533452287},{1533485056,1533485567},{1533485824,1533487103},{1533532160,1533534207},{1533667328,1533669375},{1533722624,1533724671},
+	{1533730816,1533732863},{1533768704,1533768959},{1533769472,1533770751},{1533771264,1533771775},{1533849600,1533851647},{1533859840,1533864959},{1533870080,1533878271},{1533896704,1533900799},
+	{1533931520,1533933567},{1534600192,1534600447},{1534656512,1534722047},{1534836736,1534840831},{1535508480,1535574015},{1535590400,1535594495},{1535631360,1535635455},{1536049152,1536053247},
+	{1536066560,1536066815},{1536086016,1536090111},{1536094208,1536098303},{1536118784,1536122879},{1536321536,1536323583},{1536475136,1536491519},{1536675840,1536679935},{1538797056,1538801663},
+	{1538916352,1538924543},{1538949120,1538965503},{1539079424,1539079679},{1539081216,1539081471},{1539083008,1539083519},{1539133440,1539134207},{1539134464,1539137535},{1539155968,1539160063},
+	{1539213312,1539217407},{1539291136,1539291391},{1539318784,1539319807},{1539337216,1539338239},{1539358720,1539359743},{1539365888,1539366911},{1539394304,1539394559},{1539404800,1539405823},
+	{1539437568,1539438591},{1539442176,1539442687},{1539443200,1539443711},{1539447296,1539447807},{1539456000,1539456511},{1539462144,1539462655},{1539463680,1539464191},{1539464704,1539465215},
+	{1539474432,1539474943},{1539521024,1539521535},{1539526656,1539527167},{1539531264,1539531775},{1539534848,1539535359},{1539536384,1539536895},{1539548672,1539548927},{1539553792,1539554047},
+	{1539563520,1539564031},{1539564544,1539565055},{1539566080,1539566591},{1539568128,1539568383},{1539608576,1539609599},{1539615744,1539616767},{1539655680,1539656703},{1539673088,1539674111},
+	{1539695616,1539696639},{1539697152,1539697663},{1539703296,1539703807},{1539710208,1539710463},{1539713792,1539714047},{1539714816,1539715071},{1539721472,1539721727},{1539724800,1539725311},
+	{1539729920,1539730175},{1539738112,1539738623},{1539741696,1539741951},{1539742976,1539743231},{1539744512,1539744767},{1539745024,1539745279},{1539751168,1539751423},{1539759872,1539760127},
+	{1539764480,1539764735},{1539768320,1539768575},{1539769600,1539769855},{1539770368,1539770623},{1539773952,1539774207},{1539774464,1539774719},{1539779840,1539780095},{1539781120,1539781375},
+	{1539786496,1539786751},{1539787520,1539787775},{1539799040,1539799295},{1539806464,1539806719},{1539806976,1539807231},{1539819520,1539819775},{1539824384,1539824639},{1539854336,1539855359},
+	{1539869696,1539870719},{1539950592,1539950847},{1540024320,1540025343},{1540047872,1540048895},{1540055040,1540056063},{1540064256,1540065279},{1540099584,1540100095},{1540139008,1540140031},
+	{1540149248,1540150271},{1540164608,1540165631},{1540169728,1540170751},{1540201472,1540202495},{1540205568,1540206591},{1540210688,1540211199},{1540220928,1540221951},{1540233728,1540234239},
+	{1540234752,1540235263},{1540248576,1540249087},{1540257280,1540257791},{1540265984,1540266495},{1540272640,1540273151},{1540273664,1540274175},{1540278272,1540278783},{1540281856,1540282367},
+	{1540284928,1540285951},{1540302336,1540302847},{1540306944,1540307455},{1540307968,1540308479},{1540318720,1540319231},{1540335616,1540336127},{1540346880,1540347903},{1540348928,1540349439},
+	{1540359424,1540359679},{1540359936,1540360191},{1540369152,1540369407},{1540370176,1540370431},{1540378880,1540379135},{1540381440,1540381695},{1540382464,1540382719},{1540383488,1540383743},
+	{1540391680,1540392191},{1540397056,1540397311},{1540398848,1540399103},{1540400128,1540400383},{1540410368,1540410623},{1540411136,1540411391},{1540416256,1540416511},{1540420096,1540420351},
+	{1540433152,1540433407},{1540436992,1540437247},{1540438272,1540438527},{1540446464,1540446719},{1540448512,1540448767},{1540449792,1540450047},{1540450304,1540450559},{1540465920,1540466175},
+	{1540482048,1540482303},{1540505600,1540506623},{1540515840,1540516863},{1540531200,1540532223},{1540533248,1540534271},{1540548608,1540549631},{1540555264,1540555775},{1540626944,1540627199},
+	{1540644096,1540644607},{1540647936,1540648191},{1540658176,1540658431},{1540658688,1540658943},{1540659200,1540659455},{1540666880,1540667135},{1540667904,1540668159},{1540672512,1540672767},
+	{1540678912,1540679167},{1540680704,1540680959},{1540683008,1540683263},{1540687872,1540688127},{1540692992,1540693247},{1540697600,1540697855},{1540701184,1540701439},{1540712192,1540712447},
+	{1540722432,1540722687},{1540726784,1540727039},{1540728064,1540728319},{1540734464,1540734975},{1540736256,1540736511},{1540737024,1540737279},{1540745216,1540745471},{1540748800,1540749055},
+	{1540762624,1540763647},{1540766720,1540767743},{1540800512,1540801535},{1540856832,1540857855},{1540862976,1540865023},{1540884480,1540884735},{1540891136,1540891647},{1540893696,1540893951},
+	{1540906240,1540906495},{1540908032,1540908287},{1540908544,1540908799},{1540923904,1540924159},{1540925440,1540925695},{1540928256,1540928511},{1540929024,1540929279},{1540929792,1540930047},
+	{1540931328,1540931583},{1540932864,1540933119},{1540942848,1540943103},{1540944128,1540944383},{1540945920,1540946175},{1540950272,1540950527},{1540966400,1540966911},{1540971008,1540971519},
+	{1540995328,1540995839},{1540996352,1540996607},{1540996864,1540997119},{1541002240,1541002495},{1541007360,1541007615},{1541008128,1541008383},{1541010944,1541011199},{1541012224,1541012479},
+	{1541013248,1541013503},{1541042176,1541043199},{1541045248,1541046271},{1541065728,1541066751},{1541075968,1541076991},{1541085184,1541086207},{1541139456,1541140479},{1541149440,1541149695},
+	{1541154048,1541154303},{1541157120,1541157375},{1541158144,1541158399},{1541158912,1541159167},{1541176064,1541176319},{1541177088,1541177343},{1541186304,1541186559},{1541187584,1541187839},
+	{1541188864,1541189119},{1541203968,1541204223},{1541213184,1541213695},{1541223168,1541223423},{1541227008,1541227519},{1541227776,1541228031},{1541235456,1541236223},{1541247488,1541247999},
+	{1541262848,1541263359},{1541277696,1541278719},{1541310464,1541311487},{1541323776,1541324799},{1541327872,1541328895},{1541345280,1541345535},{1541345792,1541346047},{1541356032,1541356287},
+	{1541364736,1541364991},{1541377536,1541377791},{1541390336,1541390591},{1541394432,1541394687},{1541421568,1541421823},{1541434368,1541434879},{1541463040,1541463551},{1541468672,1541469183},
+	{1541472256,1541473279},{1541518336,1541519359},{1541545728,1541545983},{1541569536,1541570047},{1541570304,1541570559},{1541583104,1541583359},{1541583872,1541584127},{1541590528,1541590783},
+	{1541592064,1541592575},{1541593088,1541594111},{1541615872,1541616127},{1541642752,1541643263},{1541655552,1541656063},{1541659648,1541660671},{1541664768,1541665279},{1541668864,1541669887},
+	{1541682176,1541682687},{1541686272,1541687295},{1541694720,1541694975},{1541695488,1541696511},{1541707776,1541708799},{1541721600,1541721855},{1541739520,1541739775},{1541740288,1541740543},
+	{1541753856,1541754879},{1541769216,1541769471},{1541771264,1541771775},{1541788672,1541788927},{1541793792,1541794047},{1541809664,1541810175},{1541816320,1541816575},{1541845760,1541846015},
+	{1541855232,1541855743},{1541862400,1541862911},{1541903104,1541903359},{1541904640,1541904895},{1541938176,1541939199},{1541939968,1541940223},{1541944832,1541945087},{1541955584,1541956095},
+	{1541957888,1541958143},{1541962752,1541963263},{1541965824,1541966847},{1541968896,1541969919},{1541998592,1541999615},{1542009856,1542010367},{1542023424,1542023679},{1542026240,1542026751},
+	{1542032896,1542033407},{1542042624,1542043135},{1542049280,1542049535},{1542087424,1542087679},{1542107904,1542108159},{1542109184,1542109695},{1542114048,1542114303},{1542117632,1542117887},
+	{1542160384,1542160639},{1542162432,1542162943},{1542170624,1542170879},{1542171648,1542172415},{1542182400,1542182655},{1542187008,1542187263},{1542197760,1542198015},{1542200576,1542200831},
+	{1542208256,1542208511},{1542212096,1542212607},{1542222848,1542223103},{1542224384,1542224895},{1542227968,1542228223},{1542239232,1542239999},{1542241024,1542241279},{1542246400,1542246911},
+	{1542254336,1542254591},{1542258176,1542258687},{1542260736,1542261759},{1542275840,1542276095},{1542306048,1542306303},{1542322432,1542322687},{1542349824,1542350079},{1542358272,1542359039},
+	{1542370304,1542370815},{1542376960,1542377215},{1542379008,1542379519},{1542380288,1542380543},{1542396416,1542396927},{1542406144,1542406655},{1542420992,1542421247},{1542427136,1542427391},
+	{1542437376,1542437631},{1542440960,1542441983},{1542448640,1542448895},{1542471680,1542472703},{1542484992,1542486015},{1542497792,1542498303},{1542504960,1542505215},{1542510848,1542511103},
+	{1542532096,1542532351},{1542541056,1542541311},{1542630656,1542630911},{1542640640,1542640895},{1542641152,1542641663},{1542674688,1542674943},{1542675456,1542675711},{1542675968,1542676223},
+	{1542748160,1542749183},{1542774784,1542775039},{1542787072,1542789119},{1542838784,1542839039},{1542850560,1542851071},{1542933504,1542934015},{1542961152,1542962431},{1543127040,1543143423},
+	{1543172096,1543173375},{1545994240,1545998335},{1546003968,1546004479},{1546006528,1546008575},{1546010624,1546012671},{1546020864,1546022911},{1546027008,1546031103},{1546283008,1546285055},
+	{1546291200,1546293247},{1546303488,1546305535},{1546348544,1546350591},{1546665984,1546682367},{1546878976,1546895359},{1546993664,1547010047},{1547042816,1547059199},{1547464704,1547468799},
+	{1547497984,1547498239},{1547587584,1547591679},{1547616256,1547620351},{1547646976,1547647999},{1547665408,1547669503},{1547682560,1547682815},{1550983168,1550983423},{1550983936,1550984191},
+	{1550984704,1550984959},{1550996992,1550997503},{1550998528,1550998783},{1551000064,1551000319},{1551499264,1551630335},{1558052864,1558151167},{1559270400,1559271423},{1559289856,1559298047},
+	{1559429120,1559437311},{1559453184,1559453695},{1559822336,1559838719},{1560135680,1560137727},{1565294592,1565302783},{1566067200,1566067455},{1566119680,1566120191},{1566134272,1566138367},
+	{1566179328,1566187519},{1566228480,1566232575},{1566277632,1566281727},{1566320640,1566322687},{1566334976,1566337023},{1566347264,1566349311},{1566388224,1566388479},{1566388736,1566390271},
+	{1566392320,1566394367},{1566404608,1566406655},{1566408704,1566410751},{1566433280,1566434559},{1566498816,1566500863},{1566543872,1566545919},{1567693056,1567693311},{1567714816,1567715327},
+	{1567720192,1567720447},{1567731200,1567731455},{1567733760,1567735807},{1567739392,1567739903},{1567750656,1567751167},{1567762432,1567764479},{1567768576,1567769087},{1567769856,1567770111},
+	{1567774208,1567774719},{1567775744,1567776767},{1567785472,1567785727},{1567795456,1567795967},{1567799296,1567799807},{1567812096,1567812607},{1567819520,1567819775},{1567820288,1567820543},
+	{1567823872,1567825919},{1567830016,1567831039},{1567833088,1567833343},{1567838208,1567842815},{1567843840,1567844351},{1567846144,1567846399},{1567850496,1567858687},{1567869184,1567869439},
+	{1567871488,1567871743},{1567983872,1567984127},{1568022528,1568023551},{1568024576,1568025599},{1568111360,1568111615},{1568152320,1568152575},{1568346880,1568347135},{1568347392,1568347647},
+	{1568360704,1568360959},{1568368384,1568368639},{1568636928,1568669695},{1570582528,1570584575},{1570660864,1570661375},{1570663936,1570664447},{1570668544,1570684927},{1570686976,1570693119},
+	{1570754560,1570756607},{1570759680,1570760703},{1571424768,1571425023},{1571425536,1571425791},{1571441920,1571442687},{1571448832,1571449855},{1571453696,1571453951},{1571454976,1571463167},
+	{1571471360,1571473407},{1571477504,1571481599},{1571485696,1571497983},{1571512320,1571514367},{1571521536,1571522047},{1571524608,1571526655},{1571538944,1571539967},{1571541504,1571542015},
+	{1571543040,1571543551},{1571545600,1571545855},{1571546624,1571546879},{1571686912,1571687167},{1571706880,1571708927},{1571831808,1571848191},{1572116480,1572118527},{1572429824,1572433919},
+	{1572491008,1572491263},{1572511744,1572512767},{1572514816,1572515839},{1572519936,1572524031},{1572528128,1572536319},{1572579328,1572581375},{1572595712,1572597759},{1572642816,1572644863},
+	{1572661248,1572661759},{1572673536,1572675583},{1572677632,1572679679},{1572700160,1572701183},{1572706304,1572708351},{1572755456,1572757503},{1572767744,1572769791},{1572789248,1572790271},
+	{1572810752,1572812799},{1572835840,1572836351},{1572859904,1572861951},{1578106880,1578115071},{1578131456,1578139647},{1578565632,1578631167},{1578638848,1578639359},{1578647552,1578649599},
+	{1578658816,1578659327},{1578659840,1578663935},{1580112128,1580112895},{1580120064,1580121087},{1580122112,1580123135},{1580125696,1580126207},{1580129280,1580130303},{1580135424,1580136447},
+	{1581927424,1581928447},{1582022656,1582039039},{1582088192,1582104575},{1583616000,1583620095},{1583677440,1583681535},{1583697920,1583702015},{1583755264,1583759359},{1583779840,1583783935},
+	{1583828992,1583829759},{1584660480,1584857087},{1584865280,1584914431},{1584922368,1584922623},{1585207296,1585209343},{1585291264,1585293311},{1585295360,1585297407},{1585319936,1585321983},
+	{1585358848,1585360895},{1585381376,1585383423},{1585399808,1585401855},{1585428480,1585430527},{1585440768,1585441791},{1585577984,1585643519},{1585979392,1585987583},{1586110464,1586118655},
+	{1586298880,1586307071},{1586399232,1586401279},{1586403328,1586405375},{1586425856,1586427903},{1586464768,1586466815},{1587163136,1587165183},{1587228416,1587229183},{1587230464,1587230719},
+	{1587240192,1587240447},{1587285248,1587285503},{1587290368,1587290623},{1587293696,1587294207},{1588625664,1588625919},{1588626176,1588626431},{1588630528,1588630783},{1588634368,1588634623},
+	{1588661248,1588661503},{1588664064,1588666367},{1588670464,1588674559},{1588674816,1588675071},{1588676608,1588682751},{1588683264,1588683775},{1588686848,1588687359},{1588688384,1588688639},
+	{1588689664,1588689919},{1588695552,1588695807},{1588699136,1588715519},{1589202944,1589204991},{1589431040,1589431295},{1589573632,1589574655},{1590059008,1590061055},{1590075392,1590077439},
+	{1590112256,1590114303},{1590161408,1590163455},{1592053760,1592057855},{1592082432,1592086527},{1592107008,1592111103},{1592184832,1592188927},{1592246272,1592250367},{1592967168,1592983551},
+	{1593245696,1593247743},{1593270272,1593272319},{1593409536,1593442303},{1593704448,1593737215},{1596852224,1596852479},{1596866560,1596887039},{1596899328,1596923903},{1596945664,1596945919},
+	{1596951040,1596951551},{1596955648,1596955903},{1596956672,1596956927},{1598041600,1598041855},{1599406080,1599422463},{1600389120,1600520191},{1600946176,1600978943},{1601077248,1601110015},
+	{1602234368,1602236415},{1602254848,1602256895},{1602263040,1602265087},{1602301952,1602303999},{1602316288,1602318335},{1602357248,1602359295},{1602373632,1602375679},{1602437120,1602439167},
+	{1602476032,1602478079},{1602928640,1602930687},{1603084288,1603088383},{1603119104,1603121151},{1603149824,1603150079},{1603180544,1603186687},{1603190784,1603194879},{1603196928,1603198975},
+	{1603231744,1603235839},{1603256320,1603260415},{1603977216,1603993599},{1604116736,1604118783},{1604123392,1604123647},{1604141056,1604157439},{1604894720,1604902911},{1604952064,1604960255},
+	{1605107712,1605115903},{1605127424,1605127679},{1605128960,1605129471},{1605129728,1605130239},{1605219072,1605219327},{1605259264,1605261311},{1605753088,1605753599},{1605840896,1605844991},
+	{1607663616,1607761919},{1607782400,1607860223},{1607927808,1607928319},{1607941120,1607942143},{1607983104,1607984127},{1607991296,1608122367},{1611005952,1611010047},{1611016192,1611016447},
+	{1611016704,1611016959},{1611017472,1611017983},{1611022336,1611026431},{1611030528,1611035135},{1611035392,1611035903},{1611036160,1611037951},{1611038208,1611046911},{1611051008,1611067391},
+	{1611075584,1611079679},{1611080192,1611080447},{1611081216,1611081471},{1611081728,1611082239},{1611083776,1611086847},{1611087872,1611100159},{1611104256,1611117567},{1611118080,1611126015},
+	{1611127296,1611128575},{1611128832,1611132927},{1611134464,1611135487},{1611135744,1611135999},{1611165696,1611169791},{1611235328,1611251711},{1611266816,1611267071},{1611661312,1611726847},
+	{1611728896,1611729663},{1611729920,1611730175},{1611730432,1611744255},{1611744512,1611744767},{1611745280,1611745535},{1611745792,1611747327},{1611752704,1611753215},{1611753472,1611754495},
+	{1611754752,1611755263},{1611763712,1611763967},{1611764736,1611764991},{1611765504,1611767807},{1611768064,1611768831},{1611769600,1611769855},{1611770368,1611771903},{1611772160,1611774975},
+	{1611776000,1611777279},{1611777536,1611777791},{1611778048,1611780095},{1611784192,1611792383},{1612660736,1612668927},{1612685312,1612689407},{1613451264,1613459455},{1613529088,1613545471},
+	{1613565952,1613570047},{1613602816,1613611007},{1613701120,1613702911},{1613703168,1613705215},{1613746176,1613754367},{1613755392,1613756415},{1614675968,1614741503},{1618841600,1618853887},
+	{1618894848,1618903039},{1618935808,1618984959},{1631584256,1631617023},{1632108544,1632305151},{1632364544,1632364799},{1634435072,1634439167},{1652308992,1652310015},{1652336384,1652336639},
+	{1652338432,1652338687},{1652342784,1652359167},{1652424704,1652490239},{1652621312,1652686847},{1653080064,1653342207},{1653464064,1653464319},{1653473280,1653477375},{1653493760,1653501951},
+	{1653506048,1653510143},{1653529600,1653530111},{1653530624,1653534719},{1653547008,1653551103},{1653575680,1653579775},{1653583872,1653587967},{1654558720,1654562815},{1654566912,1654571007},
+	{1654582272,1654587391},{1654595584,1654597631},{1654598400,1654599423},{1654611968,1654612991},{1654613504,1654614015},{1654614272,1654616063},{1654644992,1654648831},{1673560064,1673592831},
+	{1673945088,1673953279},{1680486400,1680494591},{1680498688,1680502783},{1680527360,1680535551},{1680556032,1680564223},{1680572416,1680588799},{1694515200,1694531583},{1694672896,1694673919},
+	{1698004992,1698013183},{1701093376,1701100287},{1701100544,1701101311},{1701740544,1701773311},{1709047808,1709051903},{1710096384,1710227455},{1728146432,1728147455},{1728157696,1728158719},
+	{1728162816,1728163839},{1728167936,1728168959},{1728174080,1728175103},{1728191744,1728191999},{1728232448,1728232959},{1728234496,1728235519},{1728264192,1728264703},{1728265216,1728266239},
+	{1728268288,1728269311},{1728292352,1728292607},{1728293888,1728294911},{1728316416,1728320511},{1728330752,1728332799},{1728346624,1728347135},{1728364544,1728365567},{1728369664,1728370687},
+	{1728374272,1728374527},{1728384000,1728385023},{1728392192,1728393215},{1728435968,1728436223},{1728453632,1728454655},{1728462848,1728463871},{1728467968,1728468991},{1728472064,1728473087},
+	{1728483328,1728484351},{1728492544,1728492799},{1728496640,1728497663},{1728500736,1728501759},{1728505856,1728506879},{1728508928,1728509951},{1728558080,1728559103},{1728563200,1728563711},
+	{1728563968,1728564223},{1728573440,1728574463},{1728583680,1728585215},{1728621568,1728622591},{1728656128,1728656383},{1728657408,1728658431},{1728672768,1728673791},{1728680960,1728681983},
+	{1728684032,1728685055},{1728740352,1728740607},{1728748544,1728749567},{1728756736,1728757759},{1728758784,1728759551},{1728783616,1728783871},{1728786432,1728788479},{1728791296,1728791551},
+	{1728811008,1728812031},{1728813056,1728814079},{1728831232,1728831487},{1728841728,1728842751},{1728845568,1728845823},{1728855040,1728856575},{1728859136,1728860159},{1728878592,1728879615},
+	{1728893696,1728893951},{1728914688,1728914943},{1728919552,1728920575},{1728924416,1728924671},{1728925696,1728926719},{1728930816,1728931839},{1728933888,1728934911},{1728952832,1728953343},
+	{1728961024,1728961279},{1728963584,1728964607},{1728966656,1728967679},{1728980992,1728982015},{1728990208,1728990719},{1728990976,1728991231},{1728995840,1728996351},{1729021952,1729022975},
+	{1729048576,1729049599},{1729062912,1729063935},{1729067008,1729068031},{1729070080,1729071103},{1729072896,1729073151},{1729076224,1729076479},{1729079296,1729080319},{1729081856,1729083391},
+	{1729085440,1729087487},{1729091584,1729092607},{1729096704,1729097215},{1729108480,1729108991},{1729112064,1729113087},{1729113856,1729114111},{1729121536,1729121791},{1729136128,1729136639},
+	{1729147904,1729148415},{1729152256,1729152511},{1729158656,1729158911},{1729160192,1729161215},{1729174528,1729175551},{1729190912,1729191935},{1729197056,1729198079},{1729199104,1729199615},
+	{1729217536,1729218559},{1729220608,1729221631},{1729226752,1729227775},{1729243136,1729244159},{1729247488,1729247743},{1729254400,1729255423},{1729260544,1729261567},{1729285120,1729286143},
+	{1729298688,1729298943},{1729303552,1729305599},{1729311744,1729312767},{1729317888,1729318911},{1729368576,1729369343},{1729379328,1729379839},{1729380096,1729380351},{1729387520,1729388543},
+	{1729406976,1729407999},{1729413120,1729414143},{1729415168,1729416191},{1729418240,1729419263},{1729420288,1729421311},{1729427456,1729428479},{1729452032,1729453055},{1729459200,1729460223},
+	{1729464320,1729465343},{1729475584,1729476607},{1729482752,1729483775},{1729489920,1729490943},{1729491968,1729492991},{1729494016,1729494271},{1729494528,1729495039},{1729527808,1729528831},
+	{1729536000,1729537023},{1729546240,1729547263},{1729571840,1729572863},{1729587200,1729587455},{1729589248,1729590271},{1729598720,1729598975},{1729626112,1729627135},{1729629696,1729629951},
+	{1729636352,1729637375},{1729646336,1729646591},{1729649664,1729650687},{1729656832,1729657087},{1729657344,1729657855},{1729659904,1729660415},{1729683200,1729683455},{1729704960,1729705215},
+	{1729705984,1729707775},{1729724416,1729725439},{1729767936,1729768447},{1729795072,1729796095},{1729800704,1729801215},{1729802240,1729803263},{1729809408,1729810431},{1729830912,1729831935},
+	{1729841152,1729841919},{1729842176,1729843199},{1729854464,1729855487},{1729865728,1729866751},{1729867776,1729868799},{1729879040,1729882111},{1729892352,1729893375},{1729900544,1729901567},
+	{1729902080,1729902591},{1729906432,1729906687},{1729929728,1729929983},{1729940224,1729940479},{1729971200,1729973247},{1730009088,1730010111},{1730013184,1730013695},{1730020352,1730021375},
+	{1730023936,1730024191},{1730029568,1730030591},{1730050560,1730050815},{1730058240,1730059263},{1730072576,1730073087},{1730073856,1730074111},{1730085888,1730086911},{1730092032,1730093055},
+	{1730123776,1730124799},{1730361344,1730362367},{1730376704,1730377727},{1730384896,1730385919},{1730388992,1730389503},{1730391040,1730392063},{1730393088,1730394111},{1730425856,1730426879},
+	{1730439168,1730440191},{1730447360,1730448383},{1730455552,1730457087},{1730457600,1730458623},{1730477056,1730478079},{1730509824,1730510847},{1730548736,1730549759},{1730560000,1730561023},
+	{1730580736,1730580991},{1730581504,1730582271},{1730598912,1730599423},{1730608640,1730608895},{1730632704,1730633727},{1730636800,1730637823},{1730670080,1730670591},{1730672640,1730672895},
+	{1730702592,1730702847},{1730704896,1730705407},{1730715648,1730716671},{1730732288,1730732543},{1730744320,1730745343},{1730774016,1730775039},{1730785280,1730785791},{1730833408,1730834431},
+	{1730846720,1730847743},{1730881280,1730881535},{1730889728,1730890751},{1730898944,1730899967},{1730900992,1730902015},{1730926592,1730927615},{1730942720,1730942975},{1730953216,1730954239},
+	{1730955264,1730956031},{1730964480,1730964735},{1730993408,1730993663},{1731103744,1731104767},{1731146752,1731147775},{1731152896,1731153407},{1731170304,1731171839},{1731172864,1731173375},
+	{1731183104,1731183615},{1731193088,1731193343},{1731197952,1731198975},{1731205632,1731205887},{1731211776,1731212287},{1731244032,1731245055},{1731263488,1731264511},{1731270656,1731271679},
+	{1731288064,1731289087},{1731301888,1731302143},{1731314688,1731315711},{1731338752,1731339263},{1731372032,1731373055},{1731394560,1731395583},{1731406080,1731406335},{1731406592,1731406847},
+	{1731431936,1731433471},{1731476992,1731477247},{1731504384,1731504639},{1731507200,1731508223},{1731513344,1731514367},{1731532288,1731532799},{1731538944,1731539967},{1731540736,1731540991},
+	{1731564544,1731566079},{1731576832,1731577855},{1731584000,1731585023},{1731588096,1731589119},{1731613696,1731613951},{1731652608,1731652863},{1731659776,1731660031},{1731660288,1731660799},
+	{1731663872,1731664895},{1731699200,1731699711},{1731736576,1731737599},{1731751936,1731753983},{1731758080,1731759103},{1731765248,1731766271},{1731778560,1731779583},{1731792896,1731793151},
+	{1731807232,1731808255},{1731831040,1731831295},{1731831552,1731831807},{1731836928,1731837951},{1731899392,1731900415},{1731904512,1731905535},{1731931136,1731932159},{1731943424,1731944447},
+	{1731945472,1731946495},{1731947520,1731948543},{1731960832,1731961855},{1731987456,1731989503},{1732001792,1732002815},{1732040704,1732040959},{1732046848,1732047871},{1732068864,1732069119},
+	{1732127744,1732129791},{1732132864,1732133887},{1732242432,1732243455},{1732250624,1732251135},{1732361216,1732362239},{1732403200,1732404223},{1732405248,1732405759},{1732424704,1732425727},
+	{1732433920,1732434943},{1732488448,1732488703},{1732504064,1732504575},{1732507648,1732507903},{1732508672,1732509695},{1732530176,1732531199},{1732537344,1732538111},{1732551680,1732552703},
+	{1732558848,1732559871},{1732585472,1732586495},{1732608512,1732609023},{1732629504,1732630527},{1732653056,1732653567},{1732687872,1732688895},{1732718592,1732719615},{1732731392,1732731903},
+	{1732745216,1732745471},{1732751360,1732752383},{1732792320,1732792831},{1732809728,1732809983},{1732821504,1732822015},{1732853760,1732854783},{1732859392,1732859903},{1732877312,1732877567},
+	{1732878336,1732879359},{1732903936,1732904191},{1732904448,1732904959},{1732905984,1732906495},{1732946944,1732947967},{1732952832,1732953087},{1732954112,1732954367},{1732970496,1732971519},
+	{1732977664,1732978687},{1733016576,1733017599},{1733023488,1733023743},{1733026816,1733027327},{1733046272,1733046783},{1733055488,1733057023},{1733060608,1733061631},{1733074432,1733074943},
+	{1733080064,1733081087},{1733116928,1733117439},{1733156864,1733157119},{1733195776,1733196799},{1733227008,1733227263},{1733250048,1733251071},{1733261312,1733262335},{1733275648,1733276671},
+	{1733300224,1733301759},{1733303296,1733304319},{1733350400,1733352447},{1733354496,1733355519},{1733397504,1733398527},{1733403136,1733403391},{1733404672,1733405695},{1733408512,1733408767},
+	{1733428224,1733428479},{1733440512,1733441535},{1733487104,1733487615},{1733536256,1733536767},{1733580800,1733581823},{1733597184,1733598207},{1733651456,1733652479},{1733679104,1733680127},
+	{1733681152,1733682175},{1733707520,1733707775},{1733713920,1733714943},{1733734912,1733735423},{1733737472,1733737983},{1733798912,1733799679},{1733842944,1733843967},{1733856000,1733856255},
+	{1733921024,1733921279},{1733949696,1733949951},{1734012928,1734013951},{1734031360,1734031615},{1734032128,1734032383},{1734033408,1734034431},{1734044160,1734044671},{1734073088,1734073343},
+	{1734136320,1734136831},{1734179072,1734179327},{1734259712,1734260735},{1734260992,1734261247},{1734300672,1734301695},{1734377472,1734378495},{1734408960,1734409215},{1734462464,1734463487},
+	{1734467584,1734468607},{1740656896,1740657151},{1740680448,1740680703},{1740681216,1740682239},{1740687360,1740688383},{1740693504,1740694527},{1740702720,1740703743},{1740709888,1740710911},
+	{1740722176,1740723199},{1740726784,1740727039},{1740733440,1740734719},{1740748800,1740749823},{1740777472,1740777983},{1740778240,1740778495},{1740779264,1740779519},{1740793600,1740793855},
+	{1740795904,1740796415},{1740809216,1740811263},{1740837120,1740837375},{1740840960,1740841983},{1740858368,1740859391},{1740860416,1740861439},{1740866560,1740867583},{1740869376,1740869631},
+	{1740871168,1740871423},{1740885760,1740886015},{1740904960,1740905471},{1740907520,1740908543},{1740910592,1740911615},{1740959744,1740960511},{1740969984,1740971007},{1740978176,1740979199},
+	{1740986880,1740987391},{1741001728,1741002751},{1741004800,1741005823},{1741028352,1741028607},{1741029376,1741029631},{1741039616,1741040639},{1741046784,1741047807},{1741049088,1741049343},
+	{1741078528,1741079551},{1741161472,1741162239},{1741165568,1741166079},{1741167616,1741168639},{1741185024,1741186047},{1741190144,1741190911},{1741192192,1741193215},{1741215744,1741216767},
+	{1741258752,1741259775},{1741350912,1741351935},{1741367296,1741368319},{1741371648,1741372415},{1741380096,1741380351},{1741403136,1741404159},{1741423616,1741424639},{1741447680,1741447935},
+	{1741449728,1741450239},{1741466624,1741467647},{1741490176,1741490687},{1741490944,1741491199},{1741504512,1741505535},{1741509632,1741510143},{1741510400,1741510655},{1741518848,1741519871},
+	{1741523968,1741524991},{1741541888,1741542399},{1741558784,1741559807},{1741573120,1741574143},{1741575168,1741576191},{1741613056,1741614079},{1741626368,1741627391},{1741629440,1741630463},
+	{1741636608,1741637631},{1741659136,1741659647},{1741661184,1741662207},{1741706240,1741706751},{1741734912,1741735423},{1741741056,1741742079},{1741747712,1741748223},{1741751296,1741751807},
+	{1741756416,1741756927},{1741758464,1741759487},{1741765376,1741765631},{1741769728,1741770239},{1741775616,1741775871},{1741789184,1741789695},{1741790208,1741791231},{1741796864,1741797119},
+	{1741798400,1741798911},{1741814784,1741815807},{1741818880,1741819903},{1741853696,1741854975},{1741870080,1741871103},{1741881344,1741882367},{1741923328,1741923583},{1741942528,1741942783},
+	{1741955072,1741956095},{1741964288,1741965311},{1742004224,1742004991},{1742005248,1742005759},{1742038016,1742039039},{1742075136,1742075391},{1742075904,1742076927},{1742077952,1742078975},
+	{1742082048,1742084095},{1742095616,1742095871},{1742107136,1742107647},{1742109184,1742109695},{1742113792,1742114815},{1742120960,1742123007},{1742127104,1742128127},{1742147328,1742147583},
+	{1742155776,1742156799},{1742163968,1742164991},{1742178304,1742179327},{1742203392,1742203647},{1742224384,1742225407},{1742250240,1742250495},{1742257664,1742258175},{1742259200,1742259711},
+	{1742298112,1742299135},{1742330880,1742331903},{1742338560,1742338815},{1742339584,1742339839},{1742347264,1742348287},{1742410752,1742411263},{1742435328,1742436351},{1742443008,1742443263},
+	{1742454784,1742455551},{1742472192,1742473215},{1742482432,1742482687},{1742698496,1742698751},{1742699008,1742699263},{1742715136,1742715391},{1742753792,1742754815},{1742759680,1742759935},
+	{1742763008,1742764031},{1742769152,1742769663},{1742774784,1742775039},{1742775296,1742776319},{1742779648,1742779903},{1742794752,1742796799},{1742800896,1742801919},{1742814208,1742815743},
+	{1742818560,1742818815},{1742824192,1742824447},{1742827520,1742828543},{1742839808,1742841855},{1742849024,1742850047},{1742860800,1742861055},{1742896128,1742897151},{1742903296,1742904319},
+	{1742909440,1742910463},{1742920704,1742921727},{1742922752,1742923775},{1742930176,1742930431},{1742937088,1742938111},{1742939136,1742940159},{1742944256,1742945279},{1742946048,1742946303},
+	{1742969856,1742970879},{1742974976,1742975999},{1742983168,1742984191},{1743008768,1743009791},{1743011840,1743012863},{1743015936,1743016447},{1743033344,1743035391},{1743037440,1743038463},
+	{1743039488,1743040511},{1743061248,1743061503},{1743070208,1743071231},{1743077376,1743078399},{1743090688,1743091711},{1743092736,1743093759},{1743108096,1743108607},{1743118848,1743119359},
+	{1743140864,1743141887},{1743154176,1743155199},{1743158272,1743159295},{1743162368,1743162623},{1743170560,1743171583},{1743195136,1743196159},{1743214592,1743215615},{1743236096,1743237119},
+	{1743239168,1743239423},{1743239680,1743239935},{1743242752,1743243263},{1743255552,1743256063},{1743256576,1743257599},{1743261696,1743262719},{1743266304,1743266815},{1743279104,1743280127},
+	{1743298304,1743298559},{1743301120,1743301631},{1743305728,1743306751},{1743312640,1743313407},{1743329280,1743330303},{1743330816,1743331327},{1743353856,1743354111},{1743397888,1743398911},
+	{1743413248,1743414271},{1743418880,1743419391},{1743435776,1743436287},{1743455232,1743455487},{1743467520,1743468543},{1743470592,1743471103},{1743480832,1743481855},{1743508480,1743509503},
+	{1743547392,1743548415},{1743554560,1743555583},{1743557632,1743558143},{1743574016,1743575039},{1743576064,1743577087},{1743596544,1743597567},{1743599104,1743599615},{1743623168,1743624191},
+	{1743670272,1743672319},{1743676416,1743677439},{1743684096,1743684351},{1743705088,1743706111},{1743708160,1743709183},{1743729152,1743729407},{1743751168,1743752191},{1743767552,1743768575},
+	{1743804416,1743805439},{1743823872,1743824895},{1743827968,1743828991},{1743833088,1743834111},{1743836160,1743837183},{1743847424,1743848447},{1743859712,1743861759},{1743862784,1743863807},
+	{1743868928,1743869183},{1743874560,1743875071},{1743885824,1743886335},{1743890432,1743891455},{1743901696,1743902719},{1743912960,1743913983},{1743915008,1743916031},{1743936512,1743937535},
+	{1743942656,1743943679},{1743946752,1743947775},{1743960320,1743960831},{1743983360,1743983615},{1743984640,1743985663},{1743992832,1743993855},{1743996928,1743997951},{1744001792,1744002047},
+	{1744006656,1744006911},{1744011264,1744012287},{1744015360,1744016383},{1744022528,1744023551},{1744030720,1744031743},{1744032768,1744033791},{1744037888,1744038911},{1744039680,1744039935},
+	{1744040960,1744041471},{1744044032,1744045055},{1744056832,1744057087},{1744066560,1744067583},{1744072704,1744073727},{1744081920,1744082943},{1744093184,1744094207},{1744131072,1744132095},
+	{1744165888,1744167167},{1744169472,1744169727},{1744184320,1744185343},{1744197632,1744198655},{1744199680,1744199935},{1744203776,1744204799},{1744210944,1744211967},{1744212992,1744214015},
+	{1744223232,1744224255},{1744230912,1744232447},{1744237568,1744238847},{1744249856,1744250367},{1744265216,1744266239},{1744268288,1744269311},{1744274944,1744275199},{1744278528,1744279551},
+	{1744287744,1744288767},{1744311296,1744312319},{1744321536,1744322559},{1744354560,1744355327},{1744371712,1744372735},{1744386560,1744387071},{1744389632,1744390143},{1744393216,1744394239},
+	{1744396288,1744400383},{1744413184,1744413695},{1744430080,1744431103},{1744438272,1744439295},{1744457728,1744458751},{1744459776,1744460543},{1744473088,1744474111},{1744482304,1744483327},
+	{1744484352,1744485119},{1744491520,1744492543},{1744508928,1744509951},{1744512000,1744513023},{1744519168,1744520191},{1744525312,1744525823},{1744526080,1744527359},{1744531456,1744531711},
+	{1744540672,1744541695},{1744590080,1744590335},{1744590848,1744591871},{1744596992,1744598015},{1744619520,1744620543},{1744624640,1744625663},{1744628736,1744629759},{1744636928,1744637951},
+	{1744640000,1744641023},{1744643072,1744643583},{1744644096,1744645119},{1744651776,1744652031},{1744661504,1744662527},{1744664064,1744664575},{1744670720,1744671743},{1744683008,1744684031},
+	{1744702464,1744703487},{1744734208,1744735231},{1744737280,1744739327},{1744740352,1744741375},{1744750080,1744750591},{1744752640,1744753663},{1744772864,1744773119},{1744779264,1744780287},
+	{1744794624,1744795647},{1744815104,1744816127},{1744825344,1744826367},{1744828416,1744828927},{1745879040,1746927615},{1747193856,1747194879},{1747197952,1747198975},{1747204096,1747206143},
+	{1747235328,1747235839},{1747247104,1747249151},{1747255296,1747257343},{1747261696,1747261951},{1747262720,1747262975},{1747266560,1747267583},{1747270144,1747270655},{1747273728,1747274751},
+	{1747298304,1747299327},{1747302400,1747304447},{1747309568,1747310591},{1747316736,1747317247},{1747317760,1747319807},{1749037056,1749065727},{1749078016,1749086207},{1749090304,1749106687},
+	{1749164032,1749172223},{1749180416,1749182463},{1749186560,1749188607},{1749221376,1749254143},{1749258240,1749262335},{1749270528,1749295103},{1749303296,1749346303},{1749348352,1749360639},
+	{1749364736,1749372927},{1749389312,1749409279},{1749413888,1749438463},{1749447680,1749459455},{1749459712,1749459967},{1749460736,1749461503},{1749461760,1749462015},{1749463040,1749463551},
+	{1749464320,1749466111},{1749476864,1749496319},{1749499392,1749508095},{1749516288,1749519871},{1749520384,1749528575},{1749539584,1749539839},{1749557248,1749565439},{1749566976,1749567487},
+	{1749586944,1749606399},{1749615616,1749615871},{1749616128,1749636095},{1749655808,1749656319},{1749686272,1749748735},{1749748992,1749767167},{1749767680,1749769215},{1749770240,1749786623},
+	{1749787136,1749787391},{1749788928,1749789183},{1749807104,1749837823},{1749838336,1749856255},{1749857792,1749860351},{1749862144,1749862399},{1749863424,1749863679},{1749866240,1749866751},
+	{1749867264,1749867519},{1749868032,1749876735},{1749877248,1749897215},{1749897984,1749898239},{1749898752,1749899007},{1749899520,1749900031},{1749900544,1749900799},{1749901056,1749901311},
+	{1749901824,1749902079},{1749902336,1749903103},{1749903360,1749903615},{1749903872,1749904127},{1749905664,1749906943},{1749907456,1749907711},{1749908224,1749908991},{1749909504,1749910271},
+	{1749910784,1749913087},{1749914624,1749915135},{1749915392,1749915903},{1749916160,1749916927},{1749917184,1749917439},{1749918464,1749919231},{1749919488,1749919743},{1749920512,1749921535},
+	{1749922048,1749922303},{1749923072,1749924095},{1749924352,1749924607},{1749924864,1749925375},{1749925632,1749925887},{1749926400,1749926655},{1749927168,1749927423},{1749927680,1749927935},
+	{1749928448,1749928703},{1749928960,1749930495},{1749931008,1749933055},{1749938176,1749950463},{1749958912,1749959423},{1749959680,1749962239},{1749962752,1749970943},{1749975040,1749983231},
+	{1749988352,1749990399},{1749991424,1749999615},{1750008320,1750010623},{1750010880,1750028799},{1750058240,1750058495},{1750060544,1750061055},{1750069248,1750153727},{1750154240,1750174207},
+	{1750174720,1750175743},{1750192128,1750201855},{1750221312,1750294015},{1750294528,1750310911},{1750315008,1750320127},{1750321152,1750321663},{1750323200,1750327295},{1750350848,1750351871},
+	{1750372352,1750394367},{1750395904,1750396927},{1750405120,1750415359},{1750417408,1750433791},{1750443264,1750445567},{1750463488,1750482943},{1750491136,1750492671},{1750493184,1750494207},
+	{1750494720,1750503423},{1750514688,1750514943},{1750515200,1750534655},{1750536192,1750544383},{1750573056,1750581247},{1750585344,1750617087},{1750618112,1750626303},{1750635264,1750635519},
+	{1750636544,1750637567},{1750638592,1750650879},{1750654976,1750663167},{1750664192,1750665727},{1750667264,1750675455},{1750679552,1750687743},{1750693376,1750705151},{1750724608,1750757375},
+	{1750761472,1750779903},{1750781440,1750790143},{1750802432,1750806527},{1750807552,1750808575},{1750809088,1750814719},{1750818816,1750838783},{1750839296,1750856703},{1750858240,1750879231},
+	{1750880256,1750899199},{1750900736,1750908927},{1750926336,1750926847},{1750928384,1750929407},{1750937600,1750946815},{1750966272,1750975999},{1750977536,1750978559},{1750986752,1750996991},
+	{1750998528,1751007231},{1751011328,1751016703},{1751016960,1751027711},{1751031808,1751043583},{1751044096,1751060479},{1751061504,1751081215},{1751101440,1751102463},{1751104512,1751105023},
+	{1751121920,1751124479},{1751124736,1751138303},{1751142400,1751143423},{1751144960,1751163647},{1751165184,1751165439},{1751175168,1751175679},{1751176704,1751178751},{1751179264,1751187455},
+	{1751199744,1751203839},{1751204096,1751224319},{1751235584,1751236607},{1751244800,1751256063},{1751257088,1751265279},{1751269376,1751277567},{1751284736,1751289855},{1751293952,1751302655},
+	{1751304192,1751306239},{1751314432,1751333375},{1751333632,1751351807},{1751353344,1751354623},{1751354880,1751355391},{1751378944,1751379199},{1751379456,1751379967},{1751396352,1751426047},
+	{1751474688,1751475199},{1751476224,1751478271},{1751490560,1751500799},{1751501824,1751503103},{1751503360,1751505919},{1751506944,1751508479},{1751508992,1751521535},{1751523328,1751531519},
+	{1751552000,1751560191},{1751576576,1751576831},{1751577856,1751578623},{1751598848,1751621631},{1751625728,1751640319},{1751640576,1751640831},{1751641088,1751641599},{1751642112,1751650303},
+	{1751661056,1751661311},{1751670784,1751681535},{1751682048,1751709183},{1751709696,1751711743},{1751719936,1751728127},{1751744512,1751778303},{1751780352,1751781375},{1751797760,1751798271},
+	{1751799808,1751800319},{1751828480,1751828991},{1751830528,1751856639},{1751858176,1751859199},{1751867392,1751868415},{1751870976,1751873535},{1751874048,1751874559},{1751879680,1751886335},
+	{1751896320,1751896831},{1751897088,1751899135},{1751904256,1751912447},{1751916544,1751928831},{1751946240,1751947263},{1751949312,1751957503},{1751977216,1751977471},{1751987200,1751987455},
+	{1751987712,1752007167},{1752008704,1752010239},{1752018944,1752027135},{1752036352,1752038143},{1752039424,1752047615},{1752056320,1752057855},{1752059904,1752068095},{1752084480,1752085503},
+	{1752087040,1752088575},{1752100864,1752101631},{1752154112,1752172543},{1752174592,1752182783},{1752208896,1752211455},{1752223744,1752228351},{1752228864,1752240127},{1752244224,1752248319},
+	{1752256512,1752269311},{1752270848,1752272383},{1752281088,1752289279},{1752300032,1752300543},{1752318208,1752318463},{1752330240,1752338431},{1752343552,1752345087},{1752350720,1752358911},
+	{1752376320,1752376831},{1752378624,1752378879},{1752387584,1752388607},{1752389632,1752437759},{1752439296,1752440831},{1752449024,1752457215},{1752458240,1752474111},{1752474368,1752494591},
+	{1752494848,1752495615},{1752506368,1752514559},{1752516608,1752518143},{1752518400,1752518655},{1752530944,1752535039},{1752544256,1752544767},{1752555520,1752557567},{1752559616,1752561663},
+	{1752563712,1752564223},{1752565248,1752565503},{1752567040,1752568831},{1752570368,1752570623},{1752570880,1752571903},{1752580096,1752590847},{1752592384,1752600575},{1752608768,1752619007},
+	{1752619264,1752619519},{1752620032,1752621055},{1752637952,1752638463},{1752675840,1752676351},{1752690688,1752692735},{1752696832,1752708607},{1752709120,1752729599},{1752730112,1752730623},
+	{1752731648,1752739839},{1752750080,1752756223},{1752760320,1752768511},{1752778240,1752780287},{1752780800,1752788991},{1752798208,1752820223},{1752821760,1752829951},{1752836096,1752850175},
+	{1752850432,1752862719},{1752875008,1752879103},{1752880128,1752881151},{1752882176,1752882687},{1752887296,1752891391},{1752911872,1752918015},{1752920064,1752929279},{1752931328,1752932351},
+	{1752940544,1752946175},{1752948736,1752952831},{1752969984,1752971263},{1752982528,1753026047},{1753026304,1753042943},{1753043968,1753046271},{1753067520,1753098239},{1753099264,1753100287},
+	{1753108480,1753116671},{1753117184,1753119743},{1753120768,1753133055},{1753157632,1753169919},{1753182208,1753186303},{1753202688,1753210879},{1753223168,1753227263},{1753231360,1753235455},
+	{1753239552,1753243647},{1753251840,1753255935},{1753264128,1753268223},{1753276416,1753280511},{1753284608,1753300991},{1753325568,1753328639},{1753330688,1753332735},{1753350144,1753579519},
+	{1753645056,1753677823},{1754005504,1754071039},{1754169344,1754214399},{1754218496,1754222591},{1754224640,1754225663},{1754225920,1754226431},{1754226688,1754230783},{1754234880,1754243071},
+	{1754251264,1754333183},{1754390528,1754393599},{1754393856,1754394367},{1754529792,1754562559},{1754595328,1754660863},{1754726400,1754791935},{1754803200,1754804223},{1754805248,1754807295},
+	{1754808320,1754810367},{1754819584,1754820607},{1754836992,1754838015},{1754839040,1754841087},{1754845184,1754846207},{1754847232,1754849279},{1754851328,1754852351},{1754854400,1754855423},
+	{1754873856,1754874879},{1754875904,1754876927},{1754877952,1754879999},{1754884864,1754885119},{1754886144,1754888191},{1754907648,1754908671},{1754910720,1754911743},{1754916864,1754918911},
+	{1754923008,1755054079},{1755066368,1755070463},{1755074560,1755078655},{1755103232,1755119615},{1755250688,1755283455},{1755324416,1755328511},{1755357184,1755365375},{1755373568,1755374079},
+	{1755374336,1755447295},{1755578368,1755709439},{1755725824,1755742207},{1755774976,1755783167},{1755799552,1755807743},{1755824128,1755906047},{1756037120,1756041215},{1756065792,1756071935},
+	{1756078080,1756079103},{1756079360,1756080383},{1756080640,1756082175},{1756086272,1756090367},{1757413376,1757415423},{1757420544,1757421567},{1757433856,1757435903},{1757438976,1757439999},
+	{1757455360,1757456383},{1757457408,1757458431},{1757480960,1757481983},{1757486080,1757487103},{1757489152,1757490175},{1757491200,1757493247},{1757506560,1757507583},{1757509632,1757510655},
+	{1757512704,1757513727},{1757514752,1757515775},{1757523968,1757527039},{1757528064,1757529087},{1757536256,1757538303},{1757544448,1757552639},{1757560832,1757569023},{1757581312,1757582335},
+	{1757584384,1757585407},{1757593600,1757609983},{1757626368,1757642751},{1757675520,1757937663},{1757941760,1757945855},{1757954048,1757954559},{1757954816,1757955071},{1757956096,1757956607},
+	{1757957632,1757957887},{1757970432,1757982719},{1757986816,1758003199},{1758019584,1758035967},{1758068736,1758199807},{1758330880,1758396415},{1758404608,1758420991},{1758429184,1758437375},
+	{1758457856,1758458879},{1758986240,1759117311},{1759119360,1759121407},{1759129600,1759133695},{1759141888,1759143167},{1759143424,1759143935},{1759158272,1759160319},{1759166464,1759168511},
+	{1759182848,1759183871},{1759184384,1759184895},{1759186944,1759187967},{1759193088,1759194111},{1759197184,1759199231},{1759201280,1759202303},{1759236096,1759238143},{1759241216,1759244287},
+	{1759246336,1759247359},{1759379456,1759383551},{1759387648,1759391743},{1759404032,1759408127},{1759412224,1759436799},{1759444992,1759526911},{1759531008,1759535103},{1759543296,1759559679},
+	{1759576064,1759609087},{1759612928,1759617023},{1759629312,1759629567},{1759630592,1759630847},{1759631360,1759632383},{1759635456,1759637503},{1759707136,1759768575},{1760034816,1760038911},
+	{1760043008,1760047103},{1760089088,1760090111},{1760090368,1760090623},{1760100352,1760165887},{1760296960,1760366591},{1760374784,1760378879},{1760382976,1760387071},{1760395264,1760411647},
+	{1760414464,1760414719},{1760421888,1760422143},{1760422400,1760422655},{1760423168,1760423423},{1760424192,1760424447},{1760428032,1760436735},{1760439552,1760440319},{1760441088,1760441343},
+	{1760442880,1760443391},{1760444416,1760493567},{1760526336,1760559103},{1760759808,1760767999},{1760804864,1760808959},{1760817152,1760820223},{1760820480,1760820735},{1760821248,1760823295},
+	{1760831488,1760833535},{1760834816,1760835071},{1760835328,1760837631},{1760839680,1760840703},{1760851968,1760854015},{1760860160,1760862207},{1760888832,1760890879},{1760896256,1760896511},
+	{1760897024,1760899071},{1760900096,1760901119},{1760909312,1760910335},{1760911360,1760914431},{1760918528,1760919551},{1760923648,1760924671},{1760937984,1760938751},{1760948224,1760950271},
+	{1761017856,1761026047},{1761034240,1761034495},{1761036288,1761038335},{1761040384,1761041663},{1761042432,1761050623},{1761067008,1761075199},{1761181696,1761198079},{1761224704,1761225471},
+	{1761239040,1761241343},{1761241600,1761242111},{1761244416,1761247231},{1761255424,1761260543},{1761260800,1761261055},{1761261312,1761261823},{1761262080,1761263615},{1761271808,1761279999},
+	{1761300480,1761300991},{1761301504,1761302271},{1761302784,1761303039},{1761303296,1761303807},{1761308672,1761312767},{1761326080,1761327103},{1761327616,1761328127},{1761328640,1761328895},
+	{1761333248,1761337343},{1761340416,1761341439},{1761345536,1761478655},{1761490944,1761491199},{1761491712,1761492991},{1761497088,1761501183},{1761505280,1761507327},{1761524736,1761525759},
+	{1761527808,1761528831},{1761529600,1761529855},{1761530880,1761531391},{1761531648,1761531903},{1761536000,1761538047},{1761539072,1761540095},{1761544192,1761546239},{1761556480,1761560575},
+	{1761566720,1761568767},{1761576960,1761577983},{1761581056,1761583103},{1761585920,1761586431},{1761589248,1761590271},{1761591296,1761593343},{1761598464,1761601535},{1790443520,1790445567},
+	{1790517248,1790525439},{1790578688,1790582783},{1790603264,1790607359},{1790644224,1790654463},{1790662656,1790666751},{1795223040,1795223295},{1795555328,1795620863},{1796472832,1796734975},
+	{1804861440,1804992511},{1804994560,1804996607},{1804998912,1804999167},{1804999936,1805000703},{1805008896,1805010943},{1805017088,1805025279},{1805029888,1805030399},{1805037824,1805038079},
+	{1805041664,1805049855},{1805058048,1805074431},{1805090816,1805123583},{1805148160,1805152255},{1805156352,1805254655},{1805320192,1805369343},{1805516800,1805582335},{1805647872,1805713407},
+	{1805717504,1805721855},{1805725696,1805737983},{1805742080,1805746175},{1805750272,1805754367},{1805758208,1805762559},{1805774848,1805778943},{1805910016,1806131199},{1806147584,1806155775},
+	{1806163968,1806368767},{1806434304,1806827519},{1806839808,1806840831},{1806843392,1806925823},{1806958592,1806991359},{1807040512,1807044607},{1807052800,1807073279},{1807093760,1807097855},
+	{1807118336,1807124479},{1807130624,1807138815},{1807147008,1807151103},{1807155200,1807220735},{1807351808,1807482879},{1807550976,1807551487},{1807556608,1807564799},{1807581184,1807597567},
+	{1807646720,1807650815},{1807654912,1807659007},{1807671296,1807673343},{1807687680,1807695871},{1807704064,1807712255},{1807724544,1807728639},{1815805952,1815810047},{1815826432,1815830527},
+	{1815847168,1815847423},{1815848704,1815848959},{1815849728,1815850239},{1815850752,1815851007},{1815904256,1815912447},{1815920640,1815928831},{1815937024,1816068095},{1822449664,1822453759},
+	{1822461952,1822462975},{1822465024,1822466047},{1822474240,1822478335},{1822507008,1822509055},{1822523392,1822531583},{1822535680,1822539775},{1822605312,1822621695},{1822654464,1822687231},
+	{1822752768,1822851071},{1822859264,1822877695},{1822882816,1822883327},{1822916608,1822932991},{1822982144,1823014911},{1823080448,1823096831},{1823129600,1823145983},{1823154176,1823162367},
+	{1823170560,1823174655},{1823178752,1823183359},{1823186688,1823203327},{1823207424,1823211519},{1823342592,1823346687},{1823354880,1823358975},{1823379456,1823383551},{1823391744,1823395839},
+	{1823408128,1823412223},{1823420416,1823420927},{1823421440,1823421695},{1823423488,1823424511},{1823444992,1823453183},{1823461376,1823465471},{1823539200,1823621119},{1823686656,1823703039},
+	{1823719424,1823735807},{1824129024,1824260095},{1826947072,1826979839},{1833181184,1833183231},{1833189376,1833191423},{1833193472,1833195519},{1833213952,1833215999},{1833222144,1833224191},
+	{1833228288,1833230335},{1833252864,1833253887},{1833304064,1833306111},{1833306368,1833308159},{1833312256,1833316351},{1833338880,1833340927},{1833365504,1833367551},{1833400320,1833402367},
+	{1833410816,1833411071},{1833411584,1833411839},{1833474048,1833474559},{1833517056,1833521151},{1833541632,1833545727},{1833558016,1833562111},{1833615360,1833619455},{1833627648,1833631743},
+	{1833674752,1833676799},{1833689088,1833691135},{1834913792,1834917887},{1834932224,1834933247},{1834933760,1834934271},{1834995712,1834997759},{1835370496,1835370751},{1835548672,1835565055},
+	{1835704320,1835712511},{1835827200,1835835391},{1835903232,1835903487},{1835911168,1835913215},{1835917312,1835925503},{1836616192,1836616447},{1836616704,1836616959},{1836625920,1836626175},
+	{1836626944,1836627967},{1836793856,1836810239},{1839456256,1839460351},{1839726592,1839759359},{1839792128,1839816703},{1840152576,1840185343},{1841688576,1841690623},{1841782784,1841790975},
+	{1841823744,1841831935},{1841872896,1841881087},{1841922048,1841930239},{1841979392,1841983487},{1842044928,1842053119},{1842176000,1842178047},{1842191616,1842191871},{1842192128,1842192383},
+	{1842196480,1842198527},{1842201600,1842202623},{1842257920,1842266111},{1843658752,1843675135},{1843691520,1843707903},{1843839744,1843839999},{1843840768,1843841023},{1843847168,1843851263},
+	{1843854336,1843855359},{1843978240,1843980287},{1844017152,1844021247},{1844025344,1844027391},{1844060160,1844062207},{1844090880,1844092927},{1844098688,1844098815},{1844129792,1844131839},
+	{1844135936,1844137983},{1844150272,1844152319},{1844154368,1844156415},{1844187136,1844188415},{1844188672,1844190207},{1844203520,1844207615},{1844235776,1844236031},{1844252672,1844255743},
+	{1844276224,1844277247},{1844297728,1844301823},{1844314112,1844318207},{1844326400,1844330495},{1844342784,1844345855},{1844391936,1844396031},{1844400128,1844404223},{1845026304,1845026559},
+	{1845033472,1845033727},{1845766144,1845768191},{1847735296,1847736319},{1847754752,1847787519},{1848378368,1848378623},{1848381440,1848382463},{1848832000,1848836095},{1850507264,1850509311},
+	{1856245504,1856245759},{1860727808,1860728831},{1866760192,1866792959},{1868209920,1868210175},{1870049280,1870053375},{1870503936,1870505983},{1876765696,1876766719},{1876893696,1876901887},
+	{1876942848,1876946943},{1884160000,1884164095},{1884172288,1884172543},{1886081792,1886082047},{1886988544,1886988799},{1887010816,1887019007},{1888067584,1888071679},{1888270336,1888271359},
+	{1893670912,1893675007},{1897143296,1897144319},{1897176064,1897176319},{1897176576,1897176831},{1897259008,1897260031},{1897660416,1897725951},{1897783808,1897784063},{1897784320,1897785855},
+	{1897787392,1897789439},{1899267072,1899267327},{1899267840,1899268095},{1899270144,1899271167},{1908408320,1908424703},{1908763136,1908763391},{1909137408,1909161983},{1909735424,1909735935},
+	{1909737728,1909737983},{1909738496,1909739007},{1914567680,1914568703},{1914687488,1914688511},{1919909888,1919910399},{1919910912,1919911423},{1919912960,1919913471},{1920007936,1920008191},
+	{1920102400,1920104447},{1921867776,1921871359},{1921871872,1921875967},{1921892352,1921896447},{1936711424,1936711679},{1937514496,1937516543},{1937530880,1937536511},{1937537024,1937539071},
+	{1941049344,1941051391},{1946161152,1946163199},{1949448192,1949450239},{1949499392,1949564927},{1950015488,1950023679},{1950538752,1950539775},{1952051200,1952052223},{1952053248,1952054271},
+	{1952264704,1952264959},{1953955840,1953988863},{1954938880,1955004415},{1956052992,1956118527},{1956249600,1956511743},{1958845440,1958846463},{1958848512,1958849535},{1959102464,1959104511},
+	{1959675904,1959676927},{1959681024,1959681535},{1959683072,1959684095},{1964130304,1964134399},{1964139264,1964139775},{1964140288,1964140543},{1964142080,1964142335},{1964255232,1964255743},
+	{1966446592,1966447615},{1966473216,1966538751},{1966735360,1966768127},{1969729536,1969733631},{1969766400,1969790975},{1970800640,1970802687},{1970925568,1970925823},{1970926080,1970926335},
+	{1984135168,1984151551},{1985482752,1985484799},{1985719552,1985720063},{1985732608,1985732863},{1988034560,1988050943},{1988861952,1988870143},{1989662720,1989662975},{1991770112,1991802879},
+	{1992392704,1992425471},{1993752576,1993756671},{1993760768,1993764863},{1993777152,1993777663},{1993778432,1993778687},{1993778944,1993779199},{1993779968,1993780223},{1993780480,1993780735},
+	{1993781248,1993783807},{1993784320,1993785087},{1993785344,1993793535},{1993797632,1993801727},{1993803776,1993805823},{1993807872,1993811967},{1993814016,1993820159},{1993834496,1993838591},
+	{1993844736,1993850879},{1996630016,1996632063},{1997242880,1997243391},{1997252608,1997254655},{1997680640,1997684735},{1997723648,1997725695},{1998454784,1998455807},{1998487552,1998503935},
+	{1998577664,1998579711},{1999254528,1999255551},{2000668928,2000669183},{2000669696,2000669951},{2000670208,2000670719},{2001797120,2001862655},{2001899520,2001901567},{2003722240,2003726335},
+	{2007031808,2007032831},{2007033344,2007035903},{2007065600,2007068671},{2011947264,2011949055},{2011949312,2011949823},{2011950592,2011951103},{2013003776,2013011967},{2013048832,2013049855},
+	{2013050880,2013052927},{2015203328,2015205375},{2015207424,2015223807},{2019045376,2019049471},{2019344384,2019346431},{2021687296,2021851135},{2033336320,2033352703},{2033363200,2033363711},
+	{2033364736,2033364991},{2033502976,2033503231},{2033630208,2033631231},{2035154944,2035189759},{2035204096,2035220479},{2036633344,2036633599},{2036705280,2036707327},{2043162112,2043162367},
+	{2046052864,2046053375},{2046068736,2046069247},{2046077952,2046078463},{2046082560,2046083071},{2046086144,2046086655},{2046820352,2046822399},{2047496192,2047500287},{2047500800,2047501055},
+	{2047502080,2047502335},{2047504384,2047506431},{2047771648,2047771903},{2050048000,2050060287},{2050084864,2050088959},{2050129664,2050129919},{2053332992,2053335039},{2053337088,2053339135},
+	{2053373952,2053374975},{2053375488,2053376511},{2053377792,2053378047},{2054187008,2054188031},{2055233536,2055234047},{2055234304,2055234559},{2055235840,2055236607},{2055237120,2055237631},
+	{2056273920,2056290303},{2060009472,2060025855},{2060079104,2060083199},{2063122432,2063138815},{2063335424,2063339519},{2063345664,2063347711},{2063552512,2063556607},{2063632896,2063633151},
+	{2069655552,2069659647},{2070209280,2070209535},{2070211072,2070211327},{2070355712,2070355967},{2070409216,2070413311},{2070683648,2070691839},{2070703104,2070705151},{2070705664,2070705919},
+	{2070708224,2070708735},{2070712320,2070714367},{2072530944,2072535039},{2075156480,2075156735},{2075156992,2075157247},{2075157504,2075158527},{2079514624,2079516671},{2079522816,2079588351},
+	{2080270336,2080274431},{2080872704,2080872959},{2082996224,2083012607},{2083491584,2083491839},{2083492864,2083493375},{2084896768,2084962303},{2085027840,2085093375},{2087458048,2087458303},
+	{2087460864,2087462911},{2087472128,2087472639},{2087518208,2087519231},{2090241536,2090241791},{2090247424,2090247679},{2090248704,2090249727},{2090418176,2090434559},{2090582016,2090582271},
+	{2096676864,2096693247},{2097610752,2097611007},{2097614848,2097615103},{2097618176,2097618431},{2097641472,2097641727},{2100856832,2100860927},{2100865024,2100867071},{2100869120,2100870143},
+	{2100873216,2100873983},{2100874240,2100874495},{2100875776,2100876031},{2100876288,2100877567},{2100877824,2100879103},{2100879360,2100883455},{2107639296,2107639551},{2107642112,2107642367},
+	{2107643904,2107645951},{2107650048,2107651583},{2107668480,2107669503},{2107682816,2107683071},{2107684864,2107686911},{2107693056,2107693311},{2107701248,2107701503},{2107703296,2107707391},
+	{2107712512,2107713023},{2107714048,2107714303},{2107724288,2107725311},{2107737088,2107737343},{2107737600,2107738111},{2107746304,2107747071},{2107753984,2107754495},{2107764736,2107765247},
+	{2107767808,2107768063},{2107785216,2107790335},{2107790848,2107791871},{2107792384,2107794431},{2107813888,2107815935},{2107833344,2107834367},{2107852800,2107853311},{2107853824,2107855359},
+	{2107855872,2107856383},{2107865088,2107869183},{2107891200,2107891711},{2107940864,2107949055},{2107957248,2107959295},{2110834688,2110836735},{2113724416,2113724671},{2113725184,2113725439},
+	{2113761280,2113765375},{2113811456,2113812479},{2134015744,2134015999},{2147483904,2147484159},{2147491840,2147493887},{2147495424,2147495935},{2147501056,2147501311},{2147501568,2147502079},
+	{2147513344,2147514879},{2147515136,2147516415},{2147549184,2147614719},{2148401152,2148466687},{2151772160,2151776255},{2151795712,2151795967},{2153382144,2153383167},{2153383424,2153383679},
+	{2153383936,2153384191},{2153384448,2153388543},{2153389824,2153390079},{2153391360,2153391615},{2153391872,2153394431},{2153396992,2153398271},{2153400320,2153400831},{2153404416,2153406463},
+	{2153407744,2153408511},{2153408768,2153410047},{2153410560,2153411839},{2153412096,2153412351},{2153413120,2153413631},{2153421312,2153422335},{2153446144,2153447167},{2154561536,2154627071},
+	{2155413504,2155479039},{2155833344,2155835391},{2156273664,2156274943},{2156713984,2156715007},{2159121408,2159121663},{2160533504,2160590847},{2163277824,2163408895},{2166423552,2166489087},
+	{2166570496,2166571007},{2166594816,2166595583},{2166599680,2166601471},{2166603264,2166603775},{2166607872,2166609919},{2166612480,2166612991},{2166615040,2166616063},{2166618112,2166620159},
+	{2166947840,2167013375},{2167017984,2167020031},{2167341056,2167406591},{2169176064,2169192703},{2169193216,2169193471},{2169194496,2169204735},{2169206784,2169210879},{2169211904,2169212927},
+	{2169214976,2169217023},{2169219072,2169221119},{2169225216,2169241599},{2173050880,2173087743},{2173095936,2173097983},{2173100032,2173108223},{2176843776,2176909311},{2179346176,2179346431},
+	{2180644864,2180710399},{2181038080,2181040127},{2181089280,2181091327},{2181097472,2181099519},{2183414784,2183415807},{2183434496,2183434751},{2187198464,2187263999},{2188738048,2188738303},
+	{2192885760,2192887807},{2193188864,2193190911},{2193195008,2193203199},{2193205760,2193207295},{2193223168,2193223423},{2193225984,2193226751},{2193227520,2193227775},{2193690624,2193690879},
+	{2193707008,2193711103},{2194014208,2194079743},{2194866176,2194931711},{2195587072,2195652607},{2197768192,2197770239},{2197790720,2197792767},{2197796864,2197798911},{2197833728,2197834751},
+	{2197837824,2197838847},{2197852160,2197853183},{2197855232,2197856511},{2197856768,2197857279},{2204368896,2204369919},{2204427264,2204427519},{2204427776,2204428287},{2204565504,2204631039},
+	{2207842304,2207907839},{2208385792,2208386047},{2209399808,2209400319},{2209410560,2209410815},{2209412096,2209414399},{2210704384,2210705407},{2210724864,2210725887},{2210776576,2210776831},
+	{2212310016,2212311039},{2212760576,2212761599},{2212779520,2212780031},{2212788224,2212790271},{2212791296,2212791551},{2214411264,2214411775},{2214562816,2214563839},{2224291840,2224357375},
+	{2226716672,2226782207},{2227052544,2227052799},{2227072512,2227072767},{2229207040,2229239807},{2230181888,2230182143},{2230187776,2230188031},{2231312384,2231313407},{2248153088,2248155135},
+	{2248671744,2248671999},{2249435136,2249436159},{2249437184,2249441279},{2254504960,2254505215},{2255945728,2256011263},{2256553984,2256555007},{2257765632,2257765887},{2259156992,2259173375},
+	{2259615744,2259681279},{2264903680,2264905727},{2264913920,2264920319},{2264923136,2264924159},{2270442496,2270443519},{2270453760,2270454015},{2270460928,2270461183},{2270474240,2270476799},
+	{2270482432,2270484479},{2270484736,2270484991},{2270488576,2270490623},{2281701376,2281766911},{2291142656,2291144447},{2291146752,2291147775},{2291148800,2291154943},{2297626624,2297692159},
+	{2298413056,2298478591},{2302372864,2302373887},{2302409728,2302410751},{2302607360,2302623743},{2302625280,2302625535},{2303328256,2303393791},{2306211840,2306277375},{2308440064,2308505599},
+	{2309947392,2309980159},{2317585920,2317586175},{2317590016,2317591039},{2319126528,2319127551},{2319156224,2319157247},{2319712256,2319777791},{2321774592,2321775615},{2321780736,2321780991},
+	{2321784832,2321785855},{2321797120,2321797375},{2321797632,2321798143},{2322081792,2322082047},{2322127872,2322128127},{2322128384,2322128639},{2322129408,2322129919},{2322130688,2322131199},
+	{2322348032,2322348543},{2322973696,2322974719},{2323236864,2323237887},{2323308800,2323309055},{2323309312,2323309567},{2323310592,2323311615},{2323644416,2323677183},{2323679232,2323702783},
+	{2327481344,2327481599},{2327496960,2327497215},{2328166400,2328229887},{2328230912,2328231935},{2328313856,2328317695},{2328343296,2328343551},{2328428544,2328494079},{2328668160,2328669183},
+	{2328690688,2328692735},{2328731648,2328735743},{2329614336,2329615359},{2330267648,2330271743},{2332374016,2332375039},{2332405760,2332406783},{2332418048,2332418559},{2333966080,2333966335},
+	{2335899648,2335965183},{2338521088,2338586623},{2340421632,2340487167},{2341273600,2341339135},{2341863424,2341928959},{2342649856,2342715391},{2342977536,2342981631},{2342985728,2342994175},
+	{2343667968,2343668223},{2343668480,2343668735},{2343676416,2343676671},{2343931136,2343931391},{2355321856,2355331071},{2360213504,2360279039},{2361017856,2361018111},{2364676864,2364677119},
+	{2364680960,2364681215},{2364681728,2364681983},{2364724224,2364724735},{2365589504,2365593599},{2365628416,2365632511},{2366144512,2366160895},{2366963712,2367029247},{2371814400,2371814655},
+	{2372222976,2372239359},{2372240896,2372241407},{2372243200,2372244479},{2372245504,2372248319},{2372249856,2372250367},{2372264960,2372265215},{2372265728,2372265983},{2372485120,2372487167},
+	{2373037568,2373037823},{2374500352,2374502399},{2374504448,2374508543},{2374524928,2374529023},{2374684672,2374686719},{2380432640,2380432895},{2382340096,2382342143},{2382344192,2382348287},
+	{2382372864,2382376959},{2382381056,2382385151},{2382397440,2382401535},{2382411776,2382412799},{2382426112,2382430207},{2382635008,2382643199},{2382651392,2382659583},{2382667776,2382673919},
+	{2382675968,2382684159},{2383134720,2383151103},{2383413248,2383478783},{2383623168,2383625215},{2385281024,2385313791},{2385936384,2385944575},{2385966080,2385966591},{2385966848,2385967103},
+	{2388328448,2388393983},{2389311488,2389442559},{2389639168,2389704703},{2391010816,2391011327},{2391015424,2391080959},{2391539712,2391801855},{2392013824,2392014079},{2392019456,2392019967},
+	{2392020992,2392021503},{2392022528,2392023039},{2392195072,2392326143},{2392850432,2392981503},{2396454912,2396520447},{2397634560,2397765631},{2398748672,2398945279},{2405376000,2405384191},
+	{2405414912,2405416959},{2408131584,2408132607},{2408147968,2408148991},{2411659264,2411724799},{2412421120,2412422143},{2412424192,2412425215},{2412775424,2412776447},{2413756928,2413757183},
+	{2415132672,2415198207},{2415867904,2415868927},{2415904768,2415905791},{2416050176,2416050943},{2416051968,2416052223},{2416099328,2416099583},{2416111616,2416113663},{2418278400,2418343935},
+	{2419065856,2419066367},{2419066880,2419067903},{2419073024,2419075071},{2419086080,2419086335},{2419092224,2419092479},{2419100672,2419101695},{2419121152,2419122175},{2419126272,2419127295},
+	{2419163136,2419179519},{2420899840,2420965375},{2426937344,2426941439},{2426943488,2426945535},{2426961920,2426994687},{2427208704,2427210495},{2427214336,2427214591},{2429550592,2429550847},
+	{2429554688,2429556735},{2429564928,2429571071},{2429578496,2429578751},{2429580288,2429582335},{2429582848,2429616127},{2430140416,2430205951},{2433650688,2433651199},{2433653760,2433654783},
+	{2436632576,2436634623},{2436759808,2436760063},{2436761088,2436761343},{2436767744,2436775935},{2438455296,2438463487},{2447441920,2447507455},{2448359424,2448424959},{2449041408,2449042431},
+	{2449440768,2449442815},{2449465344,2449467391},{2449473536,2449477631},{2449481728,2449485823},{2449491968,2449494015},{2449530880,2449539071},{2450784256,2450849791},{2454126592,2454138879},
+	{2454146048,2454147071},{2454148096,2454148351},{2454650880,2454716415},{2454884864,2454885375},{2454978560,2455000063},{2455246848,2455247871},{2455248128,2455248383},{2455273472,2455275519},
+	{2455279616,2455281663},{2455289856,2455290879},{2457366016,2457366271},{2457376768,2457380863},{2457387008,2457388031},{2457401344,2457402367},{2459172864,2459238399},{2461078528,2461078783},
+	{2461599744,2461605887},{2461630464,2461663231},{2462337024,2462338047},{2462339072,2462340095},{2465667072,2465668095},{2466193408,2466201599},{2469527552,2469593087},{2471174144,2471194623},
+	{2471198720,2471200255},{2471215104,2471219199},{2472144896,2472145919},{2473982976,2473983231},{2475098112,2475163647},{2478244096,2478244607},{2482176000,2482184191},{2482184960,2482185727},
+	{2482186240,2482187007},{2482187520,2482188031},{2482188288,2482188543},{2482190336,2482190591},{2482191104,2482191359},{2482191872,2482233343},{2482234880,2482235135},{2482239488,2482241535},
+	{2482962432,2483027967},{2483486720,2483552255},{2486939648,2486940159},{2486946816,2486947071},{2486952960,2486953471},{2486953984,2486955007},{2487091200,2487156735},{2487222528,2487222783},
+	{2487386112,2487394303},{2487746560,2487812095},{2493710336,2493743103},{2493759488,2493775871},{2498969600,2498973695},{2499477504,2499543039},{2499946496,2499948543},{2499971840,2499972095},
+	{2500034560,2500038655},{2500141568,2500141823},{2500144896,2500145151},{2500155648,2500155903},{2500202496,2500202751},{2500320512,2500321279},{2500702720,2500702975},{2501392384,2501392639},
+	{2501406720,2501407743},{2501412352,2501414911},{2501437440,2501437695},{2501437952,2501438463},{2501643264,2501644287},{2502164480,2502165503},{2502180864,2502181119},{2502917120,2502926335},
+	{2503360512,2503368703},{2503378944,2503380991},{2503383040,2503385087},{2503396352,2503397375},{2503402496,2503403519},{2503475200,2503540735},{2503905280,2503907327},{2503911424,2503913471},
+	{2504482816,2504484863},{2504499200,2504500223},{2504769536,2504785919},{2505789440,2505790463},{2505791488,2505792511},{2505932800,2505949183},{2506400768,2506401279},{2507277312,2507341823},
+	{2507350016,2507354111},{2508120064,2508128255},{2508631808,2508632063},{2509373440,2509438975},{2509936640,2509938687},{2511208448,2511273983},{2513043456,2513108991},{2515206144,2515271679},
+	{2515312640,2515320831},{2516058112,2516123647},{2516525056,2516527103},{2516541440,2516545535},{2516547584,2516549631},{2516563968,2516566015},{2521169920,2521235455},{2523606016,2523607039},
+	{2523614208,2523615231},{2525036544,2525037567},{2525044736,2525045247},{2525056000,2525058047},{2525071360,2525071871},{2525072128,2525072383},{2525095936,2525096959},{2525097984,2525099007},
+	{2525101056,2525102079},{2530246912,2530247167},{2530558208,2530558463},{2531655680,2531721215},{2532445184,2532446207},{2532451328,2532452351},{2532477952,2532478975},{2532493312,2532494335},
+	{2532500480,2532501503},{2538602496,2538668031},{2539126784,2539192319},{2539388928,2539454463},{2539978752,2540044287},{2542471936,2542473471},{2542473728,2542474751},{2543093504,2543094015},
+	{2543344640,2543345151},{2544229376,2544229887},{2544698880,2544699135},{2548826112,2548831743},{2548832000,2548842495},{2548881408,2548883455},{2548936704,2548940799},{2549706752,2549708799},
+	{2549709824,2549710591},{2549874688,2549876735},{2554554112,2554554367},{2557673472,2557739007},{2560819200,2560884735},{2562867200,2562868735},{2562869248,2562870271},{2562871296,2562872319},
+	{2572943360,2572947455},{2572950272,2572950527},{2572954112,2572954367},{2572996608,2572997631},{2583560192,2583691263},{2583724032,2583728127},{2584608768,2584805375},{2585985024,2586050559},
+	{2586716928,2586717183},{2586956544,2586957311},{2587681792,2587682815},{2587700736,2587700991},{2588317696,2588319999},{2588330240,2588330495},{2588459008,2588467199},{2588505600,2588505855},
+	{2588999680,2589523967},{2589589504,2589655039},{2589720576,2589982719},{2592026624,2592030719},{2597322752,2598371327},{2600730624,2600796159},{2604728320,2604736511},{2606454784,2606455039},
+	{2606645248,2606657535},{2606661632,2606694399},{2609194496,2609194751},{2609201152,2609201407},{2609205760,2609206015},{2609233920,2609234431},{2609234688,2609234943},{2617118720,2617123839},
+	{2617124352,2617124607},{2617126912,2617127423},{2617127936,2617130239},{2617139200,2617147391},{2617155584,2617180159},{2617968640,2617970687},{2619179008,2619180031},{2620078848,2620079103},
+	{2621646336,2621646591},{2621663744,2621663999},{2621689856,2621693951},{2632450048,2632974335},{2635857920,2635988991},{2637447168,2637561855},{2640410624,2640411647},{2640413952,2640414463},
+	{2640417024,2640417279},{2641828096,2641828351},{2641847296,2641848319},{2641869824,2641870847},{2642793728,2642793983},{2642800384,2642800639},{2644805632,2644805887},{2646179840,2646196223},
+	{2646413312,2646413567},{2646458368,2646460415},{2646957568,2646957823},{2649178112,2649180159},{2649182208,2649186303},{2649620480,2649686015},{2653847552,2653863935},{2653878784,2653879295},
+	{2654642176,2654646271},{2655322112,2655387647},{2656370688,2656436223},{2657779712,2657780735},{2657878016,2657943551},{2660007936,2660012031},{2660015360,2660016127},{2662203392,2662465535},
+	{2662498304,2662498815},{2662676480,2662678527},{2665377792,2665381887},{2665792000,2665792511},{2667511808,2667513855},{2667522048,2667524095},{2667565056,2667567103},{2667572736,2667572991},
+	{2668101632,2668167167},{2669879296,2669881343},{2669905920,2669907967},{2669910016,2669912063},{2673410048,2673475583},{2674130944,2674139135},{2674163712,2674180095},{2675281920,2675286015},
+	{2675572736,2675638271},{2675948288,2675948543},{2675965952,2675966207},{2676424704,2676441087},{2676482048,2676486143},{2677302784,2677303039},{2677327360,2677328127},{2677628928,2677633023},
+	{2677638144,2677639167},{2677661696,2677735423},{2677929472,2677929727},{2679518720,2679519231},{2680881152,2680946687},{2684157952,2684159999},{2684162048,2684164095},{2684190720,2684198911},
+	{2684203008,2684204543},{2684211200,2684215295},{2684223232,2684223487},{2684338176,2684339199},{2684342272,2684344319},{2685667328,2685669375},{2689337344,2689339391},{2689400320,2689400831},
+	{2689558528,2689558783},{2689564672,2689565183},{2690975744,2690975999},{2694381568,2694447103},{2696151552,2696151807},{2697609216,2697625599},{2697635840,2697636863},{2698214912,2698215167},
+	{2698772480,2698838015},{2701918208,2701983743},{2704211968,2704277503},{2704932864,2704998399},{2709247232,2709247487},{2709247744,2709247999},{2709248256,2709248511},{2709252352,2709252607},
+	{2709786880,2709787135},{2714370048,2714435583},{2716401664,2716467199},{2717253632,2717319167},{2720079872,2720088063},{2725307392,2725307903},{2727346176,2727411711},{2728263680,2728394751},
+	{2731544576,2731545599},{2731547648,2731548671},{2731554304,2731554815},{2731571200,2731572223},{2731606016,2731671551},{2731680768,2731681791},{2731682816,2731684863},{2731689728,2731689983},
+	{2731696128,2731698175},{2731720704,2731722751},{2731735040,2731736063},{2731743232,2731744255},{2731753728,2731754495},{2731757568,2731759615},{2731770880,2731771903},{2731782144,2731783167},
+	{2731794432,2731796479},{2731802624,2731803647},{2731816960,2731817983},{2731835392,2731837439},{2731867136,2731869183},{2731874304,2731879423},{2731883520,2731884543},{2731897856,2731899903},
+	{2731908096,2731909119},{2731917312,2731919359},{2731921408,2731922431},{2731922688,2731923455},{2731931648,2732066815},{2732068864,2732069887},{2732076032,2732077055},{2732089344,2732091391},
+	{2732093440,2732094463},{2732097024,2732097535},{2732102656,2732105727},{2732107776,2732109823},{2732122112,2732124159},{2732137216,2732137983},{2732138240,2732138495},{2732146176,2732146431},
+	{2732154880,2732156927},{2732164096,2732165119},{2732174336,2732175359},{2732181504,2732183551},{2732203008,2732204031},{2732208128,2732210175},{2732218368,2732220415},{2732224512,2732228607},
+	{2732255232,2732257279},{2732261376,2732263423},{2732267520,2732269567},{2732271616,2732273663},{2732292096,2732294143},{2732306432,2732307455},{2732315648,2732316671},{2732318720,2732319743},
+	{2732326912,2732327167},{2732331008,2732333055},{2732333568,2732333823},{2732335104,2732336127},{2732341248,2732343295},{2732367872,2732369919},{2732382208,2732384255},{2732389888,2732390143},
+	{2732392448,2732394495},{2732410880,2732411903},{2732421120,2732422143},{2732427264,2732427519},{2732437504,2732445695},{2732449792,2732450815},{2732470528,2732470783},{2732475392,2732475647},
+	{2732478464,2732479487},{2732480512,2732480767},{2732503040,2732511231},{2732513280,2732514303},{2732515584,2732515839},{2732525568,2732527615},{2732529664,2732529919},{2732530688,2732531711},
+	{2732572672,2732574719},{2732580864,2732582911},{2732699392,2732699647},{2733801472,2733899775},{2733901824,2733903871},{2733905920,2733908991},{2733913088,2733914111},{2733919232,2733920255},
+	{2733933568,2733934591},{2733941760,2733942783},{2733960192,2733961215},{2733965056,2733966335},{2733973504,2733974527},{2733985792,2733989887},{2733995008,2733996031},{2734002176,2734003199},
+	{2734017536,2734018559},{2734020608,2734022655},{2734025728,2734026751},{2734034944,2734036991},{2734044160,2734045183},{2734077952,2734078975},{2734121472,2734122239},{2734125056,2734129151},
+	{2734162944,2734164991},{2734174208,2734175231},{2734180352,2734182399},{2734186240,2734186495},{2734187008,2734188543},{2734196480,2734196735},{2734197760,2734198783},{2734202880,2734204927},
+	{2734207488,2734208255},{2734215168,2734217215},{2734218240,2734219263},{2734221312,2734222335},{2734223360,2734225407},{2734227456,2734229503},{2734231552,2734232575},{2734238720,2734238975},
+	{2734242816,2734243839},{2734259200,2734260223},{2734280704,2734282751},{2734292992,2734295039},{2734312448,2734313471},{2734315520,2734316543},{2734317824,2734318079},{2734323712,2734325759},
+	{2734328832,2734330367},{2734336000,2734338047},{2734341120,2734342143},{2734344192,2734345215},{2734352384,2734353407},{2734375936,2734376959},{2734379008,2734379263},{2734379520,2734379775},
+	{2734380288,2734380543},{2734386176,2734389247},{2734394368,2734394623},{2734395904,2734396415},{2734421504,2734424063},{2734426112,2734427135},{2734428160,2734430207},{2734432256,2734433279},
+	{2734436352,2734437375},{2734438400,2734439423},{2734444544,2734446591},{2734464000,2734465023},{2734467072,2734467583},{2734467840,2734468095},{2734470144,2734471167},{2734473216,2734475263},
+	{2734484480,2734484735},{2734485504,2734486527},{2734497792,2734498815},{2734499840,2734500863},{2734505984,2734506239},{2734506496,2734507007},{2734516224,2734516735},{2734522368,2734523391},
+	{2734526464,2734529535},{2734534656,2734535679},{2734542848,2734544895},{2734546944,2734547967},{2734555136,2734556415},{2734556672,2734557183},{2734557696,2734557951},{2734562304,2734563327},
+	{2734564352,2734565375},{2734567424,2734568447},{2734572800,2734573055},{2734573568,2734575615},{2734588928,2734589951},{2734592000,2734594047},{2734596096,2734598143},{2734603264,2734604287},
+	{2734618624,2734620671},{2734628864,2734629887},{2734638080,2734638591},{2734642176,2734643199},{2734650368,2734651391},{2734655488,2734656511},{2734665472,2734665727},{2734666752,2734667775},
+	{2734670848,2734671871},{2734673920,2734674943},{2734675712,2734675967},{2737768448,2737769471},{2737770496,2737771263},{2737781760,2737782783},{2737784832,2737785855},{2737794048,2737795071},
+	{2737798144,2737799167},{2737812480,2737813503},{2737817600,2737818623},{2737819136,2737819391},{2738216960,2738220031},{2738221056,2738221311},{2738222848,2738223103},{2742486016,2742486271},
+	{2745958400,2746023935},{2746656768,2746658815},{2750218240,2750283775},{2750808064,2750873599},{2759000064,2759008255},{2759025408,2759026175},{2760114176,2760179711},{2760534016,2760536063},
+	{2761955328,2761956351},{2769747968,2769813503},{2773086208,2773090303},{2773803008,2773807103},{2778345472,2778349567},{2780037120,2780038399},{2780039168,2780043263},{2780071936,2780084223},
+	{2780088320,2780088575},{2780096512,2780099583},{2780100608,2780102655},{2782134272,2782199807},{2783010816,2783011583},{2783011840,2783012607},{2783012864,2783013887},{2783117312,2783182847},
+	{2783379456,2783380991},{2783381504,2783381759},{2783382016,2783382271},{2783383040,2783383295},{2783383552,2783383807},{2783384064,2783384319},{2783384576,2783384831},{2783385088,2783385343},
+	{2783386368,2783386623},{2783399936,2783404031},{2784886784,2784952319},{2785017856,2785148927},{2788163584,2788229119},{2789081088,2789113855},{2790129664,2790195199},{2790785024,2790850559},
+	{2790954496,2790954751},{2790963712,2790963967},{2790969510,2790969510},{2792718848,2792720639},{2792721408,2792722431},{2792723968,2792724223},{2792724480,2792724735},{2792751104,2792816639},
+	{2807570432,2807574527},{2807586816,2807594495},{2807602688,2807602943},{2807603712,2807604223},{2807605248,2807606271},{2807607296,2807608319},{2807656704,2807656959},{2807685120,2807693311},
+	{2809266176,2809331711},{2812283648,2812283903},{2812284160,2812284415},{2812286464,2812286975},{2812287232,2812287487},{2812287744,2812287999},{2812290048,2812290303},{2812297728,2812298239},
+	{2812302336,2812303359},{2812305408,2812313599},{2812321792,2812323839},{2812326400,2812329983},{2817325056,2817325311},{2818161664,2818162687},{2818185216,2818186239},{2818637824,2818703359},
+	{2823716864,2823749631},{2824929280,2824994815},{2826338304,2826371071},{2826960896,2826971135},{2826973184,2826977279},{2826981376,2826987519},{2826991616,2826993663},{2826997760,2826999807},
+	{2827024640,2827025919},{2827026176,2827026431},{2827550720,2827616255},{2827943936,2828075007},{2828599296,2828599551},{2829174784,2829175039},{2829175808,2829176063},{2830453760,2830454783},
+	{2830457856,2830458879},{2831305728,2831306751},{2831336448,2831337471},{2832860928,2832861183},{2833458176,2833459199},{2833989632,2833999871},{2834010112,2834014207},{2834022400,2834026495},
+	{2834030592,2834034687},{2834186240,2834187263},{2837839872,2837905407},{2838233088,2838560767},{2838626304,2838757375},{2838822912,2839150591},{2839281664,2839543807},{2844877824,2844878591},
+	{2844880896,2844881151},{2848211968,2848212479},{2849112064,2849177599},{2851049472,2851050495},{2851064320,2851064831},{2851471360,2851864575},{2852079616,2852079871},{2852823040,2852827135},
+	{2857078784,2857082879},{2857610240,2857611263},{2857689088,2857690111},{2858434560,2858442751},{2858479616,2858483711},{2859532288,2859597823},{2859614208,2859630591},{2860646400,2860711935},
+	{2861301760,2861367295},{2861979648,2861980671},{2861998080,2861999103},{2863828992,2863830015},{2863833088,2863849471},{2866847232,2866847487},{2866847744,2866852863},{2866860032,2866860543},
+	{2866896128,2866896639},{2866896896,2866901759},{2866918912,2866919423},{2866920448,2866921471},{2866931200,2866931711},{2866935296,2866935807},{2866947840,2866948095},{2868148224,2868150271},
+	{2868230144,2868231167},{2868272128,2868273151},{2868379648,2868380159},{2868382720,2868383231},{2868383744,2868385023},{2868390400,2868390911},{2868391424,2868392447},{2868411392,2868411647},
+	{2868414976,2868415487},{2868416768,2868417535},{2868418816,2868419071},{2868420608,2868421119},{2868421632,2868423679},{2868427776,2868428799},{2868578816,2868579327},{2868581376,2868581887},
+	{2868582144,2868582399},{2868585984,2868589055},{2868591616,2868592127},{2868597760,2868598271},{2868598784,2868599295},{2868599808,2868600319},{2868602880,2868603391},{2868604416,2868604927},
+	{2868605952,2868606207},{2868612608,2868613119},{2868613888,2868614143},{2868614400,2868617215},{2868618240,2868618751},{2868619776,2868620287},{2868620800,2868621311},{2868621568,2868621823},
+	{2868682496,2868682751},{2868701184,2868701439},{2868833280,2868834303},{2870228224,2870228991},{2870599936,2870600191},{2871103488,2871103999},{2889875456,2890399743},{2890989568,2891005951},
+	{2891014144,2891014399},{2891014656,2891015167},{2891015424,2891016447},{2891016960,2891018239},{2891019264,2891024383},{2891027456,2891028479},{2891036672,2891037695},{2891055104,2891104255},
+	{2891276288,2891280383},{2891342848,2891343871},{2891346688,2891346943},{2891347968,2891350015},{2891354112,2891355647},{2891364352,2891366399},{2891388928,2891390975},{2891784192,2891790335},
+	{2891800576,2891804671},{2891806720,2891807743},{2891821056,2891824127},{2891836416,2891836671},{2891841536,2891841791},{2891842304,2891843327},{2891846912,2891847167},{2891848448,2891849471},
+	{2891849984,2891850239},{2891850496,2891853311},{2891853568,2891853823},{2891854336,2891858431},{2891859200,2891859967},{2891860224,2891861759},{2891862528,2891863039},{2891863296,2891870207},
+	{2891870464,2891870975},{2891871232,2891871743},{2891874048,2891874303},{2891981824,2891982079},{2891984896,2891986943},{2892001792,2892003327},{2892004352,2892004863},{2892005376,2892021759},
+	{2892054528,2892055807},{2892056064,2892056319},{2892058624,2892062719},{2892103680,2892128255},{2892144640,2892144895},{2892145152,2892146175},{2892146432,2892146687},{2892147200,2892148223},
+	{2892148992,2892149503},{2892150016,2892150271},{2892150528,2892152063},{2892152576,2892155903},{2892157440,2892158463},{2892158720,2892158975},{2892161024,2892165119},{2892175104,2892175359},
+	{2892185600,2892234751},{2892366848,2892369919},{2892398592,2892402687},{2892414976,2892420095},{2892420352,2892420607},{2892421120,2892423167},{2892425216,2892427263},{2892447744,2892464127},
+	{2892496896,2892759039},{2892890112,2892890367},{2892891136,2892893183},{2892893440,2892893695},{2892893952,2892900351},{2892904448,2892905471},{2892914688,2892939263},{2892943360,2892947455},
+	{2892955648,2892994047},{2892994304,2892994559},{2892994816,2892996095},{2892996864,2892998143},{2892998400,2892999423},{2892999936,2893000191},{2893000448,2893000959},{2893001216,2893003007},
+	{2893003264,2893003775},{2893004032,2893005311},{2893005568,2893005823},{2893006080,2893006335},{2893006592,2893006847},{2893007104,2893007615},{2893007872,2893009151},{2893009664,2893010687},
+	{2893010944,2893011199},{2893011456,2893011711},{2893011968,2893012223},{2893012480,2893012735},{2893014784,2893015039},{2893015296,2893020159},{2893020416,2893021183},{2893545472,2893676543},
+	{2893836288,2893836799},{2894069760,2898264063},{2898788352,2899574783},{2899902464,2899967999},{2900361216,2900365311},{2900442112,2900443135},{2900456448,2900457471},{2900459520,2900468223},
+	{2900470272,2900470783},{2900508672,2900517887},{2900547584,2900549119},{2900553728,2900557823},{2900560896,2900561919},{2900578304,2900596735},{2900598784,2900606975},{2900682240,2900683775},
+	{2900780032,2900781055},{2900782592,2900783103},{2900792320,2900794367},{2900795392,2900811775},{2900830208,2900831231},{2900840448,2900848127},{2901409792,2901540863},{2901737472,2901934079},
+	{2902196224,2902327295},{2902392832,2902462463},{2902470656,2902474751},{2905341952,2905358335},{2905374720,2905407487},{2905411840,2905412095},{2905416960,2905417215},{2905447936,2905448191},
+	{2905464832,2905473023},{2905493504,2905493759},{2905494272,2905494527},{2905494784,2905495039},{2907832320,2907897855},{2915041280,2915237887},{2915276800,2915277823},{2915278848,2915282943},
+	{2915483648,2915500031},{2915516416,2915532799},{2915631104,2915696639},{2915762176,2915827711},{2915893248,2915926015},{2916089856,2916122623},{2916163584,2916171775},{2916287744,2916287999},
+	{2916296704,2916298751},{2916302848,2916303359},{2916304896,2916305919},{2916401152,2916417535},{2916433920,2916450303},{2916483072,2916515839},{2916524032,2916528127},{2916544512,2916548607},
+	{2917007360,2917138431},{2917167104,2917175295},{2917191680,2917195775},{2917212160,2917216255},{2917232640,2917236735},{2917441280,2917444095},{2917445120,2917447679},{2917448192,2917449727},
+	{2917564416,2917572607},{2917597184,2917613567},{2917629952,2917646335},{2917662720,2917728255},{2917744640,2917756927},{2917793792,2917859327},{2917924864,2917990399},{2918023168,2918039551},
+	{2918041856,2918042111},{2918121472,2918137855},{2918170624,2918172927},{2918173184,2918173439},{2918174464,2918178815},{2918179072,2918187007},{2918188288,2918188543},{2918190848,2918191103},
+	{2918199296,2918203391},{2918227968,2918232063},{2918252544,2918256639},{2918275584,2918275839},{2918323456,2918324223},{2918346752,2918350847},{2918412288,2918416383},{2918457344,2918459903},
+	{2918460416,2918460671},{2918461184,2918465535},{2918486016,2918490111},{2918498304,2918506495},{2918514688,2918522879},{2918526976,2918539263},{2918563840,2918572031},{2918588416,2918596607},
+	{2918604800,2918608895},{2918621184,2918625023},{2918625280,2918626303},{2918626560,2918629375},{2918662144,2918666239},{2918672640,2918672895},{2918673152,2918673407},{2918675200,2918675455},
+	{2918699008,2918699519},{2918700800,2918701567},{2918703104,2918711295},{2918784000,2918784255},{2918813696,2918817791},{2919153664,2919174143},{2919198720,2919211007},{2919213056,2919235583},
+	{2921332736,2921463807},{2921496576,2921512959},{2921594880,2921725951},{2922283776,2922284799},{2922315520,2922315775},{2922329600,2922329855},{2927099904,2927362047},{2927575040,2927591423},
+	{2927604224,2927604735},{2927608576,2927608831},{2927666688,2927666943},{2927670784,2927671295},{2927681536,2927755263},{2927886336,2928017407},{2928148480,2928164863},{2928173056,2928177151},
+	{2928181248,2928189439},{2928197632,2928214015},{2928226304,2928230399},{2928246784,2928263167},{2928279552,2928312319},{2928316416,2928324607},{2928345088,2928410623},{2928415232,2928415487},
+	{2928418048,2928418303},{2928419072,2928419327},{2928419840,2928420095},{2928423680,2928423935},{2928451584,2928455679},{2928460800,2928461311},{2928533504,2928536319},{2928541696,2928672767},
+	{2937849856,2937850879},{2938710016,2938711039},{2938732544,2938765311},{2938991616,2938991871},{2938994688,2938996735},{2946383872,2946384127},{2946384384,2946385151},{2946391808,2946392063},
+	{2946394368,2946394623},{2946394880,2946395135},{2948122624,2948126719},{2953379840,2953445375},{2953453568,2953455615},{2953465856,2953467903},{2953478144,2953510911},{2953603072,2953605119},
+	{2954625024,2954641407},{2954649600,2954657791},{2954821632,2954887167},{2954903552,2954918911},{2954919424,2954919935},{2954940416,2954946559},{2955018240,2955083775},{2956251136,2956253183},
+	{2956263424,2956296191},{2956474368,2956476415},{2956504064,2956504319},{2956504576,2956504831},{2956509184,2956525567},{2956578816,2956589055},{2956613632,2956623871},{2956820736,2956821247},
+	{2956822528,2956827647},{2957201408,2957205503},{2957221888,2957225983},{2957645824,2957647871},{2957680640,2957688831},{2959278080,2959282175},{2959351808,2959353855},{2959517696,2959519743},
+	{2959552512,2959556607},{2959572992,2959581183},{2959835136,2959843327},{2959847424,2959851519},{2960091136,2960093183},{2960119808,2960121343},{2960179200,2960187391},{2960392192,2960400383},
+	{2960723200,2960723455},{2960850944,2960859135},{2960863744,2960863999},{2960864768,2960865279},{2960866816,2960867071},{2960904192,2960906239},{2960934400,2960934911},{2960945152,2960945663},
+	{2961063936,2961064447},{2961064704,2961064959},{2961068800,2961069055},{2961091840,2961092095},{2961107968,2961108991},{2961112064,2961113087},{2967281664,2967287807},{2967421184,2967421439},
+	{2967432960,2967433727},{2967435264,2967437311},{2967446784,2967447039},{2967448576,2967450623},{2967450880,2967451135},{2967452928,2967453439},{2967453696,2967470079},{2967709696,2967710207},
+	{2967715840,2967724031},{2968614400,2968614655},{2970132480,2970136575},{2970309376,2970309631},{2971037696,2971041791},{2971664384,2971729919},{2971942912,2971944959},{2972078080,2972080127},
+	{2972647424,2972655615},{2973007872,2973008895},{2973014016,2973016063},{2973069312,2973070335},{2973078528,2973079551},{2973921280,2973922303},{2973924864,2973925375},{2974001664,2974002175},
+	{2974179328,2974187519},{2974253056,2974285823},{2974347264,2974349311},{2975162368,2975162623},{2975163648,2975164415},{2975178752,2975179775},{2975649792,2975653887},{2975688704,2975690751},
+	{2977562624,2977693695},{2977726464,2977727487},{2977865728,2977873919},{2978000896,2978002943},{2978064384,2978065407},{2978482176,2978484223},{2978489344,2978490367},{2978549760,2978551807},
+	{2978553600,2978553855},{2979577856,2979594239},{2979692544,2979700735},{2980858880,2980859903},{2981625856,2981634047},{2981662464,2981662719},{2984231680,2984231935},{2984939520,2984943615},
+	{2987397120,2987401215},{2987449344,2987449599},{2987499520,2987503615},{2987528192,2987532287},{2987562752,2987563007},{2987575552,2987576063},{2987614208,2987614463},{2987614976,2987615231},
+	{2987616256,2987618303},{2987694080,2987696127},{2987724800,2987726847},{2987800576,2987804671},{2987849728,2987851775},{2988441600,2988572671},{2990407680,2990538751},{2991177728,2991194111},
+	{2991407104,2991423487},{2991554560,2991570943},{2994995200,2994997247},{2995013632,2995015679},{2995046400,2995048447},{2996469760,2996502527},{2996621312,2996623359},{2996654080,2996657151},
+	{2996657920,2996659199},{2996764672,2996768767},{2996772864,2996776959},{2996790016,2996790271},{2996994048,2997026815},{2997485568,2997518335},{2997520384,2997520895},{2997521152,2997521407},
+	{2997521664,2997521919},{2997522176,2997522687},{2997522944,2997525503},{2997551104,2997553151},{2997559296,2997563391},{2997567744,2997568511},{2997569280,2997572607},{2997574656,2997575679},
+	{2997576704,2997583871},{2997846016,2997878783},{2999994624,2999999487},{2999999744,3000000255},{3000016896,3000025087},{3000049664,3000057855},{3000147968,3000152575},{3000153088,3000153343},
+	{3000180736,3000188927},{3000302848,3000303103},{3000512512,3000514559},{3000563712,3000564735},{3000586240,3000588287},{3000612864,3000614911},{3000684544,3000688639},{3001810944,3001815039},
+	{3001827328,3001831423},{3001869312,3001870335},{3001882880,3001883135},{3001950208,3001958399},{3001966592,3001970687},{3001974784,3001978879},{3001995264,3002003455},{3002019840,3002023935},
+	{3002603520,3002605567},{3002615808,3002617855},{3002634240,3002636287},{3002671104,3002673407},{3002673664,3002673919},{3002675200,3002677247},{3002697728,3002699775},{3002710016,3002712063},
+	{3002732544,3002732799},{3002733056,3002733311},{3002738688,3002742783},{3002800128,3002802175},{3002841088,3002843135},{3003095040,3003097087},{3003105280,3003105535},{3003107840,3003108351},
+	{3003117824,3003118079},{3003138048,3003154431},{3005972480,3005988863},{3006267392,3006291967},{3006316544,3006320639},{3006324736,3006331903},{3006496768,3006513151},{3006519296,3006521343},
+	{3007090688,3007091199},{3007122432,3007123199},{3007152128,3007184895},{3007250432,3007283199},{3007287296,3007291391},{3007293440,3007299583},{3010084864,3010086911},{3011297280,3011298303},
+	{3015680000,3015681023},{3015684096,3015684351},{3015684864,3015685631},{3015686400,3015687167},{3015698432,3015700479},{3025600512,3025633279},{3025975296,3025979391},{3028517888,3028518143},
+	{3029622784,3029630975},{3029725184,3029727231},{3031629824,3031695359},{3032269824,3032270335},{3032325120,3032326143},{3032337408,3032338175},{3033712640,3033714687},{3033715200,3033715455},
+	{3033718784,3033720319},{3033720832,3033721087},{3033721344,3033721855},{3033722880,3033726975},{3035326464,3035327487},{3035334656,3035335167},{3035335424,3035335679},{3035337728,3035337983},
+	{3039395840,3039396863},{3039412224,3039420415},{3044208640,3044212735},{3044421632,3044425727},{3044466688,3044468735},{3044507648,3044519935},{3048121344,3048123391},{3048126464,3048128511},
+	{3048132608,3048144895},{3049062400,3049095167},{3050700800,3050715135},{3050715648,3050811391},{3050811648,3050811903},{3050815488,3050831871},{3051356160,3051380735},{3051388928,3051397119},
+	{3051411456,3051413503},{3051913216,3051962367},{3051978752,3051982847},{3051984896,3051995135},{3054537728,3054538751},{3055001600,3055003647},{3056730112,3056742399},{3056754688,3056758783},
+	{3056762880,3056771071},{3057026304,3057027071},{3057037312,3057041407},{3057051648,3057051903},{3057052416,3057052671},{3057052928,3057053695},{3063963648,3063988223},{3064013824,3064014847},
+	{3064029184,3064037375},{3064808448,3064808959},{3064809472,3064810495},{3068950272,3068951039},{3068985344,3068987391},{3069126656,3069127679},{3070174208,3070175231},{3075579904,3075581951},
+	{3081849856,3081851903},{3082158592,3082158847},{3082160640,3082161151},{3082162688,3082163967},{3082178560,3082179583},{3088449536,3088515071},{3088580608,3088588799},{3088592896,3088596991},
+	{3088605440,3088605951},{3088609280,3088625663},{3088629760,3088637951},{3088642048,3088654335},{3088659456,3088660991},{3088662272,3088675839},{3088676352,3088677887},{3088678912,3088691199},
+	{3088691968,3088692223},{3088693248,3088694271},{3088695296,3088696319},{3088698368,3088698879},{3088699392,3088711167},{3088711424,3088720383},{3088721408,3088721919},{3088722944,3088723455},
+	{3088724992,3088725247},{3088725504,3088727039},{3088727552,3088734207},{3088734976,3088744447},{3088746496,3088748543},{3088752640,3088753919},{3088754176,3088755711},{3088756736,3088786431},
+	{3088787456,3088793599},{3088797696,3088802815},{3088804864,3088806399},{3088806912,3088809215},{3088809472,3088813055},{3088813568,3088814079},{3088818176,3088823295},{3088824320,3088825343},
+	{3088826368,3088826879},{3088827136,3088827903},{3088828160,3088828671},{3088828928,3088830463},{3088830976,3088833535},{3088834560,3088844287},{3088844544,3088845311},{3088845824,3088847871},
+	{3088848384,3088849407},{3088849920,3088856575},{3088857088,3088858623},{3088859136,3088859647},{3088860160,3088861183},{3088862720,3088863231},{3088864000,3088865279},{3088866816,3088868863},
+	{3088869888,3088870143},{3088871168,3088871935},{3088872192,3088872447},{3088873216,3088880127},{3088880640,3088885247},{3088885760,3088886783},{3088887296,3088887807},{3088888320,3088892415},
+	{3088892928,3088893439},{3088893952,3088894463},{3088894976,3088895999},{3088896512,3088897791},{3088898048,3088898559},{3088898816,3088900607},{3088901632,3088916991},{3088917248,3088921087},
+	{3088922112,3088923647},{3088924672,3088925183},{3088926208,3088929279},{3088929792,3088931327},{3088931840,3088934399},{3088934912,3088941055},{3088945152,3088957439},{3088973824,3088982015},
+	{3088986112,3088994303},{3088998400,3089006591},{3089010688,3089039359},{3089041408,3089042175},{3089043456,3089080319},{3089092608,3089104895},{3090061312,3090062335},{3090284544,3090546687},
+	{3091726336,3091857407},{3091968000,3091972095},{3091976192,3091980287},{3091986432,3091988479},{3092169728,3092170751},{3092284160,3092284415},{3092381696,3092512767},{3092520960,3092529151},
+	{3092533248,3092537343},{3092541440,3092551423},{3092553728,3092554751},{3092555008,3092555263},{3092555776,3092560895},{3092561920,3092563967},{3092566016,3092566271},{3092566528,3092567039},
+	{3092568320,3092568575},{3092568832,3092570111},{3092572160,3092573183},{3092573696,3092574207},{3092574720,3092575743},{3092577280,3092578303},{3092582400,3092590591},{3092594688,3092602879},
+	{3092606976,3092631807},{3092632064,3092632831},{3092633344,3092634623},{3092634880,3092635135},{3092635392,3092635647},{3092636672,3092637695},{3092638720,3092639743},{3092640768,3092642815},
+	{3092643072,3092664319},{3092665344,3092669951},{3092670464,3092672511},{3092673024,3092675071},{3092675584,3092676607},{3092684800,3092700415},{3092700672,3092706559},{3092707840,3092708095},
+	{3092708864,3092721663},{3092725760,3092733951},{3092743168,3092744191},{3092745216,3092760063},{3092762112,3092766207},{3092766720,3092774911},{3093204992,3093209087},{3093217280,3093217535},
+	{3093241856,3093250047},{3093889024,3093893119},{3093924352,3093924607},{3093944576,3093944831},{3093954560,3094085631},{3097100288,3097165823},{3097772032,3097780223},{3097788416,3097796607},
+	{3097804800,3097812991},{3097821184,3097886719},{3098017792,3098083327},{3098099712,3098101759},{3098106880,3098107391},{3098116096,3098148863},{3098181632,3098185727},{3098202112,3098214399},
+	{3098255360,3098259455},{3098275840,3098411007},{3098411776,3098413055},{3098427392,3098431487},{3098435328,3098435583},{3098492928,3098509311},{3098525696,3098542079},{3103917056,3103919103},
+	{3103923200,3103924223},{3103932416,3103934463},{3103936512,3103937535},{3103941632,3103942655},{3103950848,3103951871},{3103952896,3103953919},{3103954944,3103955967},{3103961088,3103962111},
+	{3103977472,3103978495},{3104005120,3104006143},{3104015360,3104016383},{3104023552,3104024575},{3104028672,3104029695},{3104044032,3104045055},{3104065536,3104066559},{3104076288,3104076543},
+	{3104081920,3104082943},{3104084992,3104085247},{3104085504,3104085759},{3104104448,3104105471},{3104112640,3104113663},{3104118784,3104119807},{3104123904,3104124415},{3104124672,3104124927},
+	{3104133376,3104133631},{3104135168,3104136191},{3104136448,3104136703},{3104156672,3104157695},{3104160768,3104161791},{3104162816,3104163839},{3104176128,3104177151},{3104180224,3104181247},
+	{3104200192,3104200703},{3104212480,3104212735},{3104239616,3104240639},{3104251904,3104252927},{3104259072,3104261119},{3104263168,3104265215},{3104301056,3104302079},{3104307200,3104308223},
+	{3104335872,3104336895},{3104346112,3104347135},{3104351232,3104351999},{3104354304,3104355327},{3104359680,3104359935},{3104369664,3104370687},{3104375552,3104375807},{3104378880,3104379903},
+	{3104387584,3104388095},{3104417280,3104417791},{3104419840,3104420863},{3104454656,3104455679},{3104457728,3104457983},{3104458240,3104458495},{3104464896,3104465919},{3104467456,3104467711},
+	{3104480256,3104481279},{3104483328,3104484351},{3104498688,3104499711},{3104524288,3104525311},{3104540672,3104541695},{3104542720,3104542975},{3104547840,3104548863},{3104553984,3104555007},
+	{3104557056,3104558079},{3104561408,3104561663},{3104567296,3104567551},{3104572416,3104573439},{3104574464,3104575487},{3104579584,3104580095},{3104582656,3104583679},{3104587776,3104588799},
+	{3104601088,3104602111},{3104625664,3104626175},{3104632832,3104633855},{3104637952,3104638975},{3104640768,3104641023},{3104645120,3104645375},{3104646144,3104648191},{3104651264,3104653311},
+	{3104654336,3104655359},{3104659456,3104659711},{3104660224,3104660479},{3104661504,3104662527},{3104674816,3104675839},{3104676864,3104677887},{3104678912,3104679935},{3104694272,3104695295},
+	{3104709632,3104710655},{3104714752,3104715775},{3104725248,3104727039},{3104749568,3104750591},{3104752128,3104752383},{3104766976,3104767999},{3104770048,3104771071},{3104799744,3104801791},
+	{3104826112,3104826367},{3104829440,3104831487},{3104848896,3104849919},{3104855040,3104855295},{3104855808,3104856063},{3104883712,3104884223},{3104887808,3104888831},{3104899072,3104900095},
+	{3104905216,3104906239},{3104907264,3104908287},{3104929792,3104930815},{3104933888,3104934911},{3104935936,3104937983},{3104945152,3104947199},{3104950016,3104950271},{3104963584,3104964607},
+	{3104972800,3104973567},{3104977920,3104978943},{3104988160,3104989183},{3105002496,3105003007},{3105004544,3105005567},{3105015040,3105015295},{3105016832,3105017855},{3105024000,3105025023},
+	{3105034240,3105035263},{3105038336,3105039359},{3105052672,3105054719},{3105063936,3105064959},{3105075200,3105077247},{3105085440,3105086463},{3105095680,3105096703},{3105107968,3105108991},
+	{3105119232,3105119487},{3105120256,3105121279},{3105142784,3105143807},{3105148928,3105149951},{3105157120,3105158143},{3105163264,3105164287},{3105176576,3105177599},{3105186816,3105188863},
+	{3105195008,3105196031},{3105216512,3105217535},{3105242112,3105243135},{3105272832,3105273855},{3105275904,3105276927},{3105280768,3105281023},{3105296384,3105296895},{3105299456,3105300479},
+	{3105309696,3105310719},{3105321984,3105323007},{3105374208,3105374463},{3105374976,3105376255},{3105382400,3105383423},{3105401856,3105402879},{3105413632,3105414143},{3105417216,3105418239},
+	{3105419264,3105419519},{3105421312,3105422335},{3105430528,3105431039},{3105432576,3105433599},{3105448960,3105449983},{3105452032,3105452287},{3105453056,3105454079},{3105457152,3105458175},
+	{3105470464,3105471487},{3105484800,3105485823},{3105487872,3105488895},{3105504256,3105504767},{3105513472,3105514495},{3105515520,3105516543},{3105520640,3105521663},{3105526784,3105527295},
+	{3105534976,3105535999},{3105537792,3105538047},{3105549312,3105550335},{3105561600,3105563647},{3105579008,3105580031},{3105590272,3105591295},{3105614848,3105615871},{3105616896,3105617919},
+	{3105625088,3105626111},{3105629184,3105629951},{3105637376,3105638399},{3105644032,3105644287},{3105645568,3105646591},{3105649152,3105649663},{3105654784,3105655807},{3105664000,3105665023},
+	{3105669120,3105670143},{3105678336,3105679359},{3105687552,3105688319},{3105691648,3105692671},{3105727488,3105728511},{3105729536,3105729791},{3105730560,3105731583},{3105790976,3105791999},
+	{3105805312,3105805823},{3105810432,3105811455},{3105820672,3105821695},{3105822208,3105822719},{3105830912,3105831167},{3105854464,3105855487},{3105866752,3105867775},{3105868800,3105869823},
+	{3105879040,3105880063},{3105889280,3105890303},{3105900544,3105901567},{3105910016,3105910527},{3105921024,3105922047},{3105923072,3105924095},{3105933312,3105934335},{3105937408,3105938431},
+	{3105945600,3105946623},{3105948672,3105949695},{3105952768,3105953791},{3105960960,3105961983},{3105984512,3105985535},{3106001920,3106002431},{3106013184,3106014207},{3106019328,3106020351},
+	{3106021376,3106022399},{3106023424,3106023679},{3106030592,3106031615},{3106046976,3106049023},{3106060288,3106061311},{3106067456,3106069503},{3106077696,3106078207},{3106086912,3106087935},
+	{3106093056,3106094079},{3106098176,3106099199},{3106115584,3106117631},{3106120960,3106121215},{3106125824,3106126847},{3106160640,3106161663},{3106163712,3106164735},{3106164992,3106165247},
+	{3106167808,3106168831},{3106169856,3106170879},{3106173952,3106174207},{3106181120,3106182143},{3106192384,3106193407},{3106208768,3106209791},{3106219008,3106220031},{3106247680,3106248703},
+	{3106255360,3106255871},{3106261504,3106261759},{3106268160,3106268415},{3106278400,3106279423},{3106285568,3106287615},{3106302976,3106303999},{3106322432,3106322943},{3106323200,3106323455},
+	{3106338816,3106339839},{3106371584,3106372607},{3106383872,3106384895},{3106398208,3106399231},{3106400256,3106400767},{3106407424,3106407935},{3106408192,3106408447},{3106436096,3106437119},
+	{3106452480,3106453503},{3106465792,3106466815},{3106507776,3106508799},{3106510848,3106511871},{3106554112,3106554623},{3106563072,3106564095},{3106580480,3106581503},{3106589696,3106590719},
+	{3106593792,3106594815},{3106630656,3106631679},{3106641664,3106642175},{3106652160,3106652671},{3106662400,3106663423},{3106674176,3106674687},{3106701312,3106702335},{3106735104,3106736127},
+	{3106737152,3106738175},{3106762752,3106763775},{3106771968,3106772991},{3106780160,3106781183},{3106783744,3106784255},{3106791424,3106792447},{3106801664,3106802687},{3106813952,3106814975},
+	{3106845696,3106846719},{3106851840,3106852095},{3106859008,3106859263},{3106897920,3106898943},{3106900992,3106902015},{3106916352,3106917119},{3106923520,3106924543},{3106961408,3106962431},
+	{3106972672,3106973695},{3106989056,3106990079},{3107009536,3107010559},{3107013632,3107014655},{3107017216,3107017471},{3107027968,3107028991},{3107033088,3107034111},{3107042304,3107043327},
+	{3107045376,3107046399},{3107048448,3107049471},{3107088384,3107089407},{3107092480,3107092991},{3107111936,3107112959},{3107121152,3107122175},{3107129344,3107130367},{3107139584,3107140607},
+	{3107147264,3107147775},{3107149568,3107149823},{3107169280,3107170303},{3107171328,3107172351},{3107175680,3107175935},{3107176448,3107176703},{3107185664,3107186687},{3107190016,3107190271},
+	{3107192832,3107193855},{3107195904,3107196927},{3107198976,3107199999},{3107227648,3107228671},{3107232768,3107233791},{3107245056,3107246079},{3107250176,3107251199},{3107256320,3107257343},
+	{3107260416,3107261439},{3107268096,3107268351},{3107269632,3107269887},{3107281408,3107281663},{3107286016,3107286527},{3107291136,3107292159},{3107299328,3107300351},{3107301376,3107303423},
+	{3107310592,3107312639},{3107324928,3107325951},{3107345408,3107346431},{3107351552,3107354623},{3107379200,3107379455},{3107379712,3107379967},{3107380224,3107381247},{3107408896,3107409919},
+	{3107412992,3107414015},{3107415040,3107416063},{3107417088,3107418111},{3107437568,3107438591},{3107444736,3107445759},{3107447808,3107448063},{3107450880,3107451903},{3107453952,3107454207},
+	{3107456000,3107458047},{3107460096,3107461119},{3107462144,3107463167},{3107470336,3107471359},{3107475456,3107475711},{3107476480,3107477503},{3107491840,3107493887},{3107495936,3107496959},
+	{3107514368,3107515391},{3107526656,3107527679},{3107540992,3107542015},{3107547136,3107549183},{3107559424,3107560447},{3107568640,3107569663},{3107596288,3107598335},{3107615744,3107617791},
+	{3107635200,3107636223},{3107638272,3107639295},{3107640320,3107641343},{3107658752,3107659775},{3107666944,3107667967},{3107672064,3107673087},{3107678208,3107679231},{3107688448,3107689471},
+	{3107704832,3107705855},{3107709952,3107710975},{3107721216,3107722239},{3107762432,3107762687},{3107767296,3107768575},{3107781376,3107781631},{3107784704,3107784959},{3107821568,3107822079},
+	{3107848192,3107849215},{3107852288,3107853311},{3107883008,3107884031},{3107890176,3107890431},{3107900416,3107901439},{3107908608,3107909631},{3107922944,3107923967},{3107928064,3107928319},
+	{3107950592,3107950847},{3107951360,3107951615},{3107952640,3107953663},{3107978240,3107979263},{3107998464,3107998719},{3108004864,3108005887},{3108016128,3108017151},{3108020224,3108021247},
+	{3108034560,3108035583},{3108041728,3108042751},{3108055040,3108056063},{3108078592,3108079615},{3108081664,3108082687},{3108096000,3108096511},{3108105216,3108106239},{3108107264,3108108287},
+	{3108146176,3108146687},{3108146944,3108148223},{3108152576,3108152831},{3108155136,3108155391},{3108160512,3108161535},{3108169728,3108170751},{3108175872,3108176127},{3108176896,3108177919},
+	{3108182016,3108183039},{3108233216,3108234239},{3108245504,3108246527},{3108274688,3108274943},{3108286464,3108287487},{3108289536,3108290559},{3108329472,3108330495},{3108345856,3108346879},
+	{3108370432,3108371455},{3108393984,3108395007},{3108396032,3108397055},{3108399104,3108400127},{3108419584,3108420607},{3108453376,3108455423},{3108470784,3108471807},{3108495360,3108496895},
+	{3108525056,3108526079},{3108539392,3108539903},{3108541952,3108542207},{3108543488,3108544511},{3108548608,3108548863},{3108549120,3108549631},{3108555776,3108556799},{3108566016,3108567039},
+	{3108577280,3108577791},{3108587520,3108587775},{3108588032,3108588287},{3108597760,3108598015},{3108598272,3108598527},{3108601856,3108604927},{3108615680,3108616191},{3108625408,3108626431},
+	{3108630528,3108630783},{3108645888,3108646911},{3108648960,3108649983},{3108651776,3108652031},{3108707328,3108709375},{3108713728,3108713983},{3108719616,3108720639},{3108731904,3108732415},
+	{3108736000,3108737023},{3108759552,3108760575},{3108782080,3108783103},{3108785408,3108785663},{3108847616,3108848639},{3108849664,3108850687},{3108851712,3108852735},{3108853760,3108854015},
+	{3108854528,3108854783},{3108875264,3108876287},{3108879360,3108879871},{3108882432,3108883455},{3108884480,3108885503},{3108894976,3108895743},{3108935680,3108936703},{3108938240,3108938495},
+	{3108972544,3108973567},{3109001216,3109002239},{3109021696,3109022719},{3109025792,3109026815},{3109084160,3109085183},{3109088256,3109089279},{3109097472,3109098495},{3109105664,3109106687},
+	{3109118464,3109118719},{3109126144,3109126655},{3109132288,3109133311},{3109146624,3109147647},{3109153792,3109154559},{3109164032,3109165055},{3109184256,3109184511},{3109207040,3109208063},
+	{3109213184,3109213951},{3109221376,3109222399},{3109229568,3109230591},{3109249024,3109251071},{3109279744,3109280767},{3109294080,3109295103},{3109336064,3109337087},{3109351680,3109351935},
+	{3109355520,3109356287},{3109358080,3109358847},{3109359104,3109359615},{3109366784,3109367807},{3109370112,3109370367},{3109374976,3109375487},{3109386240,3109386495},{3109397504,3109398527},
+	{3109416960,3109417983},{3109425152,3109426175},{3109447680,3109448703},{3109474816,3109475071},{3109491712,3109492735},{3109498880,3109499903},{3109506048,3109506559},{3109537792,3109538815},
+	{3109543936,3109544191},{3109550080,3109551103},{3109568512,3109569535},{3109577728,3109579775},{3109598208,3109599231},{3109605120,3109605375},{3109606400,3109607423},{3109612544,3109613567},
+	{3109618688,3109619711},{3109622272,3109622783},{3109637120,3109638143},{3109643264,3109643775},{3109644288,3109646335},{3109651456,3109652479},{3109681152,3109682175},{3109698560,3109699071},
+	{3109703168,3109703423},{3109718016,3109719039},{3109728256,3109729279},{3109732352,3109734399},{3109755904,3109756927},{3109768192,3109769215},{3109792768,3109793791},{3109809152,3109809663},
+	{3109820416,3109821439},{3109831680,3109832703},{3109844224,3109844479},{3109870592,3109871615},{3109875456,3109876735},{3109879808,3109880063},{3109885952,3109886975},{3109888000,3109889023},
+	{3109897472,3109897727},{3109901312,3109901823},{3109909504,3109910527},{3109925888,3109926911},{3109934336,3109934591},{3109938944,3109939199},{3109949440,3109950463},{3109952768,3109953535},
+	{3109966592,3109966847},{3109967616,3109967871},{3109987328,3109987839},{3109988096,3109988351},{3109993472,3109995519},{3110028288,3110029311},{3110052864,3110053887},{3110088704,3110089727},
+	{3110090752,3110091263},{3110091776,3110093823},{3110099968,3110100991},{3110112256,3110112511},{3110117376,3110117887},{3110132736,3110133759},{3110142976,3110143999},{3110147328,3110148095},
+	{3110149120,3110150143},{3110181888,3110182911},{3110196480,3110196991},{3110197248,3110197503},{3110202368,3110203391},{3110220800,3110221055},{3110238208,3110239231},{3110244352,3110245375},
+	{3110255616,3110255871},{3110285312,3110285567},{3110297600,3110298623},{3110307328,3110307839},{3110308864,3110309887},{3110332416,3110332927},{3110333440,3110334463},{3110337536,3110338559},
+	{3110360064,3110361087},{3110392832,3110393855},{3110407168,3110407935},{3110412288,3110413311},{3110421760,3110422271},{3110424576,3110425599},{3110431488,3110431743},{3110439936,3110440191},
+	{3110459904,3110460415},{3110475776,3110476799},{3110486016,3110488063},{3110504448,3110504959},{3110505216,3110505471},{3110524928,3110525439},{3110537216,3110538239},{3110539264,3110540287},
+	{3110543360,3110544383},{3110547456,3110548479},{3110551552,3110552575},{3110555648,3110556671},{3110559744,3110560767},{3110563072,3110563583},{3110579200,3110579455},{3110579712,3110580223},
+	{3110586368,3110586623},{3110587136,3110587391},{3110599680,3110600191},{3110607872,3110608895},{3110631424,3110632447},{3110635520,3110636543},{3110639616,3110639871},{3110647808,3110648831},
+	{3110656000,3110657023},{3110664192,3110665215},{3110667264,3110668287},{3110673408,3110675455},{3110691840,3110692863},{3110715392,3110716415},{3110729728,3110730751},{3110755328,3110755583},
+	{3110755840,3110756351},{3110757376,3110758911},{3110784000,3110785023},{3110791168,3110791423},{3110791680,3110791935},{3110806528,3110807295},{3110808576,3110809599},{3110810624,3110811647},
+	{3110813696,3110814207},{3110817792,3110818815},{3110820864,3110821887},{3110822912,3110823167},{3110827008,3110827519},{3110838272,3110839295},{3110884352,3110884863},{3110889472,3110889727},
+	{3110895616,3110896639},{3110918144,3110919167},{3110933504,3110934015},{3110935552,3110936575},{3110951936,3110952959},{3110966272,3110967295},{3110971392,3110972415},{3110990336,3110990591},
+	{3111010304,3111010815},{3111119616,3111119871},{3111120896,3111121919},{3111135232,3111136255},{3111145728,3111147519},{3111150592,3111151615},{3111213056,3111214079},{3111223296,3111223807},
+	{3111249664,3111249919},{3111263232,3111264511},{3111264768,3111265279},{3111265536,3111266047},{3111270400,3111271423},{3111283712,3111284223},{3111291904,3111292927},{3111294976,3111297023},
+	{3111305216,3111306239},{3111313664,3111313919},{3111324672,3111325695},{3111329792,3111330815},{3111352320,3111353343},{3111357440,3111357695},{3111386112,3111387135},{3111429120,3111430143},
+	{3111441408,3111442431},{3111448320,3111448575},{3111452672,3111453695},{3111458304,3111458559},{3111475200,3111475711},{3111476224,3111477247},{3111482624,3111483391},{3111486464,3111486975},
+	{3111491584,3111492607},{3111507456,3111507967},{3111526400,3111527423},{3111532544,3111533567},{3111546880,3111547903},{3111552000,3111553023},{3111562240,3111563263},{3111587840,3111588863},
+	{3111593984,3111595007},{3111601152,3111602175},{3111611392,3111612415},{3111613440,3111614463},{3111615488,3111616511},{3111617536,3111617791},{3111627776,3111628799},{3111651072,3111651327},
+	{3111654400,3111654911},{3111655168,3111655423},{3111658240,3111658495},{3111667712,3111668735},{3111674880,3111675903},{3111686144,3111687167},{3111688192,3111689215},{3111693312,3111694335},
+	{3111713792,3111714815},{3111720960,3111721983},{3111732480,3111732735},{3111745536,3111746559},{3111753728,3111754239},{3111755776,3111756799},{3111758336,3111758591},{3111759872,3111760383},
+	{3111778304,3111779327},{3111780352,3111781375},{3111783424,3111784447},{3111794688,3111795711},{3111814144,3111815167},{3111823360,3111824383},{3111839744,3111840767},{3111861248,3111862015},
+	{3111870464,3111871487},{3111875584,3111876607},{3111881728,3111882751},{3111891968,3111892991},{3111952384,3111953407},{3111962624,3111963647},{3111985664,3111986175},{3111989760,3111990271},
+	{3111993344,3111994367},{3112025088,3112026111},{3112032256,3112033279},{3112035328,3112036351},{3112049664,3112050687},{3112051712,3112052735},{3112058880,3112059903},{3112067072,3112068095},
+	{3112071168,3112071935},{3112086528,3112087551},{3112115200,3112116223},{3112141568,3112141823},{3112178688,3112179711},{3112200704,3112201215},{3112226816,3112227327},{3112229888,3112230399},
+	{3112243712,3112244223},{3112256512,3112257535},{3112273920,3112274175},{3112274432,3112274943},{3112302592,3112303103},{3112331264,3112332287},{3112345600,3112346623},{3112358912,3112359935},
+	{3112361984,3112363007},{3112376320,3112377343},{3112387584,3112388607},{3112411136,3112412159},{3112415232,3112416255},{3112443904,3112447999},{3112467456,3112468479},{3112469504,3112470527},
+	{3112477696,3112479743},{3112480768,3112481791},{3112482816,3112485887},{3112486912,3112487935},{3112494080,3112495103},{3112509440,3112510463},{3112511488,3112512511},{3112519680,3112519935},
+	{3112550912,3112551167},{3112559616,3112560639},{3112561664,3112562687},{3112652800,3112653823},{3112658432,3112658687},{3112665088,3112665343},{3112686592,3112687615},{3112688640,3112689663},
+	{3112708096,3112709119},{3112722432,3112723455},{3112733696,3112734207},{3112742912,3112743935},{3112817664,3112818687},{3112824832,3112825855},{3112868864,3112869375},{3112901376,3112901631},
+	{3112902656,3112903679},{3112928256,3112929279},{3112955904,3112956927},{3112972288,3112973311},{3112973568,3112974335},{3112989184,3112989695},{3112995840,3112997887},{3112998912,3112999167},
+	{3113001984,3113003007},{3113005056,3113006079},{3113007104,3113008127},{3113039872,3113040895},{3113055232,3113056255},{3113064448,3113065471},{3113074688,3113074943},{3113075456,3113075711},
+	{3113076736,3113077759},{3113084416,3113084927},{3113104384,3113105407},{3113109504,3113111551},{3113151744,3113151999},{3113160704,3113161727},{3113169920,3113170943},{3113179136,3113180159},
+	{3113200640,3113201663},{3113216000,3113216255},{3113235456,3113236479},{3113242624,3113243647},{3113247744,3113247999},{3113249792,3113250047},{3113257984,3113259007},{3113262080,3113263103},
+	{3113277440,3113278463},{3113280512,3113281535},{3113282560,3113283583},{3113291776,3113292799},{3113293824,3113294847},{3113298944,3113299455},{3113299712,3113299967},{3113303040,3113304063},
+	{3113313280,3113313535},{3113327616,3113328127},{3113328640,3113329663},{3113330688,3113331711},{3113338880,3113339903},{3113347072,3113348095},{3113350144,3113350399},{3113368576,3113369599},
+	{3113376768,3113377791},{3113380864,3113381887},{3113387008,3113388031},{3113394176,3113396223},{3113408512,3113409535},{3113413632,3113414655},{3113433600,3113435135},{3113445376,3113446399},
+	{3113461760,3113462015},{3113468928,3113469951},{3113473024,3113475071},{3113479168,3113480191},{3113492480,3113493503},{3113498624,3113499647},{3113501696,3113502719},{3113503744,3113504767},
+	{3113508864,3113509887},{3113511936,3113512959},{3113513984,3113515007},{3113530368,3113531391},{3113560064,3113561087},{3113564160,3113565183},{3113583616,3113584639},{3113587200,3113587455},
+	{3113615360,3113616383},{3113653248,3113654271},{3113660416,3113660927},{3113667584,3113668607},{3113692160,3113692671},{3113694208,3113695231},{3113696256,3113697279},{3113717760,3113718783},
+	{3113733120,3113734143},{3113746432,3113746943},{3113747968,3113748223},{3113755392,3113755647},{3113774080,3113775103},{3113779200,3113779455},{3113779968,3113780223},{3113783296,3113784319},
+	{3113839616,3113840639},{3113850624,3113850879},{3113853952,3113854975},{3113857024,3113858047},{3113860096,3113861119},{3113905152,3113906175},{3113994240,3113995263},{3114002432,3114003455},
+	{3114015744,3114016767},{3114024960,3114025983},{3114052608,3114053631},{3114055680,3114056703},{3114063872,3114064895},{3114084352,3114085375},{3114087424,3114088447},{3114093568,3114094591},
+	{3114109952,3114110463},{3114115072,3114115839},{3114127360,3114128383},{3114130432,3114131455},{3114136576,3114137599},{3114140672,3114141695},{3114175232,3114175487},{3114179584,3114180607},
+	{3114193920,3114194943},{3114203136,3114204159},{3114211328,3114211583},{3114223616,3114224639},{3114225664,3114226687},{3114245120,3114245375},{3114246144,3114247167},{3114261504,3114262015},
+	{3114266624,3114267647},{3114270720,3114271743},{3114281984,3114283007},{3114310656,3114311679},{3114316800,3114317823},{3114335232,3114336255},{3114340352,3114341375},{3114347520,3114348543},
+	{3114363904,3114364927},{3114387456,3114387967},{3114389504,3114390527},{3114404096,3114404351},{3114404608,3114404863},{3114416128,3114417151},{3114420224,3114421247},{3114429440,3114431487},
+	{3114434560,3114435583},{3114445568,3114445823},{3114448896,3114449919},{3114458112,3114460159},{3114461952,3114462207},{3114465280,3114466303},{3114479616,3114480639},{3114488832,3114489087},
+	{3114494976,3114496255},{3114500096,3114501119},{3114504192,3114505215},{3114511360,3114512383},{3114517504,3114518527},{3114547200,3114547711},{3114558464,3114559487},{3114561536,3114562559},
+	{3114577920,3114578431},{3114586112,3114586623},{3114601472,3114602495},{3114606336,3114606591},{3114609664,3114610943},{3114617856,3114618879},{3114641408,3114641919},{3114646528,3114648575},
+	{3114652672,3114654719},{3114669056,3114670079},{3114696704,3114697727},{3114705920,3114706943},{3114712576,3114712831},{3114738688,3114738943},{3114744832,3114745855},{3114749440,3114749951},
+	{3114754048,3114755071},{3114770432,3114771455},{3114774528,3114774783},{3114797312,3114797567},{3114803200,3114803711},{3114813440,3114814463},{3114816512,3114817535},{3114830848,3114831871},
+	{3114838016,3114838271},{3114870784,3114871807},{3114881024,3114881535},{3114889216,3114890239},{3114893312,3114894335},{3114898432,3114899455},{3114905600,3114906623},{3114908672,3114909183},
+	{3114910720,3114911743},{3114920704,3114920959},{3114925568,3114926079},{3114936320,3114936575},{3114940416,3114941439},{3114944512,3114945535},{3114954752,3114955775},{3114962944,3114963967},
+	{3115038720,3115039231},{3115044864,3115045887},{3115047424,3115047935},{3115048960,3115049983},{3115053056,3115054079},{3115055104,3115057151},{3115062272,3115063295},{3115066624,3115066879},
+	{3115069440,3115069695},{3115072000,3115072511},{3115090432,3115091967},{3115094528,3115094783},{3115105280,3115106303},{3115114496,3115115519},{3115127808,3115128319},{3115128832,3115129855},
+	{3115146240,3115147263},{3115180288,3115180543},{3115203584,3115204607},{3115213824,3115214847},{3115215872,3115216895},{3115223040,3115223551},{3115226624,3115226879},{3115236352,3115236607},
+	{3115240448,3115241471},{3115247616,3115247871},{3115258880,3115259903},{3115288576,3115289599},{3115293696,3115294207},{3115294464,3115294719},{3115317248,3115318271},{3115331584,3115332607},
+	{3115342592,3115342847},{3115352064,3115353087},{3115358208,3115360255},{3115361024,3115361279},{3115363328,3115364351},{3115382784,3115383039},{3115390208,3115390463},{3115390720,3115390975},
+	{3115405568,3115405823},{3115422720,3115423743},{3115426816,3115427839},{3115441152,3115442175},{3115464704,3115465727},{3115479040,3115480063},{3115489280,3115490303},{3115501568,3115502591},
+	{3115505664,3115506175},{3115524096,3115525119},{3115544576,3115545599},{3115564032,3115564799},{3115566336,3115566591},{3115567104,3115569151},{3115580416,3115581439},{3115593728,3115593983},
+	{3115609088,3115610111},{3115631616,3115632639},{3115637760,3115638783},{3115640320,3115640831},{3115648000,3115649023},{3115649280,3115650047},{3115672576,3115673599},{3115676672,3115677695},
+	{3115678720,3115681791},{3115700224,3115701247},{3115725312,3115725567},{3115735040,3115736063},{3115759616,3115760639},{3115770880,3115771903},{3115804672,3115805695},{3115806720,3115807743},
+	{3115817984,3115819007},{3115824640,3115824895},{3115833344,3115834367},{3115862016,3115863295},{3115863808,3115864063},{3115874304,3115875327},{3115879680,3115880447},{3115882496,3115884543},
+	{3115886336,3115886591},{3115892736,3115893759},{3115896832,3115897855},{3115907072,3115907327},{3115915264,3115917311},{3115921408,3115922431},{3115929600,3115930623},{3115941376,3115941887},
+	{3115963392,3115964415},{3115973376,3115973631},{3115980800,3115981055},{3115987968,3115988479},{3115994112,3115994879},{3116012032,3116012543},{3116017664,3116018687},{3116037120,3116037375},
+	{3116063488,3116063743},{3116083200,3116084223},{3116091136,3116091391},{3116097536,3116098559},{3116099584,3116100607},{3116120064,3116120575},{3116124160,3116126207},{3116136448,3116137471},
+	{3116142592,3116143615},{3116151808,3116152063},{3116152320,3116152831},{3116158208,3116158719},{3116169216,3116170239},{3116174336,3116175359},{3116178176,3116178431},{3116183552,3116184575},
+	{3116186368,3116186623},{3116199936,3116200959},{3116212224,3116213503},{3116214016,3116214271},{3116217344,3116217599},{3116220416,3116220671},{3116221184,3116221439},{3116229632,3116229887},
+	{3116230400,3116230655},{3116232704,3116233727},{3116235776,3116236031},{3116249088,3116249343},{3116257280,3116258047},{3116272640,3116273663},{3116302336,3116303359},{3116320768,3116321791},
+	{3116336128,3116337151},{3116352512,3116353535},{3116367872,3116368895},{3116371968,3116372991},{3116386048,3116386303},{3116392448,3116393471},{3116399616,3116399871},{3116400128,3116400383},
+	{3116401664,3116401919},{3116414976,3116415231},{3116422144,3116423167},{3116443136,3116443391},{3116451840,3116452863},{3116465152,3116466175},{3116475392,3116476415},{3116488704,3116489727},
+	{3116502016,3116503039},{3116520960,3116521471},{3116528640,3116529663},{3116534784,3116535807},{3116554240,3116555263},{3116557312,3116558335},{3116568576,3116569599},{3116570624,3116571647},
+	{3116615680,3116616703},{3116618752,3116619775},{3116620800,3116621823},{3116624896,3116625151},{3116636160,3116638207},{3116641280,3116642303},{3116645376,3116646399},{3116678144,3116679167},
+	{3116687360,3116688383},{3116699648,3116700671},{3116701696,3116702719},{3116710912,3116711935},{3116728320,3116728575},{3116728832,3116729087},{3116730368,3116731391},{3116737536,3116738559},
+	{3116744704,3116745727},{3116753920,3116754943},{3116757248,3116757759},{3116759040,3116760063},{3116779520,3116780031},{3116782592,3116783615},{3116809216,3116810239},{3116817408,3116818431},
+	{3116852224,3116853247},{3116856320,3116857343},{3116900352,3116901375},{3116918528,3116918783},{3116921856,3116922879},{3116940288,3116940543},{3116941056,3116941311},{3116944384,3116945407},
+	{3116961792,3116962559},{3116995584,3116996607},{3117006080,3117006847},{3117016064,3117017087},{3117022208,3117024255},{3117030400,3117031423},{3117034496,3117035519},{3117043712,3117044735},
+	{3117047808,3117048831},{3117049856,3117052927},{3117066240,3117067263},{3117073408,3117074431},{3117079552,3117080575},{3117083648,3117084671},{3117110272,3117110783},{3117120000,3117120511},
+	{3117127424,3117127679},{3117137920,3117138943},{3117144064,3117145087},{3117152512,3117152767},{3117154304,3117155327},{3117189120,3117190143},{3117201408,3117202431},{3117204480,3117205503},
+	{3117223936,3117224191},{3117235456,3117235967},{3117237248,3117238271},{3117240320,3117241343},{3117245440,3117246463},{3117251584,3117252607},{3117266944,3117267967},{3117269504,3117271551},
+	{3117282304,3117283327},{3117285376,3117285631},{3117286144,3117286399},{3117288448,3117289471},{3117290496,3117291519},{3117316608,3117317119},{3117339648,3117340671},{3117341696,3117343743},
+	{3117346816,3117347839},{3117363200,3117363711},{3117375488,3117376511},{3117377536,3117379583},{3117385728,3117386751},{3117392128,3117392383},{3117392896,3117393407},{3117396224,3117396735},
+	{3117409792,3117410047},{3117414400,3117415423},{3117468672,3117469695},{3117502464,3117502975},{3117513728,3117515775},{3117522944,3117523199},{3117523968,3117524991},{3117538304,3117539327},
+	{3117540352,3117541375},{3117566976,3117567999},{3117587456,3117587967},{3117588992,3117589503},{3117597696,3117598719},{3117601792,3117603839},{3117614080,3117615103},{3117625344,3117625599},
+	{3117626112,3117626367},{3117648896,3117649919},{3117650944,3117651199},{3117667328,3117668351},{3117669376,3117670399},{3117678080,3117678591},{3117686784,3117687807},{3117689856,3117690879},
+	{3117707264,3117707775},{3117708800,3117709311},{3117716480,3117716991},{3117721600,3117723135},{3117723648,3117724415},{3117728768,3117730815},{3117731840,3117732863},{3117748224,3117749503},
+	{3117766656,3117767679},{3117779968,3117780991},{3117792256,3117794303},{3117800448,3117801471},{3117805312,3117805567},{3117827072,3117827583},{3117834240,3117835263},{3117843456,3117844479},
+	{3117871104,3117872127},{3117904896,3117905919},{3117917184,3117918207},{3117921280,3117922303},{3117932544,3117933567},{3117946880,3117947903},{3117948928,3117949951},{3117959168,3117960191},
+	{3117977600,3117978623},{3117991936,3117992959},{3117995008,3117995519},{3118001408,3118001663},{3118004224,3118005247},{3118015488,3118016511},{3118021632,3118022655},{3118023680,3118024703},
+	{3118030848,3118031871},{3118038016,3118039039},{3118042112,3118043135},{3118048256,3118049279},{3118056448,3118057471},{3118061568,3118062591},{3118083072,3118084095},{3118103552,3118104575},
+	{3118136320,3118137343},{3118142464,3118143487},{3126854144,3126870015},{3130315776,3130316799},{3133071360,3133073407},{3133276160,3133280255},{3133309952,3133310463},{3133312000,3133313023},
+	{3133931520,3133997055},{3134406656,3134414847},{3134980096,3135045631},{3135269632,3135269887},{3135275008,3135291391},{3135488000,3135492095},{3135767040,3135767551},{3135895552,3135896575},
+	{3135985664,3135986687},{3135991808,3135993855},{3136108544,3136109567},{3137376256,3137380351},{3137388544,3137396735},{3139502080,3139510271},{3139764224,3139895295},{3140288512,3140296703},
+	{3140333568,3140337663},{3141525504,3141529599},{3142930432,3142934527},{3143041024,3143045119},{3144093696,3144097791},{3144466432,3144470527},{3149594112,3149594367},{3149881344,3149889535},
+	{3156738048,3156803583},{3156908032,3156912127},{3156926464,3156929791},{3156930304,3156932863},{3156933120,3156933631},{3158327808,3158328063},{3158353920,3158355967},{3158358016,3158360063},
+	{3158368256,3158370303},{3158394880,3158396927},{3158405120,3158409215},{3158413312,3158415359},{3158421504,3158423551},{3158446080,3158448127},{3158581248,3158589439},{3158630400,3158638591},
+	{3158851584,3158853119},{3158855680,3158857727},{3158857984,3158858495},{3158859520,3158859775},{3158860032,3158862591},{3158863104,3158863615},{3158864128,3158864383},{3158864640,3158865407},
+	{3158867200,3158867455},{3158884352,3158892543},{3160164352,3160166399},{3160213504,3160217599},{3160235008,3160235519},{3160268800,3160270847},{3160347904,3160348671},{3160350720,3160352767},
+	{3160354816,3160356863},{3160367104,3160369151},{3160371200,3160373247},{3160399872,3160401919},{3161612288,3161616383},{3161718784,3161735167},{3161784320,3161800703},{3161899008,3161915391},
+	{3161953280,3161955327},{3161989120,3161990143},{3161992192,3161993215},{3162054656,3162062847},{3162128384,3162136575},{3162218496,3162226687},{3162332160,3162332415},{3162390528,3162398719},
+	{3162800128,3162832895},{3163160576,3163193343},{3164897280,3164899327},{3164913664,3164915711},{3164928000,3165061119},{3165437952,3165454335},{3167783936,3167784959},{3167827712,3167828223},
+	{3167883264,3167887359},{3167903232,3167903743},{3167916032,3167920127},{3167987968,3167988223},{3168005888,3168010239},{3168022528,3168026623},{3168036864,3168038399},{3168040960,3168041215},
+	{3168041472,3168041983},{3168076800,3168077823},{3168080640,3168080895},{3168081408,3168081663},{3168081920,3168083967},{3168092160,3168096255},{3168111616,3168124927},{3168128000,3168128255},
+	{3168135680,3168136191},{3168137728,3168137983},{3168147712,3168147967},{3168148480,3168148735},{3168151552,3168153599},{3168156416,3168156671},{3168165120,3168165375},{3168174080,3168176127},
+	{3168211456,3168211967},{3168215808,3168216831},{3168864256,3168874495},{3168876544,3168878591},{3168880640,3168884735},{3168960512,3168993279},{3169034240,3169042431},{3169050624,3169051647},
+	{3169052160,3169052671},{3169849856,3169850367},{3169853440,3169854463},{3169855488,3169855999},{3169857280,3169857535},{3169866496,3169866751},{3169901568,3169901823},{3169902080,3169902591},
+	{3169914112,3169914367},{3169915136,3169915391},{3169926656,3169927167},{3169927424,3169927679},{3169939456,3169941503},{3169947648,3169951743},{3169958656,3169958911},{3169961472,3169961983},
+	{3170123776,3170127871},{3170136064,3170140159},{3171844096,3171860479},{3172786176,3172794367},{3173056512,3173122047},{3174252544,3174260735},{3174957056,3175022591},{3176865792,3176866559},
+	{3176898560,3176902655},{3177185280,3179282431},{3184099328,3184115711},{3184272384,3184272639},{3184280320,3184280831},{3184281344,3184281599},{3184288768,3184289023},{3187846912,3187847167},
+	{3187910656,3187912703},{3188051968,3188052991},{3188510720,3188518911},{3188520960,3188523007},{3188597760,3188598783},{3191647488,3191647743},{3191670528,3191673087},{3191673344,3191675903},
+	{3191713024,3191714815},{3191715072,3191718399},{3191718656,3191719167},{3193735168,3193745407},{3193746432,3193755647},{3193827328,3193831423},{3194068992,3194071039},{3194363904,3194367999},
+	{3194380288,3194382335},{3194384128,3194384383},{3194469376,3194470399},{3194592256,3194592767},{3194601472,3194602495},{3194656768,3194657023},{3194705920,3194707967},{3195060224,3195061247},
+	{3195062272,3195063295},{3195067392,3195068415},{3195084800,3195092991},{3195144960,3195145215},{3195232256,3195236351},{3195592704,3195596799},{3195654400,3195654911},{3195655168,3195655423},
+	{3195722752,3195723263},{3195782144,3195782399},{3195808768,3195809791},{3195860992,3195862015},{3199779840,3199780863},{3199819776,3199823871},{3201563648,3201564671},{3204791296,3204791807},
+	{3210739712,3210778623},{3210779136,3210779391},{3210779648,3210805247},{3211067392,3211080959},{3211081216,3211102207},{3211104256,3211132927},{3218497024,3218497535},{3218530304,3218530815},
+	{3218534400,3218538495},{3218597888,3218599935},{3220267008,3220275199},{3220333568,3220333823},{3220334080,3220334335},{3221086208,3221094399},{3221225984,3221226239},{3221235712,3221236223},
+	{3221241856,3221258239},{3221422080,3221487615},{3221571328,3221571583},{3221658112,3221658623},{3221681664,3221682175},{3222290432,3222292479},{3222964736,3222965247},{3223199744,3223200767},
+	{3223212032,3223214591},{3223226368,3223227391},{3223230464,3223232511},{3223250944,3223254015},{3223263744,3223263999},{3223320064,3223320319},{3223391744,3223391999},{3223396864,3223397119},
+	{3223430912,3223431167},{3223458816,3223459839},{3223460352,3223460863},{3223468032,3223471103},{3223471616,3223471871},{3223474176,3223476223},{3223478016,3223478271},{3223481344,3223483391},
+	{3223540992,3223541247},{3223569920,3223570175},{3223594496,3223595007},{3223595264,3223595519},{3223599104,3223599615},{3223600384,3223600639},{3223611136,3223611391},{3223615232,3223615487},
+	{3223615744,3223615999},{3223624192,3223624447},{3223627264,3223627519},{3223635456,3223635711},{3223637760,3223638271},{3223638528,3223638783},{3223640320,3223640575},{3223642624,3223642879},
+	{3223646464,3223646719},{3223648256,3223648511},{3223861248,3223862271},{3223863296,3223863551},{3223869440,3223873535},{3223882752,3223883263},{3223883776,3223885823},{3223889920,3223896063},
+	{3223912448,3223937023},{3223938048,3223938559},{3223955968,3223956479},{3223968512,3223968767},{3224126464,3224126975},{3224379392,3224379647},{3224393728,3224394751},{3224427520,3224427775},
+	{3224431616,3224432127},{3224675840,3224676351},{3224694528,3224694783},{3224834560,3224835071},{3224881920,3224882175},{3224884736,3224884991},{3224957952,3224958207},{3225059328,3225059583},
+	{3225420800,3225421823},{3225425920,3225426943},{3225431040,3225431551},{3225440256,3225442303},{3225448448,3225450495},{3225458688,3225459711},{3225471744,3225472255},{3225480192,3225481215},
+	{3225543936,3225544191},{3225550336,3225550591},{3225566208,3225567231},{3225617408,3225617663},{3225618688,3225618943},{3225666816,3225667327},{3225676800,3225677823},{3225711616,3225712127},
+	{3225758720,3225759231},{3225769984,3225772031},{3225796608,3225805823},{3225808896,3225809919},{3225810944,3225812991},{3225857024,3225857279},{3225867520,3225867775},{3225869824,3225870079},
+	{3225880576,3225880831},{3225881088,3225881343},{3225881600,3225881855},{3225884416,3225884671},{3225885184,3225885695},{3225886208,3225886463},{3225887744,3225887999},{3225888256,3225888511},
+	{3225889280,3225890047},{3225890304,3225890559},{3225890816,3225891071},{3225891328,3225891583},{3225891840,3225892095},{3225893120,3225893375},{3225893632,3225893887},{3225894144,3225894399},
+	{3225897472,3225897727},{3225899264,3225899519},{3225904896,3225905151},{3225910784,3225911039},{3225914880,3225915135},{3225915392,3225915647},{3225917184,3225917439},{3225918720,3225918975},
+	{3225926400,3225926655},{3225927680,3225927935},{3225928192,3225928447},{3225929984,3225930239},{3225932544,3225932799},{3225933056,3225933311},{3225934336,3225934591},{3225936640,3225936895},
+	{3225938176,3225938431},{3225941248,3225941503},{3225941760,3225942015},{3225942272,3225942527},{3226030080,3226030591},{3226068992,3226075135},{3226107904,3226109951},{3226132480,3226140671},
+	{3226200064,3226201087},{3226236928,3226237183},{3226241536,3226241791},{3226333184,3226337279},{3226470400,3226470655},{3226471424,3226472447},{3226480896,3226481151},{3226501120,3226517503},
+	{3226548224,3226548735},{3226566656,3226569727},{3226587136,3226591231},{3226597376,3226598143},{3226627328,3226627583},{3226628864,3226629119},{3226693632,3226694143},{3226715904,3226716159},
+	{3226729984,3226730495},{3226742784,3226743295},{3226870784,3226871807},{3226893568,3226894079},{3227017984,3227018239},{3227032320,3227032575},{3227204608,3227204863},{3227205120,3227205375},
+	{3227205632,3227205887},{3227279616,3227279871},{3227283968,3227284223},{3227301376,3227301631},{3227324416,3227325439},{3227411712,3227411967},{3227451392,3227467775},{3227480064,3227484159},
+	{3227568128,3227570175},{3227713536,3227779071},{3227798784,3227799039},{3227805696,3227806463},{3227807488,3227807999},{3227808768,3227809023},{3227809792,3227810047},{3227810304,3227811071},
+	{3227811328,3227811583},{3227812352,3227812607},{3227856384,3227856895},{3227863552,3227863807},{3227895040,3227895551},{3227931136,3227931391},{3227973632,3227973887},{3228082176,3228082687},
+	{3228271872,3228272127},{3228300032,3228300287},{3228322304,3228322815},{3228364544,3228364799},{3228368384,3228368895},{3228383232,3228383487},{3228389632,3228389887},{3228395008,3228395263},
+	{3228397312,3228397567},{3228405504,3228405759},{3228475392,3228477439},{3228479488,3228483583},{3228509440,3228509695},{3228513792,3228514303},{3228532736,3228540927},{3228616704,3228617727},
+	{3229026304,3229028351},{3229040640,3229057023},{3229060096,3229061119},{3229065216,3229069311},{3229158400,3229158655},{3229159424,3229159935},{3229160960,3229161471},{3229163264,3229163519},
+	{3229164288,3229164543},{3229165056,3229165311},{3229166592,3229166847},{3229167104,3229167615},{3229173504,3229173759},{3229176320,3229176575},{3229180672,3229180927},{3229182976,3229183231},
+	{3229184000,3229184511},{3229186560,3229187839},{3229189120,3229190655},{3229191168,3229191423},{3229192704,3229193727},{3229194240,3229194495},{3229195008,3229195263},{3229196800,3229197311},
+	{3229197824,3229198335},{3229198848,3229199359},{3229202688,3229203199},{3229212928,3229213183},{3229218048,3229218303},{3229219584,3229219839},{3229356544,3229356799},{3229382400,3229382655},
+	{3229385728,3229385983},{3229415680,3229415935},{3229506048,3229507583},{3229712384,3229745151},{3229816064,3229816575},{3229844736,3229844991},{3229891072,3229891327},{3229961216,3229962751},
+	{3229976576,3229978623},{3230129920,3230130175},{3230138112,3230138367},{3230152448,3230152703},{3230317824,3230318079},{3230323200,3230323711},{3230350848,3230351103},{3230367232,3230367487},
+	{3230787584,3230789631},{3230859008,3230859263},{3230903808,3230904063},{3230904320,3230905343},{3230969088,3230969343},{3231006208,3231006463},{3231007232,3231007487},{3231066368,3231066623},
+	{3231103232,3231103487},{3231110656,3231111167},{3231156224,3231158271},{3231170816,3231171071},{3231178752,3231183871},{3231184896,3231187199},{3231189504,3231189759},{3231294208,3231294463},
+	{3231342592,3231346687},{3231352832,3231354879},{3231372544,3231373055},{3231375360,3231377407},{3231379712,3231379967},{3231382016,3231382271},{3231394304,3231395071},{3231395840,3231397631},
+	{3231404032,3231408127},{3231424512,3231428607},{3231432704,3231449087},{3231505152,3231505407},{3231511808,3231512063},{3231512320,3231512575},{3231520768,3231521791},{3231522304,3231522559},
+	{3231526912,3231529983},{3231563776,3231580159},{3231583232,3231584255},{3231587328,3231588351},{3231637504,3231641599},{3231686912,3231687679},{3231688192,3231688703},{3231713792,3231714047},
+	{3231717888,3231718143},{3231729152,3231729407},{3231739136,3231739391},{3231776768,3231777023},{3231789056,3231793151},{3231797248,3231801343},{3231817728,3231825919},{3231848448,3231849471},
+	{3231867904,3231868927},{3231877120,3231878143},{3231903744,3231905791},{3231911424,3231912447},{3231948800,3231956991},{3232041216,3232041471},{3232051200,3232051455},{3232056064,3232056575},
+	{3232069888,3232070143},{3232070400,3232070655},{3232079872,3232080895},{3232084480,3232084991},{3232089600,3232089855},{3232091392,3232091647},{3232097280,3232097535},{3232101120,3232101375},
+	{3232103168,3232103423},{3232302592,3232303103},{3232312320,3232317439},{3232318464,3232319487},{3232321536,3232325631},{3232333824,3232366591},{3232403456,3232407551},{3232438272,3232440319},
+	{3232489472,3232497663},{3232600064,3232604159},{3232649216,3232661503},{3232697600,3232697855},{3232699904,3232700415},{3232704512,3232704767},{3232706560,3232706815},{3232718848,3232727039},
+	{3232766720,3232767231},{3232791040,3232791295},{3232821760,3232822015},{3232825344,3233021951},{3233284096,3233285119},{3233286144,3233288191},{3233292288,3233300479},{3233304576,3233308671},
+	{3233447936,3233480703},{3233612288,3233612543},{3233618176,3233618431},{3233650432,3233650687},{3233676544,3233676799},{3233677312,3233677567},{3233697792,3233699839},{3233701376,3233701631},
+	{3234024704,3234024959},{3234026752,3234027007},{3234039808,3234040063},{3234110464,3234111487},{3234123776,3234127871},{3234158336,3234158591},{3234163456,3234164223},{3234174464,3234174719},
+	{3234186240,3234186495},{3234189056,3234189311},{3234190336,3234191103},{3234200064,3234200575},{3234200832,3234201087},{3234222080,3234234367},{3234250752,3234254847},{3234273280,3234275327},
+	{3234336768,3234340863},{3234369536,3234371583},{3234373632,3234390015},{3234532352,3234538751},{3234587648,3234587903},{3234592512,3234592767},{3234594816,3234660351},{3234727936,3234728191},
+	{3234900736,3234900991},{3234902016,3234906111},{3234938368,3234938879},{3235000320,3235004415},{3235020800,3235053823},{3235065856,3235069951},{3235282944,3235315711},{3235406848,3235407103},
+	{3235408384,3235408639},{3235446784,3235512319},{3235608576,3235633151},{3235642880,3235643135},{3235643392,3235708927},{3235803136,3235804159},{3235842560,3235843071},{3235846144,3235846399},
+	{3235846912,3235847167},{3235847936,3235848191},{3235995648,3235996927},{3235997184,3235999743},{3236024320,3236025855},{3236026112,3236026367},{3236027648,3236027903},{3236028160,3236030463},
+	{3236129280,3236129535},{3236131072,3236131327},{3236134912,3236167679},{3236174848,3236175103},{3236175360,3236175615},{3236238848,3236239359},{3236249600,3236265983},{3236306944,3236315135},
+	{3236343808,3236347903},{3236364288,3236364543},{3236365568,3236365823},{3236494336,3236495359},{3236497152,3236497407},{3236612608,3236613119},{3236724736,3236757503},{3236790272,3236823039},
+	{3236825856,3236826111},{3236855808,3236888575},{3236978688,3236986879},{3237002240,3237002495},{3237002752,3237003007},{3237003264,3237019647},{3237021696,3237022975},{3237036032,3237085183},
+	{3237163008,3237167103},{3237179392,3237183487},{3237347072,3237347327},{3237558272,3237560319},{3237572608,3237576703},{3237658624,3237662719},{3237670912,3237675263},{3237683200,3237683455},
+	{3237707776,3237708031},{3237724416,3237724671},{3237793792,3237797887},{3237867520,3237871615},{3237888000,3237896191},{3237937152,3238002687},{3238048256,3238048767},{3238053888,3238054911},
+	{3238201344,3238201599},{3238209280,3238209535},{3238214656,3238215167},{3238259200,3238259711},{3238263808,3238264575},{3238508544,3238510591},{3238536704,3238536959},{3238599680,3238599935},
+	{3239076096,3239076607},{3239134208,3239134463},{3239160576,3239160831},{3239161600,3239161855},{3239169536,3239170047},{3239267840,3239268607},{3239271424,3239271935},{3239276544,3239277055},
+	{3239305216,3239306239},{3239508736,3239508991},{3239509504,3239509759},{3239540992,3239541247},{3239546624,3239546879},{3239554048,3239554303},{3239568384,3239568639},{3239628800,3239629823},
+	{3239666688,3239667199},{3239684608,3239685119},{3239687680,3239688191},{3239692032,3239692287},{3239706880,3239707135},{3239712768,3239713023},{3239738112,3239738367},{3239763456,3239763711},
+	{3239782912,3239783167},{3239788544,3239789055},{3239790592,3239791103},{3239837184,3239837695},{3239859712,3239859967},{3239860480,3239860991},{3239862016,3239862271},{3239876608,3239876863},
+	{3239877120,3239877375},{3239896832,3239897087},{3239901952,3239902207},{3239954688,3239954943},{3239961088,3239961599},{3239969792,3239970047},{3240009984,3240010239},{3240166400,3240166911},
+	{3240178688,3240178943},{3240184832,3240185343},{3240193024,3240193535},{3240194560,3240195071},{3240212992,3240213503},{3240216064,3240216319},{3240221696,3240222207},{3240228864,3240229375},
+	{3240253440,3240254463},{3240265216,3240265471},{3240265728,3240266239},{3240267776,3240268287},{3240282624,3240282879},{3240310784,3240311039},{3240311296,3240311551},{3240336640,3240336895},
+	{3240364032,3240366079},{3240372992,3240373247},{3240419840,3240420095},{3240466432,3240466687},{3240473344,3240474623},{3240564736,3240566783},{3240577536,3240577791},{3240710912,3240711167},
+	{3240720384,3240720895},{3240730624,3240731647},{3240733184,3240733695},{3240740864,3240741119},{3240790528,3240790783},{3240791552,3240792063},{3240792832,3240793087},{3240804864,3240805119},
+	{3240809472,3240809727},{3240811776,3240812031},{3240843264,3240843519},{3240844288,3240844543},{3240875264,3240875519},{3240876544,3240877055},{3240880128,3240881151},{3241032960,3241033215},
+	{3241035008,3241035263},{3241037824,3241038079},{3241069824,3241070079},{3241077760,3241078015},{3241101056,3241101311},{3241108224,3241108479},{3241120512,3241120767},{3241121792,3241122047},
+	{3241123072,3241123327},{3241131008,3241131263},{3241477120,3241477375},{3241485568,3241485823},{3241681408,3241681663},{3241687552,3241687807},{3241780736,3241780991},{3241782272,3241782527},
+	{3241860096,3241860351},{3241864704,3241865215},{3241891840,3241892351},{3242590208,3242622975},{3242648064,3242648575},{3242818048,3242818303},{3243044352,3243044607},{3243512832,3243513087},
+	{3243529984,3243530239},{3243544320,3243544575},{3244141568,3244142591},{3244153856,3244154879},{3244342272,3244342527},{3244352768,3244353023},{3244354560,3244355071},{3244396288,3244396543},
+	{3244572672,3244580863},{3244617216,3244617471},{3244619264,3244619775},{3244657408,3244657663},{3244664576,3244664831},{3244819968,3244820223},{3244823296,3244823551},{3244826624,3244826879},
+	{3244828160,3244828415},{3244832768,3244833023},{3244846080,3244846335},{3244849152,3244849407},{3244866048,3244866303},{3244874496,3244874751},{3244881408,3244881663},{3244889344,3244889599},
+	{3244897024,3244897279},{3244899584,3244899839},{3244914688,3244914943},{3244916736,3244916991},{3244918272,3244918527},{3244924160,3244924927},{3244928000,3244928255},{3244930304,3244930559},
+	{3244932608,3244932863},{3244935168,3244935423},{3244939008,3244939263},{3244943104,3244943359},{3244956672,3244957695},{3244974080,3244975103},{3245036544,3245037567},{3245084928,3245085183},
+	{3245087488,3245087743},{3245103104,3245105151},{3245117440,3245118463},{3245119488,3245120511},{3245122560,3245122815},{3245127936,3245128191},{3245131776,3245132031},{3245158400,3245158911},
+	{3245162240,3245162495},{3245163520,3245164031},{3245177344,3245177599},{3245195264,3245197311},{3245202432,3245202687},{3245213184,3245213695},{3245233152,3245233407},{3245257728,3245258239},
+	{3245275136,3245277183},{3245293056,3245293567},{3245297152,3245297663},{3245312000,3245314047},{3245327872,3245328383},{3245872640,3245872895},{3245877248,3245877759},{3245881088,3245881343},
+	{3245908992,3245909503},{3246134272,3246134783},{3246174208,3246178303},{3246190592,3246191615},{3246651392,3246652415},{3247072512,3247072767},{3247078912,3247079167},{3247101952,3247106047},
+	{3247244032,3247244287},{3247267840,3247268351},{3247275264,3247275519},{3247347968,3247348223},{3247363072,3247363327},{3247363840,3247364095},{3247405312,3247405823},{3247703552,3247704063},
+	{3247713536,3247713791},{3247835136,3247835903},{3247854592,3247855615},{3247858176,3247858687},{3247866368,3247867391},{3247909888,3247910399},{3247921152,3247922175},{3248614912,3248615167},
+	{3248620800,3248621055},{3248684032,3248684543},{3248706560,3248709631},{3248718592,3248718847},{3248753664,3248754175},{3248783360,3248783615},{3248784128,3248784895},{3248790016,3248790271},
+	{3248802304,3248802815},{3248803328,3248803839},{3249088768,3249089023},{3249095680,3249096191},{3249098240,3249098751},{3249100288,3249100799},{3249105152,3249105407},{3249115136,3249115647},
+	{3249119232,3249119743},{3249120256,3249120767},{3249140736,3249141247},{3249538560,3249541119},{3249577728,3249582847},{3249586176,3249589503},{3249716480,3249716735},{3249721856,3249722111},
+	{3249805056,3249805311},{3249805824,3249806079},{3249806592,3249807359},{3249830656,3249830911},{3249831168,3249831423},{3249841152,3249841663},{3249843456,3249843967},{3249868800,3249869823},
+	{3249870848,3249871103},{3249881344,3249881599},{3249924608,3249924863},{3249932288,3249933311},{3249934336,3249934847},{3249935104,3249935359},{3249945856,3249946111},{3249956864,3249957119},
+	{3249959168,3249959423},{3249967104,3249967615},{3249992704,3249992959},{3250000896,3250001151},{3250016768,3250017535},{3250017792,3250018815},{3250020864,3250021375},{3250023424,3250024447},
+	{3250025472,3250025727},{3250026496,3250027519},{3250032384,3250032639},{3250051328,3250051583},{3250201600,3250202111},{3250257920,3250258175},{3250274304,3250274815},{3250276096,3250276351},
+	{3250359296,3250359807},{3250407936,3250408447},{3250409984,3250410495},{3250417664,3250418175},{3250426880,3250427135},{3250438144,3250446335},{3250629120,3250629375},{3250692352,3250692607},
+	{3250694400,3250694655},{3250699776,3250700287},{3250746368,3250747391},{3250757632,3250765823},{3251117568,3251117823},{3251124224,3251124735},{3251130368,3251130879},{3251134976,3251135487},
+	{3251142656,3251142911},{3251148288,3251148543},{3251150336,3251150591},{3251150848,3251151103},{3251151360,3251151615},{3251151872,3251152127},{3251154176,3251154431},{3251165696,3251165951},
+	{3251171584,3251171839},{3251196928,3251197951},{3251200000,3251200255},{3251211264,3251212287},{3251212800,3251212927},{3251226624,3251227135},{3251227648,3251228159},{3251232768,3251233791},
+	{3251245824,3251246079},{3251271424,3251271679},{3251272192,3251272447},{3251298304,3251302399},{3251318784,3251319807},{3251336704,3251337215},{3251358720,3251359231},{3251361024,3251361279},
+	{3252328448,3252329471},{3252342240,3252342271},{3252480000,3252480511},{3252508416,3252508671},{3252508928,3252509183},{3252516352,3252516607},{3252517120,3252517375},{3252518144,3252518399},
+	{3252636928,3252637183},{3252643072,3252643327},{3252829184,3252830207},{3252843520,3252843583},{3252905984,3252906239},{3252906496,3252906751},{3252907776,3252908031},{3252908288,3252908543},
+	{3252940288,3252940799},{3252941824,3252942335},{3252980992,3252981247},{3252981760,3252982015},{3252983296,3252983551},{3253193216,3253193471},{3253313536,3253313791},{3253376512,3253376767},
+	{3253378048,3253378559},{3253388800,3253389055},{3253395456,3253395967},{3253408768,3253409279},{3253410560,3253410815},{3253416704,3253416959},{3253420544,3253421055},{3253432832,3253433087},
+	{3253441024,3253441535},{3253454848,3253455359},{3253456640,3253456895},{3253462016,3253462271},{3253464320,3253464575},{3253606400,3253607423},{3253632000,3253633023},{3253637120,3253638143},
+	{3253639168,3253639679},{3253647616,3253647871},{3253663744,3253664767},{3253666816,3253667839},{3253678080,3253679103},{3253699584,3253699839},{3253707776,3253708287},{3253708800,3253709311},
+	{3253713152,3253713407},{3253889792,3253890303},{3253892864,3253893119},{3253908992,3253909247},{3253916160,3253916671},{3253970944,3253971967},{3253974528,3253974783},{3254702592,3254703103},
+	{3254710272,3254710783},{3254780160,3254780671},{3254795008,3254795263},{3254819072,3254819327},{3254821632,3254821887},{3254830336,3254830591},{3254831104,3254831615},{3254841600,3254841855},
+	{3254844416,3254844671},{3254883840,3254884095},{3254886400,3254886655},{3254891776,3254892031},{3254896640,3254896895},{3254898176,3254898431},{3254898688,3254898943},{3254899712,3254899967},
+	{3255081216,3255081471},{3255126016,3255126271},{3255197696,3255205887},{3255233280,3255233535},{3255311872,3255312127},{3255327744,3255328255},{3255390720,3255391487},{3255399936,3255400447},
+	{3255414528,3255414783},{3255416320,3255416831},{3255628544,3255628799},{3255658496,3255659519},{3255681024,3255685119},{3255697920,3255698175},{3255698688,3255698943},{3255700224,3255700479},
+	{3255704576,3255705087},{3255706624,3255707135},{3255708928,3255709183},{3255718912,3255719423},{3255719680,3255719935},{3255743232,3255743487},{3255747584,3255748095},{3255750144,3255750911},
+	{3255752960,3255753215},{3255753472,3255753727},{3255754240,3255754751},{3255757824,3255758079},{3255791872,3255792383},{3255809792,3255810047},{3255818752,3255819007},{3255822592,3255822847},
+	{3256090624,3256221695},{3256401920,3256410111},{3256411648,3256412159},{3256504576,3256504831},{3256510464,3256511487},{3256512000,3256513023},{3256643584,3256646655},{3256654848,3256655871},
+	{3256658944,3256659967},{3256729600,3256731647},{3256790784,3256791039},{3256793344,3256793599},{3256812032,3256812287},{3256826624,3256826879},{3256827392,3256827647},{3256919040,3256919295},
+	{3256931840,3256932095},{3256971264,3256971775},{3256988672,3256988927},{3257038848,3257040895},{3257144576,3257144831},{3257152000,3257152511},{3257153024,3257153279},{3257153536,3257153791},
+	{3257357312,3257357567},{3257390592,3257390847},{3257472000,3257472511},{3257473024,3257474303},{3257474560,3257475071},{3257548800,3257556991},{3257564160,3257564671},{3257578496,3257580543},
+	{3257753856,3257754111},{3257768448,3257768703},{3257776128,3257776383},{3257978624,3257978879},{3257979392,3257979647},{3257980160,3257980415},{3257981184,3257981439},{3258006528,3258006783},
+	{3258065152,3258065407},{3258065920,3258066175},{3258070528,3258070783},{3258071296,3258071807},{3258098432,3258098687},{3258104576,3258104831},{3258268672,3258268927},{3258308608,3258310655},
+	{3258339328,3258340351},{3258341376,3258342399},{3258384896,3258385407},{3258406912,3258407167},{3258407680,3258407935},{3258587136,3258588159},{3258597376,3258597887},{3258612736,3258612991},
+	{3258636288,3258637311},{3258651136,3258652671},{3258693376,3258693631},{3258729472,3258729727},{3258730240,3258730495},{3258792704,3258792959},{3258793984,3258794239},{3258819072,3258819583},
+	{3258821888,3258822399},{3258903808,3258904063},{3258944512,3258945535},{3258974208,3259039743},{3259219968,3259228159},{3259243008,3259243519},{3259244544,3259244799},{3259245312,3259245567},
+	{3259246592,3259247871},{3259248896,3259249151},{3259251456,3259251711},{3259256832,3259257343},{3259260928,3259261183},{3259265024,3259265535},{3259266560,3259266815},{3259271168,3259271679},
+	{3259277056,3259277311},{3259277568,3259277823},{3259278592,3259278847},{3259279616,3259280383},{3259283200,3259283455},{3259292416,3259292671},{3259296768,3259297023},{3259347200,3259347455},
+	{3259354112,3259354367},{3259427328,3259427583},{3259435264,3259435519},{3259457280,3259457535},{3259466240,3259466495},{3259470848,3259471871},{3259473152,3259473407},{3259475200,3259475455},
+	{3259476224,3259476735},{3259485184,3259485439},{3259488256,3259488767},{3259490304,3259490815},{3259491072,3259491327},{3259765504,3259765759},{3259810560,3259810815},{3259823872,3259824127},
+	{3259842816,3259843071},{3259964416,3259965439},{3260547072,3260547327},{3260563712,3260563967},{3260571648,3260574719},{3260575744,3260579839},{3260580864,3260581375},{3260583424,3260583935},
+	{3260601344,3260601855},{3261518336,3261518591},{3261532416,3261533183},{3261533440,3261533695},{3261534208,3261534463},{3261534720,3261534975},{3261538560,3261538815},{3261540608,3261540863},
+	{3261553920,3261554175},{3261560832,3261561087},{3261582848,3261583359},{3261584128,3261584895},{3261590528,3261590783},{3261612032,3261616127},{3261687296,3261687807},{3261695488,3261695999},
+	{3261850624,3261850879},{3262006016,3262006271},{3262006784,3262007039},{3262029824,3262030335},{3262040832,3262041087},{3262042880,3262043135},{3262043648,3262044159},{3262050560,3262050815},
+	{3262051328,3262051583},{3262124032,3262136319},{3262220288,3262221055},{3262240768,3262241279},{3262246912,3262247423},{3262414848,3262415359},{3262426624,3262427135},{3262429184,3262429695},
+	{3262437888,3262438399},{3262611456,3262627839},{3262672128,3262672383},{3262674688,3262674943},{3262795776,3262796799},{3262944256,3262945279},{3263037440,3263053823},{3263070464,3263070719},
+	{3263072256,3263073535},{3263073792,3263074047},{3263075328,3263075839},{3263081472,3263082495},{3263099392,3263099647},{3263102208,3263102463},{3263142656,3263142911},{3263143168,3263143423},
+	{3263188992,3263190015},{3263432960,3263433215},{3263433472,3263433727},{3263438080,3263438335},{3263438592,3263439103},{3263443200,3263443967},{3263446272,3263447039},{3263458816,3263459583},
+	{3263460096,3263460351},{3263465984,3263466495},{3263481856,3263482879},{3263484160,3263484415},{3263532800,3263536895},{3263633920,3263634431},{3263639552,3263640575},{3263661056,3263661567},
+	{3263854592,3263856639},{3264015360,3264015615},{3264019200,3264019711},{3264320256,3264320511},{3264328704,3264329727},{3264332800,3264333311},{3264335872,3264336383},{3264339968,3264340223},
+	{3264340480,3264340735},{3264344064,3264345087},{3264392192,3264393215},{3264610304,3264626687},{3264651776,3264652287},{3264658432,3264658943},{3264659968,3264660223},{3264663552,3264664063},
+	{3264668672,3264669183},{3264749568,3264750079},{3264752640,3264753151},{3264754688,3264754943},{3264778240,3264778495},{3264832000,3264832255},{3264836608,3264836863},{3264862720,3264862975},
+	{3264897024,3264905215},{3265056256,3265056511},{3265063424,3265063679},{3265134592,3265142783},{3265175552,3265183743},{3265396736,3265462271},{3265609728,3265617919},{3265887488,3265887743},
+	{3265908736,3265908991},{3265911040,3265911551},{3265913088,3265913343},{3265913600,3265913855},{3265917952,3265918207},{3265920512,3265920767},{3266160896,3266161151},{3266201856,3266202111},
+	{3266345984,3266346239},{3266384896,3266385919},{3266387968,3266396159},{3266620416,3266620671},{3266628608,3266628863},{3266746368,3266748415},{3266781184,3266789375},{3266797568,3266805759},
+	{3267059712,3267060735},{3267075072,3267076095},{3267098624,3267099647},{3267559424,3267624959},{3268088832,3268089087},{3268745472,3268745727},{3268746752,3268747007},{3268769280,3268769791},
+	{3268964352,3268964863},{3269531648,3269533695},{3270642176,3270642687},{3270661120,3270661631},{3270672384,3270680575},{3270770688,3270836223},{3270901760,3270902783},{3270970368,3270970879},
+	{3270974976,3270975487},{3270977024,3270977279},{3270980864,3270981119},{3271744512,3271745023},{3271753216,3271753727},{3271802880,3271803903},{3271911424,3271911935},{3271914496,3271915007},
+	{3271916032,3271916543},{3271929600,3271929855},{3271930112,3271930367},{3271932672,3271932927},{3271933440,3271933695},{3272032256,3272040447},{3272065024,3272073215},{3272097792,3272105983},
+	{3272113408,3272113919},{3272131584,3272132095},{3272136192,3272136703},{3272266752,3272267263},{3272269568,3272269823},{3272355840,3272356863},{3272392448,3272392703},{3272423680,3272423935},
+	{3272475136,3272475391},{3272476672,3272476927},{3272480000,3272480511},{3272482560,3272482815},{3272505344,3272505855},{3272869888,3272870911},{3272871936,3272872959},{3272884224,3272892415},
+	{3272905984,3272906239},{3272924672,3272924927},{3272925184,3273007103},{3273024512,3273025535},{3273030656,3273031679},{3273148416,3273150463},{3273183232,3273187327},{3273188864,3273189375},
+	{3273261056,3273261567},{3273262080,3273262591},{3273283584,3273284607},{3273285632,3273293823},{3273438720,3273439231},{3273803264,3273803775},{3274052352,3274052607},{3274080256,3274088447},
+	{3274096640,3274113023},{3274178560,3274244095},{3274338304,3274338815},{3274373632,3274373887},{3274410496,3274410751},{3274416128,3274424319},{3274581760,3274582015},{3274698240,3274698495},
+	{3274964992,3275030527},{3275104256,3275105279},{3275137792,3275138047},{3275188224,3275189247},{3275252992,3275253247},{3275270656,3275270911},{3275271168,3275271423},{3275313408,3275313663},
+	{3275331584,3275332095},{3275407360,3275415551},{3275508736,3275509247},{3275512320,3275512447},{3275531264,3275531775},{3275532800,3275533311},{3275542528,3275543551},{3275547136,3275547391},
+	{3275622912,3275623423},{3275625472,3275625983},{3275627520,3275628031},{3275685888,3275751423},{3275759616,3275767807},{3275788800,3275789311},{3275901440,3275901695},{3275906816,3275907071},
+	{3275910912,3275911167},{3275913728,3275913983},{3275916288,3275916799},{3276071936,3276072447},{3276075520,3276076031},{3276076544,3276077055},{3276097536,3276098559},{3276140544,3276141567},
+	{3276292096,3276300287},{3276307456,3276309503},{3276310528,3276311551},{3276414976,3276423167},{3276423424,3276423679},{3276426240,3276426495},{3276427264,3276427519},{3276689920,3276690431},
+	{3276709888,3276718079},{3276727296,3276728319},{3276865536,3276931071},{3277184000,3277184255},{3277186304,3277186559},{3277193216,3277258751},{3277325312,3277326335},{3277326848,3277327359},
+	{3277328896,3277329407},{3277335552,3277336063},{3277336576,3277337087},{3277343232,3277343743},{3277354752,3277355007},{3277363200,3277363711},{3277376000,3277376511},{3277483008,3277483519},
+	{3277486080,3277486591},{3277651968,3277684735},{3277694976,3277695487},{3277698560,3277699071},{3277725696,3277733887},{3277820928,3277821183},{3277826048,3277826303},{3277832192,3277833215},
+	{3277843456,3277843967},{3277905920,3277914111},{3278241792,3278307327},{3278663168,3278663679},{3278768128,3278768639},{3278769664,3278770687},{3278771200,3278772223},{3278773760,3278774271},
+	{3278780928,3278781439},{3278791680,3278793215},{3278793472,3278793727},{3278794752,3278795007},{3278796288,3278798847},{3278946304,3278954495},{3279028224,3279028735},{3279031296,3279031551},
+	{3279044608,3279052799},{3279560704,3279568895},{3279586816,3279587327},{3279588608,3279588863},{3279950848,3279951871},{3279986688,3279987199},{3279990272,3279990783},{3279992832,3279993343},
+	{3280005632,3280006143},{3280126720,3280126975},{3280133120,3280133375},{3280325120,3280325631},{3280326656,3280327167},{3280388096,3280396287},{3280589824,3280590847},{3280591872,3280592383},
+	{3280662528,3280666623},{3280765952,3280766975},{3280783360,3280784383},{3280793600,3280794623},{3280796672,3280797695},{3280928768,3280994303},{3280996864,3280997119},{3280999936,3281000191},
+	{3281340928,3281341183},{3281348352,3281348607},{3281354752,3281371135},{3281649664,3281715199},{3281846272,3281911807},{3282101248,3282102271},{3282174976,3282175487},{3282178560,3282179071},
+	{3282191360,3282191871},{3282493440,3282494463},{3282722816,3282731007},{3282829312,3282894847},{3283156992,3283173375},{3283174400,3283175423},{3283206144,3283206655},{3283223552,3283224063},
+	{3283263488,3283271679},{3283353600,3283419135},{3283472384,3283476479},{3283486208,3283486463},{3283499520,3283499775},{3283681280,3283746815},{3283946496,3283947519},{3283963904,3283964927},
+	{3283975168,3283976191},{3283979776,3283980287},{3283988992,3283989503},{3283990016,3283990527},{3283995136,3283995647},{3284001280,3284001791},{3284005888,3284006399},{3284014336,3284014847},
+	{3284015872,3284016127},{3284025344,3284033535},{3284043008,3284043263},{3284044032,3284044287},{3284044800,3284045055},{3284046336,3284046591},{3284048128,3284048383},{3284102144,3284102655},
+	{3284103680,3284104191},{3284130048,3284130559},{3284134400,3284134911},{3284685312,3284686335},{3284713472,3284713727},{3284725248,3284725759},{3284726272,3284726527},{3284811776,3284828159},
+	{3285121024,3285121535},{3285122048,3285122559},{3285328896,3285329407},{3285394432,3285395455},{3285410816,3285411839},{3285412864,3285413887},{3285419008,3285420031},{3285424128,3285425151},
+	{3285427200,3285427711},{3285637120,3285638143},{3285643264,3285645311},{3285712896,3285721087},{3285763072,3285763583},{3285772032,3285772287},{3285773312,3285773567},{3285775872,3285776127},
+	{3285778176,3285778431},{3285909504,3285975039},{3286316800,3286317055},{3286329344,3286330367},{3286345728,3286346751},{3286348288,3286348543},{3286349824,3286350847},{3286364160,3286365183},
+	{3286419712,3286419967},{3286635264,3286635519},{3286662656,3286662911},{3286895104,3286895615},{3286917632,3286918143},{3286936320,3286936575},{3286950912,3286951935},{3286955008,3286956031},
+	{3287173632,3287174143},{3287198720,3287199743},{3287214080,3287214335},{3287214848,3287215103},{3287218432,3287218687},{3287441920,3287442431},{3287446528,3287447039},{3287454208,3287454719},
+	{3287455744,3287456255},{3287459840,3287460095},{3287461120,3287461375},{3287471104,3287472127},{3287475200,3287476223},{3287477504,3287477759},{3287555072,3287555583},{3287643136,3287643647},
+	{3287645184,3287646207},{3287664896,3287665151},{3287711744,3287719935},{3287729920,3287730175},{3287738368,3287738879},{3287744512,3287810047},{3287818240,3287826431},{3287828224,3287828479},
+	{3287867392,3287867647},{3287869952,3287870463},{3287870976,3287871487},{3287949824,3287950335},{3288203264,3288236031},{3288236544,3288237055},{3288237568,3288238079},{3288334336,3288399871},
+	{3288435712,3288435967},{3288547328,3288547583},{3288610560,3288610815},{3288911616,3288912127},{3289020160,3289020415},{3289025024,3289025791},{3289048064,3289048319},{3289081344,3289081599},
+	{3289153536,3289161727},{3289382912,3289645055},{3291185152,3291201535},{3291210240,3291210495},{3291215360,3291215615},{3291312128,3291316223},{3291480064,3291545599},{3291742464,3291742975},
+	{3291744256,3291745023},{3291745792,3291746047},{3291750400,3291752447},{3291753216,3291754239},{3291754496,3291755263},{3291755520,3291756287},{3291756544,3291756799},{3291757312,3291757823},
+	{3291758080,3291758335},{3291760640,3291760895},{3291762176,3291762687},{3291762944,3291763455},{3291763712,3291763967},{3291765760,3291766015},{3291766272,3291767039},{3291807744,3291808767},
+	{3291812864,3291813119},{3291813376,3291813631},{3291813888,3291814143},{3291814912,3291815679},{3291815936,3291816703},{3291816960,3291818495},{3291818752,3291820287},{3291820544,3291822079},
+	{3291822336,3291823871},{3291824128,3291824639},{3291824896,3291825663},{3291826176,3291826431},{3291826688,3291827455},{3291828224,3291828479},{3291875328,3291875839},{3291878144,3291878399},
+	{3291879936,3291880191},{3291880448,3291880959},{3291881216,3291881471},{3291883776,3291884031},{3291884544,3291884799},{3291886336,3291886847},{3291887104,3291887615},{3291888896,3291889151},
+	{3291891456,3291891711},{3291893760,3291894015},{3291939328,3291939583},{3291939840,3291940095},{3291940608,3291940863},{3291943424,3291943679},{3291944960,3291945471},{3291945728,3291945983},
+	{3292004352,3292266495},{3300982784,3301048319},{3301179392,3301179647},{3301179904,3301180927},{3301181952,3301182207},{3301183488,3301183743},{3301184000,3301184255},{3301184512,3301184767},
+	{3301185024,3301185279},{3301185536,3301185791},{3301186560,3301186815},{3301187840,3301189631},{3301220352,3301220607},{3301449728,3301453823},{3302762496,3302763519},{3304563200,3304563711},
+	{3304578048,3304578303},{3304800256,3304801023},{3304812544,3304812799},{3304814592,3304816639},{3304847360,3304848383},{3315433472,3315449855},{3317555200,3317563391},{3319627776,3319635967},
+	{3320306688,3320307711},{3320508416,3320509439},{3320643584,3320709119},{3320766464,3320767487},{3320774656,3320791039},{3320979456,3320987647},{3320992768,3320993791},{3320994816,3320995839},
+	{3321036800,3321069567},{3322068992,3322085375},{3322126336,3322126591},{3322361856,3322363903},{3322372096,3322380287},{3322433536,3322437631},{3322645760,3322646015},{3322658816,3322675199},
+	{3322678272,3322679295},{3322691584,3322740735},{3322765312,3322773503},{3322888192,3322904575},{3322938368,3322939391},{3322953728,3322970111},{3323023360,3323023615},{3323057920,3323058175},
+	{3323065088,3323065343},{3323213824,3323214335},{3323215872,3323232255},{3323240448,3323248639},{3323256832,3323263999},{3323265024,3323267071},{3323346688,3323346943},{3323347456,3323347711},
+	{3323361536,3323361791},{3323387904,3323388159},{3323408384,3323461631},{3323464704,3323465727},{3323494400,3323510783},{3323674624,3323691007},{3323933184,3323933439},{3323957248,3323958271},
+	{3323962368,3323963391},{3324193792,3324194815},{3324398592,3324399615},{3324522496,3324526591},{3324600832,3324602879},{3324604416,3324606463},{3324607488,3324607999},{3324608512,3324641279},
+	{3324772352,3324805119},{3324813312,3324825599},{3324867584,3324868607},{3324915712,3324919807},{3324923904,3324927999},{3324936192,3324968959},{3324993536,3325001727},{3325046784,3325050879},
+	{3325059072,3325067263},{3325116416,3325120511},{3325171712,3325173759},{3325190144,3325231103},{3325242368,3325243391},{3325256192,3325256447},{3325267968,3325268479},{3325304832,3325306879},
+	{3325321216,3325329407},{3325337600,3325338111},{3325339648,3325339903},{3325454336,3325460479},{3325478912,3325479423},{3325486592,3325486847},{3325497344,3325498367},{3325517824,3325526015},
+	{3325591552,3325624319},{3325636352,3325636607},{3325657088,3325689855},{3325710336,3325722623},{3325802752,3325803007},{3325872128,3325874175},{3325911040,3325951999},{3326017536,3326279679},
+	{3326283520,3326283775},{3326443520,3326447615},{3326554112,3326558207},{3326561280,3326566399},{3326574592,3326607359},{3326631936,3326640127},{3326678784,3326679039},{3326685696,3326685951},
+	{3326750720,3326754815},{3326763008,3326771199},{3326796800,3326797823},{3326938368,3326938623},{3327397888,3327401983},{3327408128,3327426559},{3327590400,3327721471},{3327744000,3327754239},
+	{3327772160,3327772415},{3327873024,3327877119},{3328178176,3328179199},{3328188416,3328190463},{3328202752,3328204799},{3328323584,3328327679},{3328335872,3328344063},{3328357376,3328358399},
+	{3328384000,3328385023},{3328430080,3328430335},{3328448512,3328450559},{3328453632,3328454655},{3328479232,3328491519},{3328509952,3328511999},{3328540672,3328573439},{3328580608,3328581631},
+	{3328704512,3328770047},{3328776704,3328777215},{3328794624,3328795647},{3328796672,3328797695},{3328800000,3328801279},{3328802304,3328802815},{3328823296,3328827391},{3328832768,3328834815},
+	{3328835584,3328966655},{3330638592,3330638847},{3330643712,3330643967},{3330646528,3330647039},{3330699264,3330703359},{3330767872,3330768383},{3330769920,3330770175},{3330784256,3330785279},
+	{3330799872,3330800127},{3330812928,3330818047},{3330851328,3330851583},{3330932736,3331063807},{3331260416,3331268607},{3331276800,3331309567},{3331330048,3331334143},{3331350528,3331358719},
+	{3331362816,3331366911},{3331371008,3331375103},{3331527680,3331530751},{3331608576,3331620863},{3331949312,3331949567},{3331974912,3331975167},{3332001792,3332014079},{3332030464,3332046847},
+	{3332500736,3332500991},{3332571904,3332572159},{3332572672,3332572927},{3332573184,3332575231},{3332600576,3332600831},{3332602368,3332602623},{3332603904,3332605951},{3332608000,3332610047},
+	{3332610816,3332611071},{3332611584,3332612095},{3332616960,3332617215},{3332625408,3332625919},{3332630528,3332631551},{3332631808,3332632063},{3332632320,3332632575},{3332868096,3332870143},
+	{3332882432,3332890623},{3333029888,3333292031},{3333359872,3333360127},{3333361408,3333361663},{3333389312,3333390335},{3333400320,3333400831},{3333401088,3333401343},{3333415936,3333416191},
+	{3333417984,3333418239},{3333434368,3333439487},{3333475584,3333475839},{3333502976,3333503999},{3333519360,3333521407},{3333539328,3333539583},{3333583872,3333586943},{3333594368,3333594623},
+	{3333605376,3333605631},{3333677312,3333677567},{3333721088,3333721343},{3333728000,3333728255},{3333758976,3333763071},{3333765120,3333766143},{3333780480,3333781503},{3333869312,3333869823},
+	{3333938688,3333938943},{3333952000,3333952255},{3334127104,3334128383},{3334138880,3334139135},{3334151168,3334152191},{3334192128,3334192383},{3334239232,3334240255},{3334342912,3334343167},
+	{3334946816,3334963199},{3335004160,3335012351},{3335164416,3335164671},{3335192064,3335192319},{3335199744,3335200767},{3335352320,3335356415},{3335391232,3335393279},{3335655424,3335657471},
+	{3335716864,3335733247},{3335741440,3335749631},{3335828480,3335828735},{3336114176,3336114431},{3336986624,3336988415},{3336988672,3336989183},{3337125376,3337125631},{3337128704,3337128959},
+	{3337685504,3337686015},{3337694208,3337695231},{3337891840,3337895935},{3337957376,3337965567},{3338017792,3338018815},{3338021888,3338022911},{3338076160,3338141695},{3338354688,3338360831},
+	{3338361088,3338361343},{3338420224,3338424319},{3338428416,3338432511},{3338436608,3338437631},{3338444544,3338444799},{3338450432,3338450687},{3338551296,3338555391},{3338721280,3338723327},
+	{3338944512,3338960895},{3338983168,3338983423},{3338988288,3338988543},{3338989824,3338990079},{3339000320,3339000575},{3339027712,3339027967},{3339031296,3339031551},{3339033600,3339034111},
+	{3339145728,3339146239},{3339147008,3339147775},{3339148800,3339149311},{3339160576,3339160831},{3339180032,3339181055},{3339189248,3339189503},{3339261952,3339263999},{3339278080,3339278847},
+	{3339319296,3339321343},{3339674112,3339674623},{3339677696,3339679743},{3339689984,3339691007},{3339692032,3339694079},{3339703296,3339703807},{3339712512,3339714559},{3339716608,3339718655},
+	{3339722496,3339722751},{3339727872,3339728895},{3339752192,3339752447},{3339754496,3339755519},{3339761664,3339763711},{3339924224,3339924479},{3339924736,3339926015},{3339934720,3339935743},
+	{3339936256,3339936511},{3339937792,3339939839},{3339942912,3339943935},{3339947520,3339948031},{3339962368,3339964415},{3339974656,3339976703},{3340058624,3340060671},{3340061696,3340062719},
+	{3340066816,3340067839},{3340070912,3340071935},{3340080128,3340081151},{3340101632,3340103679},{3340391424,3340392447},{3340419072,3340419327},{3340453888,3340455935},{3340468224,3340470271},
+	{3340484608,3340485631},{3340644352,3340646399},{3340659712,3340660479},{3340666880,3340668927},{3340677120,3340680191},{3340682240,3340683263},{3340690432,3340691455},{3340695552,3340697599},
+	{3340859392,3340861439},{3340891136,3340891391},{3340898304,3340902399},{3340952576,3340953599},{3341051904,3341053951},{3341056000,3341057023},{3341060096,3341063167},{3341067008,3341067263},
+	{3341081344,3341082623},{3341086720,3341087743},{3341089792,3341090815},{3341190144,3341190399},{3341202432,3341203455},{3341215744,3341216767},{3341518336,3341518591},{3341534976,3341535231},
+	{3341536256,3341536511},{3341537024,3341537279},{3341615104,3341618175},{3341636608,3341636863},{3341750272,3341754367},{3341756160,3341756415},{3341770496,3341770751},{3341784064,3341785087},
+	{3341795328,3341797375},{3341802496,3341805567},{3341807616,3341808639},{3341829120,3341830143},{3341833216,3341834239},{3341838336,3341838591},{3341845504,3341846527},{3341852672,3341854719},
+	{3341856768,3341858815},{3341860864,3341862911},{3341870080,3341870591},{3341873152,3341875199},{3341877248,3341878271},{3342487552,3342489599},{3342493696,3342494719},{3342499840,3342501887},
+	{3342508032,3342510079},{3342512128,3342515199},{3342517248,3342520319},{3342520832,3342521087},{3342530560,3342531583},{3342546944,3342551039},{3342552064,3342553087},{3342555136,3342558207},
+	{3342569472,3342571519},{3342592000,3342593023},{3342614528,3342622719},{3342624000,3342624255},{3342624512,3342624767},{3342657536,3342657791},{3342872576,3342873087},{3343013888,3343015935},
+	{3343019008,3343021055},{3343036928,3343037183},{3343172608,3343173631},{3343177728,3343178751},{3343181824,3343183871},{3343202816,3343203327},{3343355392,3343355903},{3343368192,3343372287},
+	{3343372544,3343372799},{3343373312,3343374335},{3343378432,3343379455},{3343458304,3343460863},{3343480832,3343482879},{3343571968,3343572223},{3343855616,3343856639},{3343895040,3343895295},
+	{3343908608,3343908863},{3344117760,3344118783},{3344128000,3344130047},{3344131584,3344132095},{3344138240,3344140287},{3344217600,3344217855},{3344390144,3344392191},{3344498688,3344500735},
+	{3344548352,3344548607},{3344643072,3344643583},{3344648192,3344649215},{3344664320,3344664575},{3344971776,3344973823},{3344977920,3344979967},{3344997376,3344998399},{3345308672,3345311743},
+	{3345326336,3345326591},{3345328128,3345329151},{3345332224,3345333247},{3345334272,3345334527},{3345335296,3345335551},{3345336320,3345337343},{3345342464,3345344511},{3345367040,3345369087},
+	{3345370112,3345371135},{3345395712,3345396735},{3345420288,3345422847},{3345448960,3345481727},{3345498112,3345498623},{3346192384,3346194431},{3346201088,3346201343},{3346227200,3346229247},
+	{3346231296,3346233343},{3346241536,3346243071},{3346244608,3346245631},{3346251776,3346252799},{3346253824,3346254847},{3346260992,3346262015},{3346296832,3346298879},{3346299904,3346300927},
+	{3346312192,3346313215},{3346490368,3346491391},{3346509824,3346510847},{3346515968,3346518015},{3346522112,3346523135},{3346529792,3346530047},{3346591232,3346591743},{3346691072,3346692095},
+	{3347005440,3347006463},{3347007488,3347009535},{3347013632,3347015679},{3347016704,3347016959},{3347025920,3347026175},{3347026944,3347027967},{3347046400,3347047423},{3347048448,3347049471},
+	{3347050496,3347052543},{3349419264,3349419519},{3349421056,3349421311},{3349461248,3349461503},{3349467648,3349467903},{3349517568,3349517823},{3349519104,3349519359},{3349519616,3349519871},
+	{3349525248,3349525503},{3349552640,3349553151},{3349553664,3349554175},{3349554432,3349554687},{3349614592,3349616639},{3349617664,3349617919},{3349644288,3349646335},{3349647360,3349649407},
+	{3349660672,3349662719},{3349665792,3349668863},{3349698560,3349699583},{3349704704,3349706751},{3349710848,3349712895},{3349713920,3349714431},{3349714688,3349714943},{3349723136,3349725183},
+	{3349825536,3349825791},{3350136832,3350138879},{3350176256,3350176511},{3350488064,3350489087},{3350491136,3350493183},{3350495232,3350497279},{3350504192,3350504447},{3350508544,3350509567},
+	{3350527488,3350527999},{3350552576,3350552831},{3350588928,3350589439},{3350590208,3350590463},{3350593536,3350601727},{3350601984,3350603007},{3350603264,3350606847},{3350620160,3350623231},
+	{3350627328,3350628351},{3350634496,3350636543},{3350761472,3350763519},{3350768384,3350768895},{3350772736,3350772991},{3350778880,3350779135},{3350782464,3350782719},{3350836224,3350836479},
+	{3350951936,3350955007},{3350963200,3350964223},{3350965248,3350966271},{3350974464,3350975487},{3351005184,3351006207},{3351012352,3351015423},{3351016448,3351017471},{3351024640,3351025151},
+	{3351026688,3351029759},{3351037952,3351039999},{3351047168,3351047679},{3351058944,3351059455},{3351071744,3351072767},{3351073792,3351074815},{3351078912,3351080959},{3351102208,3351102463},
+	{3351115776,3351117823},{3351129088,3351129855},{3351197696,3351198719},{3351267328,3351269375},{3351275520,3351276543},{3351277568,3351278591},{3351300096,3351302143},{3351304192,3351305215},
+	{3351315968,3351316479},{3351327744,3351328767},{3351332864,3351334911},{3351343104,3351345151},{3351359488,3351360511},{3351377920,3351379967},{3351448832,3351449087},{3351475200,3351476223},
+	{3351481344,3351482367},{3351485440,3351486463},{3351486976,3351487487},{3351494656,3351496703},{3351504896,3351506943},{3351508992,3351511039},{3351512576,3351513087},{3351579136,3351579647},
+	{3351775744,3351775999},{3351780352,3351781375},{3351799808,3351800831},{3351861248,3351862271},{3351889152,3351889407},{3351898368,3351898623},{3351901184,3351901439},{3351912448,3351920639},
+	{3351941888,3351942143},{3352036352,3352037375},{3352039424,3352041471},{3352047616,3352049663},{3352055808,3352056319},{3352056576,3352057855},{3352070144,3352071167},{3352076032,3352076287},
+	{3352082432,3352083455},{3352559616,3352559871},{3352568832,3352569087},{3352581632,3352582143},{3352596224,3352596479},{3352830464,3352831231},{3352864512,3352864767},{3352911872,3352913919},
+	{3352915968,3352918015},{3352920064,3352952831},{3353309696,3353311231},{3353339904,3353341951},{3353345024,3353350143},{3353733120,3353734143},{3353737216,3353739263},{3353821184,3353823231},
+	{3353826304,3353827327},{3353851904,3353853951},{3353858048,3353860095},{3353864192,3353864447},{3353870336,3353935871},{3353966080,3353966335},{3353989632,3353989887},{3353992192,3353993215},
+	{3353995264,3353997311},{3353998336,3353999359},{3354001408,3354066943},{3354132480,3354460159},{3354467328,3354468351},{3354484736,3354486783},{3354490880,3354492927},{3354497024,3354498047},
+	{3354507264,3354511359},{3354675200,3354676223},{3354685440,3354687487},{3354726400,3354730495},{3354736640,3354738175},{3354738432,3354738687},{3354747904,3354748415},{3354755328,3354755583},
+	{3354805248,3354806271},{3354842624,3354842879},{3355013120,3355017215},{3355030272,3355031295},{3355083008,3355083263},{3355260928,3355262719},{3355319296,3355320319},{3355324416,3355328511},
+	{3355355136,3355355391},{3355366656,3355366911},{3355370752,3355371007},{3355385856,3355386879},{3355412480,3355413503},{3355414528,3355415551},{3355417600,3355418623},{3355426816,3355427839},
+	{3355430912,3355431935},{3355432192,3355432959},{3355441152,3355442175},{3355875328,3355877375},{3355930368,3355930623},{3356143616,3356144127},{3356152320,3356152575},{3356325888,3356326399},
+	{3356422400,3356422911},{3356426240,3356491775},{3356952320,3356952575},{3356999680,3357000703},{3357000960,3357001215},{3357095680,3357095935},{3357194240,3357194495},{3357199616,3357199871},
+	{3357621504,3357621759},{3357647104,3357647359},{3357657344,3357657855},{3357773824,3357776895},{3357829632,3357829887},{3357942528,3357942783},{3357947648,3357948159},{3358777344,3358779391},
+	{3358949376,3358965759},{3359109632,3359109887},{3359178752,3359191039},{3359199232,3359203327},{3359598592,3359600639},{3360145408,3360149503},{3360256000,3360258047},{3360354304,3360356351},
+	{3360423936,3360555007},{3362422784,3362427135},{3362476544,3362477055},{3362996224,3362998271},{3363008512,3363010559},{3363023616,3363023871},{3363024128,3363024639},{3363831808,3372220415},
+	{3372613632,3372679167},{3372732416,3372733439},{3373531136,3373547519},{3374411776,3374415871},{3375243264,3375251455},{3375484928,3375489023},{3375628288,3375693823},{3376930816,3376934911},
+	{3377528832,3377594367},{3377659904,3377725439},{3380806400,3380806655},{3380837376,3380838399},{3380857856,3380858879},{3382052352,3382052863},{3382080512,3382081535},{3382665984,3382667007},
+	{3382667264,3382667519},{3382673408,3382677503},{3383689216,3383701503},{3386503168,3386504191},{3386548224,3386556415},{3386605568,3386613759},{3386640896,3386641151},{3389037568,3389038079},
+	{3389152256,3389153279},{3389197568,3389197823},{3389211648,3389212671},{3389213440,3389213695},{3389230080,3389231103},{3389301248,3389301759},{3389307136,3389307391},{3389358080,3389366271},
+	{3389381632,3389381887},{3389382144,3389382655},{3389528320,3389528575},{3389541888,3389542399},{3389543424,3389544447},{3389596672,3389597695},{3389603840,3389612031},{3389802240,3389802495},
+	{3389802752,3389803519},{3389806592,3389806847},{3389808896,3389809151},{3389963008,3389963263},{3390325504,3390325759},{3390442240,3390442495},{3390472192,3390480383},{3390832896,3390833151},
+	{3390834688,3390836735},{3390838784,3390839807},{3390844160,3390844927},{3390848000,3390849023},{3390850048,3390851071},{3390852096,3390853119},{3390856192,3390857215},{3390862336,3390863359},
+	{3390896128,3390897151},{3390905856,3390906111},{3390913024,3390913279},{3390913536,3390913791},{3390919168,3390919679},{3391449600,3391450111},{3391454976,3391455231},{3391478784,3391479039},
+	{3391532032,3391533055},{3391661056,3391662079},{3391838208,3391838719},{3391838976,3391839231},{3391881216,3391883263},{3391894528,3391895551},{3391987712,3391989759},{3392018432,3392019455},
+	{3392026624,3392028671},{3392046080,3392047103},{3392081920,3392086015},{3392102144,3392102399},{3392114432,3392114687},{3392120576,3392120831},{3392295936,3392296191},{3392342016,3392344063},
+	{3392380928,3392385023},{3392406528,3392407551},{3392438528,3392438783},{3392441856,3392442111},{3392489728,3392489983},{3392528384,3392536575},{3392668672,3392669695},{3392708096,3392708607},
+	{3392825344,3392826367},{3392830208,3392830463},{3392913408,3392917503},{3392928256,3392928767},{3392946176,3392954367},{3392980224,3392980479},{3393025536,3393025791},{3393288704,3393289215},
+	{3393454080,3393474559},{3393503232,3393503487},{3393511424,3393519615},{3393552384,3393553407},{3393576960,3393585151},{3393675264,3393679359},{3393774592,3393775615},{3393858816,3393859071},
+	{3393861376,3393861631},{3393863168,3393863679},{3393908736,3393910783},{3393921024,3393929215},{3394059008,3394059263},{3394226944,3394227199},{3394299648,3394299903},{3394307072,3394308095},
+	{3394347008,3394355199},{3394439168,3394440191},{3394507776,3394508799},{3394527232,3394535423},{3394682368,3394682623},{3394703360,3394715647},{3394732032,3394740223},{3394799616,3394799871},
+	{3394906368,3394906623},{3394966272,3394966527},{3394969600,3394969855},{3394970624,3394971647},{3395076096,3395076351},{3395078144,3395078399},{3395178496,3395178751},{3395202048,3395203071},
+	{3397066752,3397067007},{3397216256,3397218303},{3397514240,3397515263},{3397525504,3397526527},{3397528576,3397529599},{3397533952,3397534207},{3397596928,3397597439},{3397598720,3397598975},
+	{3397605376,3397607423},{3397820416,3397828607},{3397913856,3397914111},{3397951488,3397959679},{3398156288,3398164479},{3398619136,3398621183},{3398781696,3398781951},{3398782720,3398782975},
+	{3398881280,3398885375},{3398894592,3398895615},{3399025664,3399026175},{3399077888,3399090175},{3399138816,3399139327},{3399331840,3399335935},{3399417856,3399483391},{3399516160,3399517183},
+	{3399633920,3399634943},{3399673600,3399679743},{3399842816,3399843839},{3399876352,3399876607},{3400006144,3400006399},{3400024064,3400028159},{3400046080,3400046591},{3400167424,3400171519},
+	{3400188928,3400189951},{3400264960,3400265215},{3400429568,3400431615},{3400532992,3400534015},{3400535296,3400535551},{3400589824,3400590079},{3400766464,3400766975},{3400806400,3400808447},
+	{3400893440,3400894463},{3401000704,3401000959},{3401007104,3401011199},{3401023488,3401056255},{3402951168,3402951423},{3404592128,3404592383},{3406275584,3406275839},{3406355712,3406355967},
+	{3406562816,3406563071},{3406731264,3406731775},{3406785024,3406785279},{3406796288,3406796543},{3406942208,3406943231},{3406968320,3406968575},{3406980608,3406980863},{3406994176,3406994431},
+	{3407035136,3407035391},{3407101696,3407101951},{3407103744,3407103999},{3407273984,3407274495},{3407292160,3407292415},{3407326464,3407326719},{3407341824,3407342079},{3407346176,3407346431},
+	{3407374336,3407375359},{3407378432,3407378687},{3407441152,3407441407},{3407447040,3407447295},{3407457536,3407457791},{3407474176,3407474431},{3407474688,3407474943},{3407488000,3407488255},
+	{3407501312,3407501567},{3407526912,3407527423},{3407528960,3407529983},{3407545856,3407546367},{3407550976,3407551231},{3407570176,3407570431},{3407599616,3407599871},{3407632896,3407633151},
+	{3407646464,3407646719},{3407655936,3407656191},{3407680512,3407680767},{3407683840,3407684095},{3407704832,3407705087},{3407732736,3407733247},{3407746048,3407746303},{3407747584,3407748095},
+	{3407808256,3407808511},{3407835648,3407836159},{3407855360,3407855615},{3407861760,3407862015},{3407905792,3407906047},{3407938304,3407938559},{3407943168,3407943423},{3407962112,3407963135},
+	{3407968512,3407968767},{3407976448,3407976959},{3407996672,3407997183},{3408004352,3408004607},{3408008960,3408009215},{3408042496,3408042751},{3408063232,3408063487},{3409415680,3409416191},
+	{3409434112,3409434623},{3409443840,3409444095},{3409453824,3409454079},{3409454336,3409454591},{3409468672,3409468927},{3409486336,3409486847},{3409492992,3409494015},{3409519616,3409520127},
+	{3409521664,3409522175},{3409529344,3409529855},{3409876992,3409878015},{3409880576,3409881087},{3410332160,3410332415},{3410332928,3410333183},{3410804736,3410821119},{3410862080,3410866175},
+	{3410919424,3410920447},{3410935808,3410939903},{3410956288,3410957567},{3410957824,3410958079},{3411152896,3411155199},{3411155456,3411155711},{3411156992,3411161087},{3411270400,3411271679},
+	{3411329024,3411345407},{3411470336,3411470847},{3411471104,3411472383},{3411525632,3411526143},{3411730432,3411738623},{3411779328,3411779583},{3412055040,3412057087},{3412213760,3412221951},
+	{3412299264,3412299519},{3412302848,3412303871},{3412631296,3412631551},{3412672512,3412680703},{3412926464,3412934655},{3413000192,3413004287},{3413149696,3413153791},{3413264640,3413264895},
+	{3413265152,3413265407},{3413586176,3413586431},{3413747968,3413748479},{3413753088,3413753855},{3413850880,3413851135},{3413925888,3413934079},{3414227968,3414228991},{3414297856,3414298111},
+	{3414306816,3414310911},{3414421504,3414425599},{3414430720,3414432767},{3414555648,3414555903},{3414622976,3414623231},{3414654976,3414663167},{3415080960,3415081983},{3415232512,3415234559},
+	{3415245568,3415245823},{3415272704,3415272959},{3415285760,3415293951},{3415343104,3415408639},{3415418880,3415419135},{3415424000,3415424255},{3415508992,3415510015},{3415510272,3415510527},
+	{3415511040,3415515135},{3415515392,3415515903},{3415522304,3415522815},{3415554048,3415554815},{3415592960,3415593215},{3415644672,3415644927},{3415814144,3415814655},{3415869184,3415869439},
+	{3415943680,3415943935},{3415946752,3415947007},{3415953408,3415953663},{3415955968,3415956223},{3416032512,3416032767},{3416064000,3416129535},{3416195072,3416219647},{3416227840,3416260607},
+	{3416273920,3416274943},{3416366080,3416366335},{3416374784,3416375295},{3416721152,3416721407},{3416922112,3416922367},{3416923136,3416924159},{3416929280,3416930303},{3416936448,3416938495},
+	{3416948736,3416981503},{3417055232,3417079807},{3417198592,3417200639},{3417931776,3417939967},{3418220544,3418221567},{3418257664,3418257919},{3418291712,3418292223},{3418299392,3418300415},
+	{3418365952,3418374143},{3418583040,3418585087},{3419072000,3419072255},{3419074560,3419078655},{3419238400,3419242495},{3419257600,3419257855},{3419426816,3419428863},{3419437056,3419439103},
+	{3419484160,3419486207},{3419686400,3419686911},{3419687168,3419687679},{3420030464,3420030975},{3420032256,3420032511},{3420044032,3420044287},{3420412416,3420412927},{3421290496,3421306879},
+	{3421417472,3421421567},{3421937664,3421941759},{3422552064,3422814207},{3423080448,3423081471},{3423088640,3423089663},{3423091456,3423091711},{3423145984,3423148031},{3423154176,3423156223},
+	{3423158272,3423160319},{3423193088,3423195135},{3423203328,3423205375},{3423208704,3423208959},{3423214848,3423215615},{3423220480,3423221759},{3423225856,3423226111},{3423229952,3423230463},
+	{3423234048,3423235071},{3423235584,3423236095},{3423250432,3423252479},{3423281152,3423282175},{3423285248,3423287295},{3423297536,3423299583},{3423307520,3423307775},{3423308544,3423308799},
+	{3423318016,3423320063},{3423328256,3423330303},{3423332352,3423334399},{3423404032,3423406079},{3423417344,3423418367},{3423442944,3423443967},{3423446016,3423446271},{3423465472,3423467519},
+	{3423469568,3423471615},{3423473664,3423474687},{3423488000,3423490047},{3423500288,3423501311},{3423521792,3423522815},{3423537152,3423539199},{3423548416,3423549439},{3423553536,3423555583},
+	{3423563264,3423563775},{3423584256,3423586303},{3423594496,3423595519},{3423644672,3423644927},{3423651840,3423653887},{3423665408,3423665919},{3423723264,3423723519},{3423735808,3423739903},
+	{3423831552,3423831807},{3423838720,3423838975},{3423858176,3423858687},{3423860736,3423861247},{3423861504,3423862527},{3424326400,3424326655},{3424385280,3424385535},{3424412672,3424413695},
+	{3424505088,3424505343},{3425304576,3425370111},{3425438464,3425438719},{3425452032,3425468415},{3425501184,3425566719},{3425705984,3425706495},{3425845248,3425845759},{3425984512,3425992703},
+	{3426007552,3426007807},{3426295808,3426303999},{3426617856,3426618367},{3426646016,3426648063},{3426674688,3426674943},{3426690560,3426691071},{3426729472,3426729983},{3427051520,3427051775},
+	{3427136512,3427137023},{3427250432,3427250687},{3427253248,3427253503},{3427256320,3427257343},{3427259392,3427259903},{3427409152,3427409407},{3427459072,3427467263},{3427504640,3427504895},
+	{3427514880,3427515135},{3427515392,3427515647},{3427655168,3427655679},{3427817984,3427818239},{3427818752,3427819007},{3427827712,3427827967},{3427833344,3427833599},{3428034560,3428034815},
+	{3428192256,3428196351},{3428288512,3428288767},{3428447232,3428447487},{3428588032,3428588287},{3428610560,3428610815},{3428655104,3428663295},{3428683264,3428683775},{3428685312,3428685567},
+	{3428685824,3428686847},{3428695040,3428695295},{3428704256,3428704511},{3428811776,3428812799},{3428876288,3428880383},{3428889600,3428890111},{3428891648,3428892671},{3429590784,3429591039},
+	{3429597184,3429597439},{3429607424,3429607679},{3429637376,3429637631},{3429637888,3429638143},{3429710848,3429711871},{3429892096,3429957631},{3430074112,3430074367},{3430236160,3430236415},
+	{3430240256,3430244351},{3430682368,3430682623},{3430724608,3430725631},{3430729472,3430729727},{3430742528,3430742783},{3431538432,3431538687},{3431604480,3431604735},{3431614208,3431614463},
+	{3431619840,3431620095},{3431640576,3431641087},{3431645184,3431645439},{3431727360,3431727615},{3431727872,3431728127},{3431728640,3431728895},{3431729152,3431729919},{3431746560,3431746815},
+	{3431792640,3431989247},{3432071168,3432079359},{3432112640,3432112895},{3432205312,3432206335},{3432210432,3432214527},{3432559104,3432559615},{3432562688,3432572927},{3432589056,3432589311},
+	{3432613632,3432613887},{3432635136,3432635391},{3432656640,3432656895},{3432672768,3432673279},{3432717312,3432718335},{3432775680,3432783871},{3432807424,3432816639},{3433693184,3433824255},
+	{3433964032,3433964287},{3434389504,3434397695},{3434832896,3434833407},{3434921984,3434938367},{3435233280,3435241471},{3435271680,3435272191},{3435311104,3435313151},{3435524096,3435528191},
+	{3435659264,3435921407},{3436251392,3436251647},{3436252672,3436252927},{3436255744,3436256255},{3436278272,3436278527},{3436568576,3436570623},{3436662784,3436666879},{3437324800,3437325055},
+	{3437326592,3437326847},{3437328128,3437328383},{3437342208,3437342719},{3437353472,3437353727},{3437445376,3437445631},{3437448448,3437448703},{3437469696,3437477887},{3437780992,3437788159},
+	{3437789184,3437887487},{3437977856,3437978111},{3438051328,3438084095},{3438116864,3438149631},{3438188800,3438189055},{3438208256,3438208511},{3438260992,3438261247},{3438614272,3438614527},
+	{3438641152,3438673919},{3438678784,3438679551},{3438681600,3438681855},{3438714880,3438723071},{3438727168,3438727423},{3438732800,3438733055},{3438739456,3438804991},{3439036928,3439037439},
+	{3448023040,3448025087},{3448168448,3448176639},{3448387072,3448387583},{3448445184,3448445439},{3448630784,3448631295},{3448769024,3448769279},{3448807424,3448811519},{3448871936,3448872447},
+	{3448897536,3448979455},{3448987648,3448991743},{3449099264,3449099519},{3449135104,3449143295},{3449227264,3449229311},{3449252352,3449253887},{3449651200,3449655295},{3449797888,3449798143},
+	{3449799424,3449799679},{3449905152,3449909247},{3450077184,3450093567},{3450223872,3450224127},{3450235904,3450236159},{3450318336,3450318847},{3450849792,3450850047},{3450929152,3450994687},
+	{3451502592,3451510783},{3451535360,3451539455},{3451551744,3451568127},{3451650048,3451715583},{3451716096,3451716607},{3451717120,3451717631},{3451725312,3451725567},{3451768832,3451769343},
+	{3452227584,3452231679},{3452334592,3452335103},{3452362752,3452366847},{3452436480,3452502015},{3452534784,3452538879},{3452715008,3452723199},{3452808960,3452809215},{3452809984,3452810239},
+	{3452819456,3452819711},{3452895232,3452895487},{3452902144,3452902399},{3452919552,3452919807},{3452933632,3452933887},{3453050880,3453075455},{3453093632,3453093887},{3453125120,3453125375},
+	{3453159424,3453159935},{3453181440,3453181951},{3453192704,3453193215},{3453198336,3453198847},{3453222912,3453288447},{3453372416,3453374463},{3453478912,3453479423},{3453698048,3453706239},
+	{3454611456,3454614527},{3454615552,3454615807},{3454681088,3454685183},{3454695424,3454697471},{3454702336,3454702847},{3454703616,3454704127},{3454705408,3454705663},{3454709504,3454709759},
+	{3454713344,3454713599},{3454714112,3454714367},{3454714880,3454715135},{3454716416,3454716927},{3454718208,3454718463},{3454720000,3454720255},{3454722560,3454722815},{3454723072,3454723327},
+	{3454725888,3454726143},{3454726656,3454726911},{3454727424,3454727679},{3454727936,3454728191},{3454728704,3454729215},{3454756864,3454757119},{3454799872,3454800127},{3454802688,3454802943},
+	{3454803712,3454803967},{3454804480,3454804735},{3454806016,3454806271},{3454810624,3454810879},{3454813696,3454813951},{3454844160,3454844415},{3454858752,3454861055},{3454868992,3454870271},
+	{3454926848,3454943231},{3455380992,3455381503},{3455568896,3455569151},{3455813632,3455815679},{3455817728,3455819775},{3455827968,3455909887},{3456930816,3456931071},{3457024000,3457089535},
+	{3458768896,3458769919},{3458795520,3458796031},{3458820608,3458820863},{3458822144,3458826239},{3459055616,3459121151},{3459252224,3459253247},{3459383296,3459448831},{3459450624,3459450879},
+	{3459452928,3459454975},{3459456000,3459456255},{3459506176,3459510271},{3459514368,3459579903},{3459595264,3459596287},{3459645440,3459661823},{3459686400,3459689471},{3459689728,3459689983},
+	{3459690240,3459690751},{3459691008,3459691519},{3459691776,3459692543},{3459710976,3459731455},{3459737600,3459739647},{3459849216,3459849471},{3459907584,3459973119},{3460204800,3460205055},
+	{3460450816,3460451071},{3460562944,3460694015},{3460771840,3460775935},{3460796416,3460800511},{3460802816,3460803071},{3460805376,3460805631},{3460808192,3460808447},{3460874240,3460878335},
+	{3461357568,3461365759},{3461406464,3461406719},{3461462272,3461462527},{3461462784,3461463039},{3461488640,3461496831},{3461513216,3461517311},{3461542912,3461543935},{3461555712,3461555967},
+	{3461597984,3461598015},{3461667840,3461668351},{3461742592,3461808127},{3462661632,3462661887},{3463197952,3463198207},{3463217152,3463225343},{3463665152,3463665407},{3463666688,3463667711},
+	{3463812352,3463812607},{3464170240,3464170495},{3464172544,3464173055},{3464183808,3464208383},{3464308736,3464310783},{3464340480,3464343551},{3464388096,3464388351},{3464388608,3464388863},
+	{3464429824,3464430079},{3464430848,3464431103},{3464431360,3464431615},{3464466432,3464470527},{3464628992,3464629247},{3464650752,3464658943},{3464674560,3464674815},{3464740864,3464744959},
+	{3464788480,3464788735},{3464809728,3464809983},{3464812544,3464813567},{3465027584,3465028607},{3465560064,3465568255},{3465584896,3465593087},{3465596928,3465597183},{3466657792,3466723327},
+	{3466784768,3466846207},{3466899456,3466899967},{3466920960,3466921215},{3466921984,3466924031},{3466934528,3466934783},{3466939392,3466939647},{3466953216,3466953983},{3466976768,3466977023},
+	{3467018240,3467034623},{3467192576,3467192831},{3467229696,3467229951},{3467231744,3467232255},{3467267840,3467268095},{3468126208,3468128255},{3468148736,3468156927},{3468165120,3468230655},
+	{3468232704,3468233727},{3468362752,3468366847},{3468375040,3468377087},{3468386304,3468390399},{3468476416,3468484607},{3468566528,3468572671},{3468591104,3468599295},{3468619776,3468623871},
+	{3468658176,3468658431},{3468661760,3468664831},{3468669952,3468670975},{3468673024,3468681215},{3468699392,3468699647},{3468719360,3468719615},{3468798464,3468798719},{3468798976,3468799231},
+	{3468800000,3468800255},{3469037824,3469038079},{3469044224,3469044479},{3469066240,3469066495},{3469119488,3469123583},{3469344768,3469361151},{3469625600,3469625855},{3469628672,3469628927},
+	{3469629696,3469629951},{3469637888,3469638143},{3469648640,3469649663},{3469649920,3469650175},{3469650432,3469650943},{3469651200,3469651455},{3469651712,3469656063},{3469689344,3469689599},
+	{3469754368,3469755391},{3469815808,3469819903},{3470082048,3470098431},{3470147584,3470155775},{3470163968,3470172159},{3470360576,3470364671},{3470376960,3470385151},{3470452736,3470452991},
+	{3470568448,3470569471},{3470596096,3470596351},{3470597120,3470597631},{3470599680,3470599935},{3470614528,3470618623},{3470635008,3470639103},{3470643200,3470647295},{3470663680,3470671871},
+	{3470697472,3470697727},{3470701056,3470701311},{3470713344,3470713855},{3470716928,3470718975},{3470779904,3470780159},{3470780672,3470780927},{3470786048,3470786303},{3470885888,3470886911},
+	{3471769600,3471835135},{3472225280,3472225535},{3472244992,3472246015},{3472246528,3472246783},{3472252160,3472252671},{3472258560,3472258815},{3472392192,3472393215},{3472394240,3472398335},
+	{3472398848,3472399359},{3472399872,3472400383},{3472556032,3472564223},{3472566272,3472568319},{3472618496,3472618751},{3472621312,3472629759},{3472730112,3472732159},{3472734208,3472734463},
+	{3472744448,3472752639},{3473240064,3473244159},{3473362944,3473367039},{3473376256,3473376511},{3473380608,3473381119},{3473381888,3473382143},{3473867264,3473867775},{3473874944,3473876991},
+	{3474194432,3474325503},{3474341888,3474358271},{3474479104,3474480127},{3474964480,3474980863},{3474997248,3475013631},{3475046400,3475111935},{3475394560,3475398655},{3475800064,3475832831},
+	{3475881984,3475890175},{3476238336,3476242431},{3476373504,3476375551},{3476488192,3476496383},{3476512768,3476545535},{3476553728,3476717567},{3477216512,3477216767},{3477217024,3477217279},
+	{3477217792,3477218047},{3477223168,3477223679},{3477224448,3477224703},{3477225984,3477226239},{3477226496,3477226751},{3477228544,3477229055},{3477229568,3477233663},{3477233920,3477234175},
+	{3477234432,3477234687},{3477235456,3477236479},{3477236992,3477237247},{3477237504,3477238015},{3477238272,3477238527},{3477239040,3477239295},{3477239808,3477240063},{3477240832,3477241087},
+	{3477272576,3477273087},{3477307392,3477340159},{3477507584,3477507839},{3477538816,3477539071},{3477548032,3477548543},{3477553152,3477569535},{3477907456,3477909503},{3478720512,3478722559},
+	{3478863872,3478880255},{3479240704,3479273471},{3479289856,3479306239},{3479371776,3479404543},{3479836160,3479836415},{3479890688,3479890943},{3480010752,3480011007},{3480174592,3480190975},
+	{3480333312,3480334079},{3480334336,3480334591},{3480334848,3480335103},{3481174016,3481176063},{3481862144,3481927679},{3482714112,3482755071},{3482767360,3482771455},{3482840064,3482840319},
+	{3482861568,3482877951},{3482943488,3482976255},{3482992640,3483009023},{3483025408,3483041791},{3483140096,3483172863},{3483242240,3483242495},{3483246080,3483246335},{3483247872,3483248127},
+	{3483251712,3483251967},{3483303936,3483320319},{3483435008,3483500543},{3483549696,3483553791},{3483800064,3483800319},{3483911424,3483911679},{3484131328,3484139519},{3484418048,3484450815},
+	{3484827648,3484828671},{3484876800,3484877823},{3485239040,3485240319},{3485240832,3485241343},{3485242112,3485242367},{3485246720,3485246975},{3485247232,3485248511},{3485248768,3485249279},
+	{3485249536,3485249791},{3485250304,3485251071},{3485251584,3485253631},{3485271552,3485271807},{3485312512,3485313023},{3485316864,3485317119},{3485317376,3485318143},{3485319168,3485327359},
+	{3485483008,3485499391},{3485724672,3485761535},{3485827072,3485859839},{3485876224,3485958143},{3485959424,3485959935},{3485974272,3485974527},{3486007296,3486023679},{3486056960,3486057471},
+	{3486062336,3486062847},{3486065664,3486066175},{3486066432,3486066687},{3486068736,3486071807},{3486072064,3486072575},{3486307840,3486308095},{3486310400,3486318591},{3486384128,3486416895},
+	{3486454016,3486454271},{3486455040,3486455551},{3486455808,3486456063},{3486456832,3486457087},{3486464768,3486465023},{3486465280,3486465535},{3486482432,3486490623},{3486662656,3486679039},
+	{3486695424,3486711807},{3486715392,3486715647},{3487178240,3487178495},{3487186944,3487187967},{3487217664,3487217919},{3487219712,3487236095},{3487539200,3487547391},{3487694848,3487760383},
+	{3487907840,3487924223},{3487980544,3487980799},{3488062464,3488063487},{3488285696,3488286719},{3488288768,3488289279},{3488385856,3488385871},{3488677888,3488710655},{3488711936,3488712191},
+	{3488890880,3488907263},{3488911360,3488915455},{3489056768,3489058815},{3489062912,3489063167},{3489069056,3489071103},{3489163520,3489163775},{3489218560,3489226751},{3489330176,3489330431},
+	{3489911808,3489912063},{3490830080,3490830335},{3492186624,3492186879},{3492187904,3492188159},{3492188928,3492189183},{3492201984,3492202239},{3492478976,3492544511},{3492804608,3492805119},
+	{3492840448,3492841471},{3492872960,3492873215},{3492884992,3492885503},{3492949504,3492954111},{3492968704,3492968959},{3492978944,3492979199},{3492999424,3492999679},{3493018624,3493019647},
+	{3493134336,3493150719},{3493167104,3493183487},{3493861376,3493863423},{3493864448,3493865471},{3493871616,3493873663},{3493892096,3493892351},{3493912576,3493914623},{3493918720,3493920767},
+	{3493924864,3493925887},{3493936640,3493937151},{3493938944,3493939199},{3493947136,3493947391},{3493949440,3493950463},{3493959680,3493960703},{3494004736,3494006783},{3494029312,3494031359},
+	{3494035456,3494036479},{3494045696,3494047743},{3494063104,3494063615},{3494105088,3494106111},{3494111232,3494115327},{3494126592,3494127615},{3494139904,3494141951},{3494144000,3494146047},
+	{3494157312,3494158079},{3494160384,3494162431},{3494176768,3494178815},{3494185216,3494186239},{3494211584,3494213631},{3494227968,3494230015},{3494232064,3494233087},{3494241280,3494242303},
+	{3494275072,3494277119},{3494281472,3494281727},{3494281984,3494282495},{3494282752,3494283263},{3494296576,3494297599},{3494324224,3494326271},{3494342656,3494344703},{3494354944,3494355967},
+	{3494361088,3494362111},{3494362624,3494362879},{3494368256,3494369279},{3494375424,3494376447},{3494388736,3494389759},{3494418432,3494419455},{3494424576,3494425599},{3494446080,3494446335},
+	{3494446848,3494447103},{3494450176,3494451199},{3494481920,3494483199},{3494496256,3494498303},{3494502400,3494503423},{3494504448,3494506495},{3494529024,3494531071},{3494548480,3494549503},
+	{3494553600,3494555647},{3494559744,3494560767},{3494561792,3494562815},{3494590464,3494591487},{3494598656,3494599679},{3494621184,3494625279},{3494641664,3494642687},{3494644736,3494645759},
+	{3494654976,3494655999},{3494662144,3494664191},{3494666240,3494670335},{3494696960,3494699007},{3494703104,3494705151},{3494747136,3494748159},{3494751488,3494751743},{3494776832,3494777855},
+	{3494778880,3494781439},{3494782976,3494783999},{3494797312,3494799359},{3494807552,3494808575},{3494828032,3494831103},{3494834176,3494836223},{3494838272,3494840319},{3494860800,3494862847},
+	{3494891520,3494895615},{3494903808,3494905855},{3494926336,3494927359},{3494999040,3495000063},{3495004160,3495006207},{3495011328,3495012351},{3495014400,3495016447},{3495017472,3495018495},
+	{3495021568,3495022591},{3495062528,3495063551},{3495065600,3495066623},{3495094272,3495095295},{3495114752,3495115775},{3495119872,3495120895},{3495128832,3495129087},{3495133184,3495133695},
+	{3495136256,3495137279},{3495159808,3495161855},{3495172096,3495172351},{3495182336,3495182591},{3495199744,3495200767},{3495202816,3495203071},{3495204864,3495205887},{3495227392,3495229439},
+	{3495231488,3495233535},{3495235584,3495237631},{3495262208,3495263231},{3495278592,3495279615},{3495292928,3495293951},{3495303168,3495304191},{3495348224,3495348479},{3495358976,3495359487},
+	{3495384064,3495387135},{3495395328,3495397887},{3495404544,3495405311},{3495424000,3495426047},{3495446528,3495448575},{3495458816,3495460863},{3495489536,3495490559},{3495495680,3495496703},
+	{3495501824,3495502335},{3495508992,3495510015},{3495535616,3495536639},{3495546880,3495550975},{3495567360,3495569407},{3495570432,3495571455},{3495596032,3495597055},{3495651328,3495653375},
+	{3495657472,3495659519},{3495692288,3495693311},{3495700224,3495700479},{3495707648,3495710719},{3495729152,3495731199},{3495740416,3495741439},{3495745536,3495747583},{3495772160,3495774207},
+	{3495778304,3495780351},{3495783424,3495784447},{3495790592,3495790847},{3495792640,3495794687},{3495804928,3495805951},{3495806976,3495809023},{3495865344,3495866367},{3495882752,3495884799},
+	{3495895040,3495896063},{3495946240,3495948287},{3495993344,3495997439},{3496050688,3496067071},{3496083456,3496099839},{3496199424,3496199679},{3496214528,3496230911},{3496280064,3496296447},
+	{3496331264,3496331519},{3496443904,3496460287},{3496804352,3496869887},{3496882176,3496894463},{3496902656,3496914943},{3496943616,3496947711},{3497099264,3497132031},{3497222144,3497234431},
+	{3497246720,3497279487},{3497325056,3497325567},{3497328640,3497345023},{3497385984,3497394175},{3497406464,3497410559},{3497454336,3497454591},{3497656320,3497672703},{3497705472,3497713663},
+	{3497738240,3497746431},{3497750528,3497751551},{3497775104,3497779199},{3498278912,3498287103},{3499138560,3499139071},{3499238400,3499239423},{3499294720,3499296767},{3500286976,3500288255},
+	{3500552192,3500556287},{3500662784,3500670975},{3501354752,3501355007},{3501756928,3501757439},{3501890304,3501890559},{3502720000,3502720511},{3502802944,3502804991},{3503003392,3503003647},
+	{3503784960,3503785215},{3503786496,3503787007},{3503788032,3503788287},{3503956736,3503956991},{3503959552,3503959807},{3504223744,3504223999},{3504418816,3504422911},{3504455680,3504459775},
+	{3504705536,3504706559},{3505852672,3505852927},{3506460672,3506460927},{3506461184,3506461439},{3506489600,3506489855},{3506561024,3506561535},{3506962432,3507093503},{3507115008,3507115263},
+	{3507118080,3507134463},{3507202048,3507202559},{3507202816,3507203071},{3507220480,3507224575},{3507427328,3507427583},{3507427840,3507428095},{3507430400,3507430655},{3507470336,3507486719},
+	{3507511296,3507515391},{3507519488,3507535871},{3507546112,3507546367},{3507569152,3507569407},{3507765248,3507773439},{3507814400,3507830783},{3507994624,3507994879},{3508011008,3508076543},
+	{3508682752,3508690943},{3508714496,3508715519},{3508715776,3508716031},{3508994048,3509059583},{3509110784,3509111039},{3509141504,3509149695},{3509164544,3509166079},{3509198848,3509207039},
+	{3509288960,3509321727},{3509346304,3509354495},{3509432320,3509432575},{3509540608,3509540863},{3509727232,3509731327},{3509813248,3509821439},{3509826048,3509826303},{3509827840,3509828095},
+	{3510005760,3510009855},{3510018048,3510020095},{3510021120,3510022143},{3510025216,3510025727},{3510097920,3510099199},{3510173696,3510276095},{3510280192,3510286335},{3510312960,3510321151},
+	{3510337536,3510353919},{3510354944,3510355199},{3510401536,3510402047},{3510468608,3510484991},{3510501376,3510534143},{3510763520,3510763775},{3510767616,3510767871},{3510796288,3510804479},
+	{3510829320,3510829323},{3510834176,3510835199},{3510836288,3510836291},{3510836480,3510836607},{3510842368,3510842879},{3510843392,3510844415},{3510845184,3510845439},{3510960128,3511091199},
+	{3511238656,3511263231},{3511268352,3511269375},{3511269888,3511270143},{3511314432,3511316479},{3511353344,3511418879},{3511853056,3511861247},{3512008704,3512074239},{3512176640,3512180735},
+	{3512186880,3512187903},{3512344576,3512346111},{3512393728,3512397823},{3512598528,3512606719},{3512672256,3512680447},{3512926464,3512927231},{3512928512,3512928767},{3512930560,3512930815},
+	{3512931328,3512932351},{3512938240,3512938495},{3512940800,3512941055},{3512941568,3512942591},{3512943104,3512943615},{3512944128,3512944383},{3512944640,3512944895},{3512945408,3512945663},
+	{3512946432,3512946687},{3512950016,3512950783},{3512953856,3512954623},{3512955136,3512956671},{3513262080,3513270271},{3513303040,3513311231},{3513376768,3513384959},{3513450496,3513475071},
+	{3513491456,3513507839},{3513876480,3513877503},{3513884672,3513884927},{3513887744,3513888255},{3513904128,3513904639},{3513917440,3513925631},{3513976064,3513976319},{3514200064,3514204159},
+	{3514337792,3514338303},{3514354688,3514355199},{3514355968,3514356223},{3514356480,3514356735},{3514359808,3514361087},{3514361344,3514361855},{3514362112,3514363391},{3514365184,3514365439},
+	{3514365952,3514366207},{3514366976,3514367231},{3514499072,3514572799},{3514580992,3514589183},{3514703104,3514703359},{3514718208,3514718463},{3514718720,3514718975},{3514720256,3514761215},
+	{3514843136,3514859519},{3515036160,3515037183},{3515037952,3515038207},{3515038720,3515039231},{3515047936,3515056127},{3515138048,3515154431},{3515177728,3515177983},{3515178240,3515178495},
+	{3515203584,3515236351},{3515402752,3515403775},{3515547648,3515596799},{3515617280,3515621375},{3515645952,3515662335},{3515688448,3515688959},{3515897856,3515898367},{3515900928,3515901183},
+	{3515901696,3515902975},{3515903232,3515903999},{3515912192,3515912447},{3515925504,3515926527},{3516139264,3516140287},{3516141568,3516145663},{3516148736,3516149247},{3516157952,3516158207},
+	{3516158720,3516159743},{3516160000,3516160255},{3516160512,3516161023},{3516161280,3516161535},{3516161792,3516162047},{3516301312,3516309503},{3516375040,3516379135},{3516432384,3516448767},
+	{3516517632,3516518143},{3516619264,3516619519},{3516727296,3516792831},{3516891136,3516899327},{3517014016,3517018111},{3517071360,3517095935},{3517145088,3517153279},{3517179904,3517181951},
+	{3517182976,3517185023},{3517202432,3517218815},{3517448192,3517480959},{3517509632,3517511679},{3517512704,3517513727},{3517579264,3517596671},{3517612032,3517620223},{3517718528,3517726719},
+	{3517814272,3517814783},{3518025984,3518026239},{3518054912,3518055423},{3518058496,3518062591},{3518074880,3518078975},{3518392320,3518394367},{3518414848,3518421247},{3518425088,3518427135},
+	{3518758912,3518767103},{3518824448,3518857215},{3518994432,3518994687},{3518996992,3518998015},{3519030528,3519030783},{3519041792,3519042047},{3519049216,3519049727},{3519053824,3519086591},
+	{3519231744,3519231999},{3519348736,3519356927},{3519415296,3519415551},{3519419648,3519419903},{3519420416,3519420671},{3519427328,3519427583},{3519467520,3519469567},{3519545344,3519561727},
+	{3519582208,3519584255},{3519676416,3519692799},{3519856640,3519873023},{3519922176,3519930367},{3519950848,3519954943},{3520036864,3520069631},{3520126976,3520135167},{3520311552,3520311807},
+	{3520368640,3520372735},{3520389120,3520393215},{3520421888,3520430079},{3520620544,3520622591},{3520652800,3520653055},{3520716800,3520724991},{3520736000,3520736255},{3520929792,3520937983},
+	{3520987136,3520994303},{3520994560,3520995327},{3521003520,3521019903},{3521044480,3521048575},{3521080832,3521081087},{3521087488,3521089535},{3521112576,3521113087},{3521193984,3521194239},
+	{3521314816,3521347583},{3521363968,3521380351},{3521835008,3521839103},{3521871872,3521880063},{3521921024,3521925119},{3521933312,3521937407},{3522031360,3522031615},{3522032384,3522032639},
+	{3522034688,3522034943},{3522035712,3522101247},{3522129920,3522134015},{3522188544,3522188799},{3522191360,3522195455},{3522396160,3522396415},{3522499840,3522500095},{3522532352,3522532607},
+	{3522596352,3522596863},{3522597992,3522597999},{3522646784,3522647039},{3522665984,3522666239},{3522822144,3522830335},{3522945024,3522953215},{3523280896,3523297279},{3523553280,3523555327},
+	{3523895296,3523896319},{3524289536,3524290303},{3524294656,3524295167},{3526397952,3526402047},{3526867456,3526867711},{3526871040,3526871295},{3526873856,3526874111},{3526934528,3526950911},
+	{3527004160,3527008255},{3527276544,3527277055},{3529633792,3529637887},{3534725120,3534733311},{3535905792,3535906047},{3535909888,3535910143},{3537256448,3537257471},{3539376640,3539376895},
+	{3539398656,3539401215},{3540066304,3540074495},{3542597632,3542605823},{3543662592,3543670783},{3548536832,3548545023},{3550167040,3550167551},{3551500544,3551500799},{3552313344,3552346111},
+	{3556827136,3556835327},{3556888576,3556890623},{3557195776,3557228543},{3557277696,3557279999},{3557280256,3557280511},{3557280768,3557282815},{3557283840,3557285887},{3557358080,3557358847},
+	{3557408768,3557409791},{3557490688,3557507071},{3557933056,3557941247},{3558006784,3558010879},{3558012928,3558013439},{3558013696,3558013951},{3558072320,3558074367},{3558075136,3558075647},
+	{3558076416,3558080511},{3558162432,3558170623},{3558252544,3558260735},{3558285312,3558293503},{3558580224,3558588415},{3558924288,3558932479},{3559145472,3559153663},{3559178240,3559186431},
+	{3559301120,3559309311},{3559432192,3559432447},{3559432960,3559433471},{3559433728,3559434495},{3559434752,3559436031},{3559436288,3559438335},{3559438592,3559439359},{3559439616,3559439871},
+	{3559579648,3559587839},{3559636992,3559653375},{3559907328,3559915519},{3559931904,3559940095},{3560030208,3560046591},{3560210432,3560218623},{3560259584,3560267775},{3560341504,3560349695},
+	{3560628224,3560636415},{3560695040,3560695295},{3560697856,3560698367},{3560698880,3560699903},{3560718336,3560726527},{3560767488,3560833023},{3560849408,3560857599},{3561095168,3561103359},
+	{3561209856,3561218047},{3561234432,3561242623},{3561480192,3561488383},{3561500234,3561500234},{3561545728,3561553919},{3561619456,3561627647},{3562094592,3562110975},{3562153984,3562156031},
+	{3562201088,3562209279},{3562217472,3562225663},{3562242048,3562258431},{3562315776,3562323967},{3562356736,3562364927},{3562561536,3562569727},{3562804992,3562805247},{3562825728,3562831359},
+	{3563003904,3563012095},{3563134976,3563143167},{3563347968,3563356159},{3563364352,3563372543},{3563986944,3563995135},{3564019712,3564027903},{3564052480,3564060671},{3564126208,3564127231},
+	{3564128256,3564128511},{3564129536,3564129791},{3564131328,3564134399},{3564167168,3564175359},{3564208128,3564216319},{3564249088,3564251391},{3564256256,3564256767},{3564257024,3564257279},
+	{3564265472,3564273663},{3564339200,3564355583},{3564388352,3564396543},{3564478464,3564486655},{3564503040,3564504063},{3564561024,3564561039},{3564561152,3564561407},{3564568576,3564576767},
+	{3564822528,3564830719},{3564855296,3564863487},{3564919808,3564920831},{3564978176,3564986367},{3565060096,3565068287},{3565101056,3565109247},{3565223936,3565240319},{3565551616,3565682687},
+	{3566978048,3566978559},{3567165952,3567166207},{3567389696,3567390719},{3567399936,3567400447},{3567400960,3567401471},{3567606784,3567611903},{3567845376,3567861759},{3568041984,3568107519},
+	{3568566272,3568599039},{3569078272,3569078783},{3569088000,3569088511},{3569123328,3569156095},{3570663424,3570728959},{3571253248,3571286015},{3571318784,3571384319},{3571466240,3571482623},
+	{3571646464,3571711999},{3571980288,3571982335},{3572301824,3572318207},{3572353024,3572355071},{3572359168,3572360191},{3573481472,3573547007},{3573678080,3573743615},{3573891072,3573893119},
+	{3573919744,3573921791},{3574825472,3574825983},{3574827008,3574827519},{3574831104,3574831359},{3575644160,3575676927},{3576102912,3576135679},{3576987648,3577020415},{3577085952,3577151487},
+	{3577167872,3577192447},{3578814464,3578822655},{3579772928,3579838463},{3580709888,3580710399},{3580716032,3580717055},{3580727296,3580731391},{3580739584,3580743679},{3581952000,3581960191},
+	{3582058496,3582066687},{3582074880,3582083071},{3582148608,3582156799},{3582189568,3582197759},{3582287872,3582304255},{3582459904,3582484479},{3582615552,3582623743},{3582656512,3582664703},
+	{3582672896,3582681087},{3582886912,3582891007},{3582984192,3582992383},{3583369216,3583377407},{3583428608,3583429119},{3583549440,3583557631},{3583565824,3583574015},{3583696896,3583713279},
+	{3583717376,3583729663},{3583762432,3583770623},{3583852544,3583860735},{3583969792,3583971327},{3584114688,3584122879},{3584245760,3584253951},{3584376832,3584385023},{3584393216,3584401407},
+	{3584549888,3584550911},{3584552960,3584557055},{3584614400,3584622591},{3584660480,3584660735},{3584671744,3584688127},{3584770048,3584778239},{3584802816,3584811007},{3584851968,3584860159},
+	{3584913408,3584917503},{3584983040,3584991231},{3585064960,3585073151},{3585246464,3585246975},{3585249280,3585249535},{3585251328,3585251583},{3585253120,3585253375},{3585269760,3585277951},
+	{3585327104,3585335295},{3585392640,3585400831},{3585459968,3585460735},{3585461248,3585461759},{3585462016,3585462271},{3585462528,3585463295},{3585465088,3585465343},{3585630208,3585638399},
+	{3585728512,3585736703},{3585744896,3585753087},{3586228224,3586246655},{3586248704,3586252799},{3586254848,3586258943},{3586259456,3586260991},{3586392320,3586392575},{3586406400,3586406655},
+	{3586523136,3586555903},{3586670592,3586686975},{3586752512,3586785279},{3586834432,3586850815},{3586899968,3586916351},{3587424256,3587440639},{3587473408,3587489791},{3587506176,3587538943},
+	{3587801088,3587817471},{3587899392,3587915775},{3588046848,3588063231},{3588464640,3588472831},{3588538880,3588539135},{3588542720,3588542975},{3588544000,3588544255},{3588548352,3588548607},
+	{3588571136,3588587519},{3588672256,3588672511},{3588890624,3588894719},{3589188864,3589189119},{3589189376,3589189631},{3589242880,3589275647},{3589313024,3589313535},{3589583872,3589584127},
+	{3589585920,3589585983},{3589586688,3589586943},{3589677056,3589685247},{3589746176,3589746687},{3589830144,3589831167},{3589864960,3589865215},{3589996544,3590012927},{3590029312,3590045695},
+	{3590125568,3590126079},{3590127616,3590143999},{3590193152,3590201343},{3590242304,3590291455},{3623972864,3623973887},{3624271872,3624304639},{3624329216,3624333311},{3624371200,3624371455},
+	{3624373504,3624373759},{3624534016,3624542207},{3624595456,3624599551},{3624714240,3624722431},{3624820736,3624824831},{3624894464,3624927231},{3625017344,3625021439},{3625096192,3625097215},
+	{3625107456,3625119743},{3625168896,3625172991},{3625255168,3625255423},{3625256448,3625258495},{3625258752,3625259007},{3625259264,3625259519},{3625261056,3625263103},{3625314816,3625315071},
+	{3625315328,3625315839},{3625347328,3625347583},{3625500672,3625504767},{3625512960,3625517055},{3625566208,3625570303},{3625825536,3625826047},{3625954048,3625954303},{3626025984,3626027007},
+	{3626287104,3626303487},{3626369024,3626377215},{3626446848,3626450943},{3626549248,3626565631},{3626577920,3626578943},{3626631168,3626696703},{3626762240,3626827775},{3626840064,3626844159},
+	{3626905600,3626909695},{3626958848,3626967039},{3627041792,3627042047},{3627286528,3627287551},{3627294208,3627294719},{3627309056,3627311103},{3627326976,3627327231},{3627337216,3627337727},
+	{3627343104,3627343359},{3627349248,3627349503},{3627467264,3627467519},{3627517696,3627517951},{3627532288,3627544575},{3627641088,3627641343},{3627641600,3627641855},{3627642112,3627642367},
+	{3627663360,3627671551},{3627728896,3627761663},{3627778048,3627794431},{3628205312,3628205567},{3628326912,3628335103},{3628425984,3628427263},{3628427776,3628428031},{3628428288,3628428799},
+	{3628433408,3628449791},{3628482560,3628498943},{3628531712,3628589055},{3628657920,3628658175},{3628683264,3628687359},{3628744704,3628761087},{3628793856,3628810239},{3628818432,3628822527},
+	{3628852224,3628852479},{3628853248,3628853503},{3629187072,3629195263},{3629326336,3629334527},{3629551616,3629555711},{3629580288,3629588479},{3629613056,3629621247},{3629633536,3629637631},
+	{3629665280,3629665791},{3629666048,3629666303},{3629675520,3629675775},{3629676032,3629676543},{3629711360,3629711615},{3629872000,3629872031},{3630036224,3630036479},{3630038528,3630038783},
+	{3630235648,3630268415},{3630333952,3630342143},{3630399488,3630407679},{3630422784,3630423039},{3630694400,3630706687},{3630745600,3630747647},{3630750720,3630751487},{3630772224,3630776319},
+	{3630797568,3630797823},{3630802944,3630803199},{3630823936,3630824191},{3630896640,3630896895},{3630903040,3630903295},{3630905344,3630905599},{3630906112,3630906367},{3630906880,3630907135},
+	{3630927872,3630931967},{3630952448,3630956543},{3631013888,3631017983},{3631050752,3631051775},{3631061760,3631062015},{3631079424,3631083519},{3631095808,3631099903},{3631439872,3631443967},
+	{3631472128,3631472639},{3631497216,3631501311},{3631628288,3631644671},{3631677440,3631693823},{3631710208,3631718399},{3632185344,3632187391},{3632193536,3632194559},{3632195072,3632195327},
+	{3632218112,3632226303},{3632242688,3632250879},{3632284416,3632284671},{3632285696,3632285951},{3632287488,3632287743},{3632289792,3632290047},{3632414720,3632422911},{3632439296,3632447487},
+	{3632480256,3632496639},{3632652288,3632660223},{3632754688,3632756735},{3632824320,3632825343},{3632835584,3632836607},{3632843520,3632844031},{3632848000,3632848127},{3632848896,3632849919},
+	{3632850944,3632851967},{3632865280,3632873471},{3632940544,3632941055},{3633046272,3633046527},{3633373184,3633390591},{3633392640,3633393663},{3633458176,3633458687},{3633709056,3633717247},
+	{3633750016,3633754111},{3633782528,3633782783},{3633810432,3633810687},{3633812736,3633812991},{3633813760,3633814015},{3633815552,3633831935},{3633872896,3633874943},{3633897472,3633901823},
+	{3633902080,3633902335},{3634020352,3634028543},{3634036992,3634037247},{3634043392,3634043647},{3634069504,3634077695},{3634156800,3634157055},{3634164224,3634164479},{3634167808,3634184191},
+	{3634188288,3634191871},{3634194432,3634196479},{3634200576,3634208767},{3634249728,3634257919},{3634282752,3634283007},{3634283264,3634283519},{3634285312,3634285567},{3634286080,3634286335},
+	{3634288128,3634288383},{3634288896,3634289663},{3634290432,3634294783},{3634505728,3634507775},{3634544640,3634552831},{3634598912,3634599935},{3634606080,3634610175},{3634759424,3634760447},
+	{3634764800,3634765055},{3634769920,3634770687},{3634771200,3634772479},{3634772736,3634772991},{3634773760,3634774015},{3634777088,3634777343},{3634778112,3634778367},{3634780160,3634790399},
+	{3634823168,3634855935},{3634888960,3634889471},{3634985216,3634985471},{3634987008,3634988287},{3635007488,3635011583},{3635048448,3635052543},{3635150848,3635151615},{3635163136,3635167231},
+	{3635175424,3635179519},{3635183616,3635199999},{3635289088,3635289343},{3635458048,3635462143},{3635511296,3635515391},{3635652608,3635654655},{3635674112,3635674623},{3635732480,3635740671},
+	{3635826688,3635830783},{3635863552,3635867647},{3636011008,3636019199},{3636027392,3636039679},{3636041728,3636041983},{3636150272,3636163327},{3636163584,3636165631},{3636166144,3636166655},
+	{3636265728,3636265983},{3636270080,3636270335},{3636295168,3636295423},{3636296192,3636296447},{3636296704,3636296959},{3636301824,3636302847},{3636303104,3636305919},{3636341760,3636342271},
+	{3636447488,3636447743},{3636577536,3636577791},{3636580352,3636580415},{3636583168,3636583423},{3636587776,3636588031},{3636591360,3636591615},{3636621312,3636625407},{3636633600,3636637695},
+	{3636668672,3636668927},{3636671232,3636671487},{3636674304,3636674559},{3636748288,3636756479},{3636903936,3636920319},{3637003520,3637003775},{3637382272,3637382335},{3637491712,3637492735},
+	{3637739520,3637747711},{3638224896,3638225407},{3638229760,3638230015},{3638251520,3638255615},{3638345728,3638345983},{3638346496,3638346751},{3638349312,3638349823},{3638403072,3638411263},
+	{3638499328,3638501375},{3638502400,3638502655},{3638504448,3638504703},{3638587392,3638591487},{3638788096,3638804479},{3638886400,3638894591},{3638898688,3638902783},{3638974208,3638974463},
+	{3639001088,3639009279},{3639050240,3639054335},{3639214080,3639222271},{3639275520,3639279615},{3639300096,3639301375},{3639329792,3639332863},{3639378176,3639378431},{3639385600,3639385855},
+	{3639492608,3639508991},{3639513088,3639517183},{3639549952,3639558143},{3639568384,3639568639},{3639568896,3639569151},{3639570432,3639574527},{3639885824,3639894015},{3639984128,3639992319},
+	{3640003328,3640003583},{3640005376,3640005631},{3640006144,3640006399},{3640007424,3640007679},{3640008704,3640009215},{3640010752,3640011007},{3640011264,3640011519},{3640012800,3640013311},
+	{3640015360,3640015615},{3640015872,3640016895},{3640022528,3640022783},{3640026112,3640026367},{3640027136,3640027391},{3640028160,3640028671},{3640030720,3640031231},{3640165376,3640165631},
+	{3640176640,3640176895},{3640177152,3640177663},{3640178688,3640178943},{3640275968,3640276479},{3640287232,3640287743},{3640289280,3640290303},{3640291328,3640295423},{3640336384,3640340479},
+	{3640410112,3640426495},{3640450048,3640451071},{3640635392,3640639487},{3641229312,3641237503},{3641241600,3641245695},{3641344000,3641352191},{3641397248,3641401343},{3641487360,3641499647},
+	{3641557248,3641559551},{3641559808,3641561087},{3641749504,3641753599},{3641901312,3641901567},{3641970688,3641978879},{3641995264,3641999359},{3642104832,3642105855},{3642109952,3642114047},
+	{3642155008,3642167295},{3642267648,3642269695},{3642380288,3642384383},{3642413056,3642415103},{3642419200,3642421247},{3642482688,3642490879},{3642606592,3642607103},{3642667008,3642671103},
+	{3642707968,3642712063},{3642728448,3642736639},{3644655616,3644669951},{3644684288,3644688383},{3644698624,3644702719},{3644878848,3644882943},{3645104128,3645112319},{3645116416,3645120511},
+	{3645218816,3645222911},{3645280256,3645284351},{3645288448,3645292543},{3645333504,3645337599},{3645423616,3645427711},{3645497344,3645501439},{3645507584,3645509631},{3645558784,3645562879},
+	{3645595648,3645603839},{3645669376,3645677567},{3645747200,3645751295},{3645874176,3645882367},{3645894656,3645898751},{3648016384,3648020479},{3648028672,3648036863},{3648040960,3648043007},
+	{3648073728,3648086015},{3648125184,3648125439},{3648155648,3648159743},{3648167936,3648172031},{3648180224,3648184319},{3648221184,3648233471},{3648258048,3648266239},{3648311296,3648323583},
+	{3648360448,3648368639},{3648393216,3648397311},{3648417792,3648421887},{3648467200,3648470015},{3648470272,3648470527},{3648470784,3648471039},{3650105344,3650109439},{3650224128,3650232319},
+	{3650248704,3650256895},{3650310144,3650314239},{3650367232,3650367487},{3650433024,3650437119},{3650461696,3650465791},{3650547712,3650551807},{3650576384,3650580479},{3651010560,3651076095},
+	{3651141632,3651207167},{3651210240,3651210751},{3651340800,3651341311},{3651343872,3651346431},{3651670016,3651674111},{3651797504,3651799039},{3651846144,3651850239},{3651870720,3651874815},
+	{3651919872,3651921919},{3651969024,3651977215},{3652120576,3652124671},{3652182016,3652190207},{3652583424,3652648959},{3653423104,3653427199},{3653443584,3653447679},{3653480448,3653488639},
+	{3653492736,3653500927},{3653558272,3653566463},{3653623552,3653623807},{3653656576,3653660671},{3653738496,3653746687},{3654025216,3654287359},{3655073792,3655204863},{3663884032,3663884287},
+	{3663992320,3663992575},{3664001792,3664002047},{3664008960,3664009215},{3669849600,3669849855},{3671397888,3671400447},{3671425024,3671429119},{3671615488,3671616511},{3673588224,3673588479},
+	{3673590784,3673591807},{3679193856,3679194111},{3679194624,3679194687},{3680124928,3680133119},{3695317248,3695317503},{3695372032,3695373055},{3701294080,3701294335},{3701295616,3701296127},
+	{3701301248,3701305343},{3701392384,3701393663},{3701397504,3701398527},{3705911040,3705911295},{3706257408,3706322943},{3706847232,3706912767},{3706961920,3706978303},{3715727360,3715735551},
+	{3716619776,3716620031},{3716660480,3716660735},{3732668416,3732668671},{3732671488,3732671743},{3732673024,3732673279},{3732674304,3732674559},{3732690176,3732690431},{3732697088,3732698111},
+	{3732703488,3732703743},{3732704256,3732704511},{3732705536,3732705791},{3732707328,3732707583},{3732710400,3732710655},{3732714752,3732715007},{3732715264,3732715519},{3732729856,3732731391},
+	{3732732160,3732732415},{3732732928,3732733439},{3742986240,3742988287},{3743019008,3743021055},{3743131648,3743133695},{3743275008,3743276031},{3752140032,3752140799},{3754557440,3754565631},
+	{3755988992,3755989759},{3757834240,3757867007},{3757878528,3757878783},{4029825024,4029825535},
+};
@@ -0,0 +1,244 @@
+#pragma once
+// Open-addressing hash table for per-address state
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+inline size_t FlatHash(uint32_t key)
+{
+	// murmur3 finalizer, independent of the multiplicative hash used to select shards
+	key ^= key >> 16;
+	key *= 0x85EBCA6B;
+	key ^= key >> 13;
+	key *= 0xC2B2AE35;
+	key ^= key >> 16;
+	return key;
+}
+
+inline size_t FlatHash(uint64_t key)
+{
+	key ^= key >> 33;
+	key *= 0xFF51AFD7ED558CCDULL;
+	key ^= key >> 33;
+	key *= 0xC4CEB9FE1A85EC53ULL;
+	key ^= key >> 33;
+	return (size_t)key;
+}
+
+// Linear probing with backward-shift deletion; records are stored inline in a single array.
+// Key 0 marks empty slots and cannot be stored (0.0.0.0/8 is never tracked).
+// The array only grows when it is half full, lookups and updates never allocate.
+template <typename Key, typename Value>
+class FlatTable
+{
+private:
+	struct Slot
+	{
+		Key key;
+		Value value;
+	};
+
+	std::vector<Slot> slots;
+	size_t mask;
+	size_t count;
+
+	size_t Home(Key key) const
+	{
+		return FlatHash(key) & mask;
+	}
+
+	void Grow()
+	{
+		std::vector<Slot> old(slots.size() * 2);
+		old.swap(slots);
+		for (auto it = slots.begin(); it != slots.end(); it++)
+		{
+			it->key = 0;
+		}
+		mask = slots.size() - 1;
+		for (auto it = old.begin(); it != old.end(); it++)
+		{
+			if (it->key != 0)
+			{
+				size_t i = Home(it->key);
+				while (slots[i].key != 0)
+				{
+					i = (i + 1) & mask;
+				}
+				slots[i] = *it;
+			}
+		}
+	}
+
+	void EraseSlot(size_t hole)
+	{
+		// Shift following entries of the cluster back so that no tombstones are needed
+		size_t i = hole;
+		while (true)
+		{
+			i = (i + 1) & mask;
+			if (slots[i].key == 0)
+			{
+				break;
+			}
+			size_t home = Home(slots[i].key);
+			if (((i - home) & mask) >= ((i - hole) & mask))
+			{
+				slots[hole] = slots[i];
+				hole = i;
+			}
+		}
+		slots[hole].key = 0;
+		count--;
+	}
+
+public:
+	FlatTable(size_t reserve = 16)
+	{
+		size_t capacity = 16;
+		while (capacity < reserve * 2)
+		{
+			capacity *= 2;
+		}
+		slots.resize(capacity);
+		for (auto it = slots.begin(); it != slots.end(); it++)
+		{
+			it->key = 0;
+		}
+		mask = capacity - 1;
+		count = 0;
+	}
+
+	Value* Find(Key key)
+	{
+		for (size_t i = Home(key); slots[i].key != 0; i = (i + 1) & mask)
+		{
+			if (slots[i].key == key)
+			{
+				return &slots[i].value;
+			}
+		}
+		return NULL;
+	}
+
+	const Value* Find(Key key) const
+	{
+		return const_cast<FlatTable*>(this)->Find(key);
+	}
+
+	// Returns the existing record or a new slot whose value the caller has to initialize
+	Value* Insert(Key key)
+	{
+		if ((count + 1) * 2 > slots.size())
+		{
+			Grow();
+		}
+		size_t i = Home(key);
+		for (; slots[i].key != 0; i = (i + 1) & mask)
+		{
+			if (slots[i].key == key)
+			{
+				return &slots[i].value;
+			}
+		}
+		slots[i].key = key;
+		count++;
+		return &slots[i].value;
+	}
+
+	// Returns the existing record or inserts a copy of value
+	Value* Insert(Key key, const Value &value)
+	{
+		size_t before = count;
+		Value *slot = Insert(key);
+		if (count != before)
+		{
+			*slot = value;
+		}
+		return slot;
+	}
+
+	bool Erase(Key key)
+	{
+		for (size_t i = Home(key); slots[i].key != 0; i = (i + 1) & mask)
+		{
+			if (slots[i].key == key)
+			{
+				EraseSlot(i);
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// Removes every record for which predicate(key, value) returns true
+	template <typename Predicate>
+	void EraseIf(Predicate predicate)
+	{
+		for (size_t i = 0; i < slots.size(); i++)
+		{
+			// Re-check the slot after a removal, the cluster was shifted into it
+			while (slots[i].key != 0 && predicate(slots[i].key, slots[i].value))
+			{
+				EraseSlot(i);
+			}
+		}
+	}
+
+	// Removes the record with the lowest rank(value) among the first samples records at or
+	// after slot start, which approximates evicting the lowest one of the whole table
+	template <typename Rank>
+	bool EvictSample(size_t start, size_t samples, Rank rank)
+	{
+		size_t victim = 0;
+		size_t seen = 0;
+		decltype(rank(slots[0].value)) lowest{};
+		for (size_t i = start & mask, visited = 0; seen < samples && visited < slots.size(); i = (i + 1) & mask, visited++)
+		{
+			if (slots[i].key == 0)
+			{
+				continue;
+			}
+			auto value_rank = rank(slots[i].value);
+			if (seen == 0 || value_rank < lowest)
+			{
+				lowest = value_rank;
+				victim = i;
+			}
+			seen++;
+		}
+		if (seen == 0)
+		{
+			return false;
+		}
+		EraseSlot(victim);
+		return true;
+	}
+
+	template <typename Function>
+	void ForEach(Function function) const
+	{
+		for (auto it = slots.begin(); it != slots.end(); it++)
+		{
+			if (it->key != 0)
+			{
+				function(it->key, it->value);
+			}
+		}
+	}
+
+	void Clear()
+	{
+		for (auto it = slots.begin(); it != slots.end(); it++)
+		{
+			it->key = 0;
+		}
+		count = 0;
+	}
+
+	size_t Size() const
+	{
+		return count;
+	}
+};
@@ -1,2 +1,4 @@
-CIDR HaxBallServers[] = {{1753350144,16},{402456576,16}};
-CIDRMatcher HaxBallMatcher(HaxBallServers, sizeof(HaxBallServers) / sizeof(HaxBallServers[0]));
+constexpr CIDR HaxBallServers[] = {{402456576,16},{1753350144,16}};
+constexpr CIDRRange haxball_ranges[] = {CIDRToRange(HaxBallServers[0]), CIDRToRange(HaxBallServers[1])};
+static_assert(IsRangeTable(haxball_ranges), "HaxBall ranges must be sorted and disjoint");
+constexpr CIDRMatcher HaxBallMatcher(haxball_ranges);
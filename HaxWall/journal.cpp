@@ -0,0 +1,216 @@
+// Append-only binary event journal in memory-mapped segment files
+
+#include "stdafx.h"
+#include "journal.h"
+#include <Windows.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+static uint64_t JournalTime()
+{
+	return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+// Deletes the oldest segment files, of any run, until at most keep are left
+static void PruneSegments(size_t keep)
+{
+	std::vector<std::pair<std::pair<unsigned long long, unsigned int>, std::string>> files;
+	WIN32_FIND_DATAA found;
+	HANDLE search = FindFirstFileA(JOURNAL_DIRECTORY "\\*.hxj", &found);
+	if (search == INVALID_HANDLE_VALUE)
+	{
+		return;
+	}
+	do
+	{
+		unsigned long long run;
+		unsigned int sequence;
+		if (sscanf(found.cFileName, "%llu-%u.hxj", &run, &sequence) == 2)
+		{
+			files.push_back(std::make_pair(std::make_pair(run, sequence), std::string(found.cFileName)));
+		}
+	} while (FindNextFileA(search, &found));
+	FindClose(search);
+
+	if (files.size() <= keep)
+	{
+		return;
+	}
+	std::sort(files.begin(), files.end());
+	for (size_t i = 0; i < files.size() - keep; i++)
+	{
+		std::string path = std::string(JOURNAL_DIRECTORY "\\") + files[i].second;
+		if (!DeleteFileA(path.c_str()))
+		{
+			std::cerr << "Failed to delete journal segment " << path << ": " << GetLastError() << std::endl;
+		}
+	}
+}
+
+EventJournal::EventJournal() : position(0), started(0), open(false), writers(0)
+{
+	ZeroMemory(segments, sizeof(segments));
+}
+
+EventJournal::~EventJournal()
+{
+	Close();
+}
+
+bool EventJournal::OpenSegment(Segment &segment, uint32_t sequence)
+{
+	char path[MAX_PATH];
+	snprintf(path, sizeof(path), "%s\\%llu-%u.hxj", JOURNAL_DIRECTORY, (unsigned long long)started, sequence);
+
+	HANDLE file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		std::cerr << "Failed to create journal segment " << path << ": " << GetLastError() << std::endl;
+		return false;
+	}
+
+	// Mapping the full size extends the file, unused records read back as zero
+	ULONGLONG size = sizeof(JournalHeader) + (ULONGLONG)JOURNAL_SEGMENT_RECORDS * sizeof(JournalRecord);
+	HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READWRITE, (DWORD)(size >> 32), (DWORD)size, NULL);
+	void *view = mapping != NULL ? MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, (SIZE_T)size) : NULL;
+	if (view == NULL)
+	{
+		std::cerr << "Failed to map journal segment " << path << ": " << GetLastError() << std::endl;
+		if (mapping != NULL)
+		{
+			CloseHandle(mapping);
+		}
+		CloseHandle(file);
+		return false;
+	}
+
+	segment.file = file;
+	segment.mapping = mapping;
+	segment.header = (JournalHeader*)view;
+	segment.records = (JournalRecord*)((unsigned char*)view + sizeof(JournalHeader));
+
+	segment.header->magic = JOURNAL_MAGIC;
+	segment.header->version = JOURNAL_VERSION;
+	segment.header->record_size = sizeof(JournalRecord);
+	segment.header->sequence = sequence;
+	segment.header->capacity = JOURNAL_SEGMENT_RECORDS;
+	segment.header->created = JournalTime();
+	return true;
+}
+
+void EventJournal::CloseSegment(Segment &segment, uint64_t used)
+{
+	if (segment.header == NULL)
+	{
+		return;
+	}
+	UnmapViewOfFile(segment.header);
+	CloseHandle(segment.mapping);
+
+	// Cut the unused tail so finished segments only hold records
+	LARGE_INTEGER end;
+	end.QuadPart = sizeof(JournalHeader) + used * sizeof(JournalRecord);
+	if (SetFilePointerEx(segment.file, end, NULL, FILE_BEGIN))
+	{
+		SetEndOfFile(segment.file);
+	}
+	CloseHandle(segment.file);
+	ZeroMemory(&segment, sizeof(segment));
+}
+
+bool EventJournal::Open()
+{
+	std::lock_guard<std::mutex> lock(rotate_lock);
+	if (!CreateDirectoryA(JOURNAL_DIRECTORY, NULL) && GetLastError() != ERROR_ALREADY_EXISTS)
+	{
+		std::cerr << "Failed to create journal directory: " << GetLastError() << std::endl;
+		return false;
+	}
+	started = JournalTime();
+	PruneSegments(JOURNAL_MAX_SEGMENTS - 1);
+	if (!OpenSegment(segments[0], 0))
+	{
+		return false;
+	}
+	position = 0;
+	open = true;
+	return true;
+}
+
+bool EventJournal::Rotate(uint64_t generation)
+{
+	std::lock_guard<std::mutex> lock(rotate_lock);
+	if (!open)
+	{
+		return false;
+	}
+	if ((position.load() >> GENERATION_SHIFT) != generation)
+	{
+		return true; // Rotated by another writer
+	}
+
+	// The slot of the next generation still holds the segment before the current one
+	Segment &next = segments[(generation + 1) % 3];
+	CloseSegment(next, JOURNAL_SEGMENT_RECORDS);
+	PruneSegments(JOURNAL_MAX_SEGMENTS - 1);
+	if (!OpenSegment(next, (uint32_t)(generation + 1)))
+	{
+		open = false; // Stop journaling instead of retrying on every event
+		return false;
+	}
+	position.store((generation + 1) << GENERATION_SHIFT);
+	return true;
+}
+
+void EventJournal::Close()
+{
+	// Cleared before unmapping, writers that already saw the journal open are waited for.
+	// Not under the rotate lock, a writer may need it to finish.
+	open = false;
+	while (writers.load() != 0)
+	{
+		std::this_thread::yield();
+	}
+
+	std::lock_guard<std::mutex> lock(rotate_lock);
+	uint64_t current = position.load();
+	uint64_t generation = current >> GENERATION_SHIFT;
+	uint64_t used = current & (((uint64_t)1 << GENERATION_SHIFT) - 1);
+	for (uint64_t i = 0; i < 3; i++)
+	{
+		Segment &segment = segments[i];
+		CloseSegment(segment, i == generation % 3 && used < JOURNAL_SEGMENT_RECORDS ? used : JOURNAL_SEGMENT_RECORDS);
+	}
+}
+
+void EventJournal::Append(JournalEvent event, BanReason reason, uint32_t addr, uint16_t port)
+{
+	// Counted before open is checked, so Close either sees this writer or it sees the journal closed
+	writers++;
+	if (open)
+	{
+		JournalRecord record = { JournalTime(), addr, port, event, reason };
+		for (;;)
+		{
+			uint64_t claimed = position.fetch_add(1);
+			uint64_t generation = claimed >> GENERATION_SHIFT;
+			uint64_t index = claimed & (((uint64_t)1 << GENERATION_SHIFT) - 1);
+			if (index < JOURNAL_SEGMENT_RECORDS)
+			{
+				segments[generation % 3].records[index] = record;
+				break;
+			}
+			if (!Rotate(generation))
+			{
+				break;
+			}
+		}
+	}
+	writers--;
+}
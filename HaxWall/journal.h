@@ -0,0 +1,99 @@
+#pragma once
+// Append-only binary event journal in memory-mapped segment files, read by scripts/journal.py
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+#define JOURNAL_DIRECTORY "journal"
+#define JOURNAL_SEGMENT_RECORDS (1 << 20) // records per segment file (16 MB)
+#define JOURNAL_MAX_SEGMENTS 64 // segment files kept across runs, the oldest are deleted first (1 GB)
+#define JOURNAL_MAGIC 0x314A5848 // "HXJ1"
+#define JOURNAL_VERSION 1
+
+enum class JournalEvent : uint8_t {
+	None,
+	FirstPacket,
+	Reappearance,
+	Whitelist,
+	Ban,
+	Unban,
+	Query,
+	Protecting
+};
+
+enum class BanReason : uint8_t {
+	None,
+	Blacklist,
+	Multiport,
+	Flood,
+	Restored // ban kept by the packet filter across a restart
+};
+
+// Fixed 16 byte record, an unused slot is all zero
+struct JournalRecord
+{
+	uint64_t time; // milliseconds since the Unix epoch
+	uint32_t addr;
+	uint16_t port;
+	JournalEvent event;
+	BanReason reason;
+};
+
+static_assert(sizeof(JournalRecord) == 16, "JournalRecord layout is part of the file format");
+
+// Segment file header, records start right after it
+struct JournalHeader
+{
+	uint32_t magic;
+	uint16_t version;
+	uint16_t record_size;
+	uint32_t sequence;
+	uint32_t capacity; // records
+	uint64_t created; // milliseconds since the Unix epoch
+	uint8_t reserved[40];
+};
+
+static_assert(sizeof(JournalHeader) == 64, "JournalHeader layout is part of the file format");
+static_assert(JOURNAL_MAX_SEGMENTS >= 3, "the mapped segments of the current run are never deleted");
+
+// Writers claim a slot with one atomic add and store the record straight into the mapped
+// view. The position packs the segment generation above the slot index, so a writer can
+// never claim a slot of a segment it did not see. The view of a finished segment stays
+// mapped for one more rotation to cover writers that claimed a slot just before it.
+class EventJournal
+{
+private:
+	struct Segment
+	{
+		void *file;
+		void *mapping;
+		JournalHeader *header;
+		JournalRecord *records;
+	};
+
+	static const int GENERATION_SHIFT = 40;
+
+	Segment segments[3];
+	std::atomic<uint64_t> position;
+	std::mutex rotate_lock;
+	uint64_t started;
+	std::atomic<bool> open;
+	std::atomic<uint32_t> writers; // Appends that may still touch a view
+
+	bool OpenSegment(Segment &segment, uint32_t sequence);
+	void CloseSegment(Segment &segment, uint64_t used);
+	bool Rotate(uint64_t generation);
+
+public:
+	EventJournal();
+	~EventJournal();
+
+	// Creates the first segment of a new run, older segments are kept up to JOURNAL_MAX_SEGMENTS
+	bool Open();
+
+	// Waits for running Appends, later ones are dropped. Safe while capture runs.
+	void Close();
+
+	void Append(JournalEvent event, BanReason reason, uint32_t addr, uint16_t port);
+};
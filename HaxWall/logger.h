@@ -0,0 +1,239 @@
+#pragma once
+// Event log written by a background thread, the packet threads never wait for I/O
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <thread>
+#include "mpsc_queue.h"
+
+#define LOG_QUEUE_SIZE 8192 // records buffered for the writer, power of two
+#define LOG_RATE_SOURCES 50 // source records (first packet, reappearance) per second before sampling kicks in
+#define LOG_RATE_EVENTS 1000 // records per second of every other category
+#define LOG_WRITER_IDLE 20 // milliseconds the writer sleeps when the queue is empty
+
+enum class LogCategory : uint8_t {
+	Info,
+	Source,
+	Ban,
+	Unban,
+	Query,
+	Count
+};
+
+// Records are accepted up to a per-category rate; the rest, and everything that finds
+// the queue full, is counted and reported by the writer instead of slowing down capture.
+class EventLogger
+{
+private:
+	struct Record
+	{
+		time_t time;
+		const char *msg; // string literal
+		uint64_t addr; // IPv4 address, or the upper half of an IPv6 network
+		LogCategory category;
+		uint8_t ipv6_prefix; // 0 for IPv4
+	};
+
+	struct alignas(64) Limit
+	{
+		std::atomic<time_t> second;
+		std::atomic<uint32_t> count;
+		std::atomic<uint64_t> dropped; // since the last report
+		std::atomic<uint64_t> total_dropped;
+	};
+
+	MpscQueue<Record, LOG_QUEUE_SIZE> queue;
+	Limit limits[(size_t)LogCategory::Count];
+	std::ofstream out;
+	bool console;
+	std::thread writer;
+	std::atomic<bool> running;
+
+	static uint32_t Rate(LogCategory category)
+	{
+		return category == LogCategory::Source ? LOG_RATE_SOURCES : LOG_RATE_EVENTS;
+	}
+
+	bool Admit(LogCategory category, time_t now)
+	{
+		Limit &limit = limits[(size_t)category];
+		time_t second = limit.second.load(std::memory_order_relaxed);
+		if (second != now && limit.second.compare_exchange_strong(second, now, std::memory_order_relaxed))
+		{
+			limit.count.store(0, std::memory_order_relaxed);
+		}
+		return limit.count.fetch_add(1, std::memory_order_relaxed) < Rate(category);
+	}
+
+	static void WriteLine(std::ostream &stream, const char *stamp, const Record &record)
+	{
+		stream << "[" << stamp << "] " << record.msg << " ";
+		if (record.ipv6_prefix != 0)
+		{
+			stream << std::hex << ((record.addr >> 48) & 0xFFFF) << ":" << ((record.addr >> 32) & 0xFFFF) << ":" <<
+				((record.addr >> 16) & 0xFFFF) << ":" << (record.addr & 0xFFFF) << std::dec << "::/" << (int)record.ipv6_prefix << "\n";
+			return;
+		}
+		uint32_t addr = (uint32_t)record.addr;
+		stream << ((addr >> 24) & 0xFF) << "." << ((addr >> 16) & 0xFF) << "." <<
+			((addr >> 8) & 0xFF) << "." << (addr & 0xFF) << "\n";
+	}
+
+	void Write(const Record &record, time_t &stamp_time, char *stamp, size_t stamp_size)
+	{
+		// put_time runs once per second of records, not once per line
+		if (record.time != stamp_time)
+		{
+			std::tm tm{};
+#ifdef _WIN32
+			localtime_s(&tm, &record.time);
+#else
+			localtime_r(&record.time, &tm);
+#endif
+			std::strftime(stamp, stamp_size, "%Y-%m-%d %H:%M:%S", &tm);
+			stamp_time = record.time;
+		}
+		if (console)
+		{
+			WriteLine(std::cout, stamp, record);
+		}
+		if (out.is_open())
+		{
+			WriteLine(out, stamp, record);
+		}
+	}
+
+	void ReportDropped()
+	{
+		static const char *names[] = { "info", "source", "ban", "unban", "query" };
+		static_assert(sizeof(names) / sizeof(names[0]) == (size_t)LogCategory::Count, "LogCategory names out of date");
+		for (size_t i = 0; i < (size_t)LogCategory::Count; i++)
+		{
+			uint64_t dropped = limits[i].dropped.exchange(0, std::memory_order_relaxed);
+			if (dropped == 0)
+			{
+				continue;
+			}
+			if (console)
+			{
+				std::cout << "Dropped " << dropped << " " << names[i] << " log records." << "\n";
+			}
+			if (out.is_open())
+			{
+				out << "Dropped " << dropped << " " << names[i] << " log records." << "\n";
+			}
+		}
+	}
+
+	void Run()
+	{
+		Record record;
+		time_t stamp_time = 0;
+		char stamp[32] = "";
+		time_t last_report = 0;
+		for (;;)
+		{
+			bool stop = !running.load();
+			size_t written = 0;
+			while (queue.TryPop(record))
+			{
+				Write(record, stamp_time, stamp, sizeof(stamp));
+				written++;
+			}
+
+			time_t now = std::time(nullptr);
+			if (now != last_report || stop)
+			{
+				ReportDropped();
+				last_report = now;
+				written++;
+			}
+			if (written > 0)
+			{
+				// One flush per batch instead of one per line
+				if (console)
+				{
+					std::cout.flush();
+				}
+				if (out.is_open())
+				{
+					out.flush();
+				}
+			}
+			if (stop)
+			{
+				break;
+			}
+			if (queue.Depth() == 0)
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(LOG_WRITER_IDLE));
+			}
+		}
+	}
+
+	// Never blocks, records over the rate limit or beyond the queue capacity are dropped
+	void Push(const Record &record)
+	{
+		LogCategory category = record.category;
+		if (!Admit(category, record.time) || !queue.TryPush(record))
+		{
+			limits[(size_t)category].dropped.fetch_add(1, std::memory_order_relaxed);
+			limits[(size_t)category].total_dropped.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+public:
+	// A NULL path disables the log file, console echo can be turned off for replays
+	EventLogger(const char *path, bool echo = true) : console(echo), running(true)
+	{
+		if (path != NULL)
+		{
+			out.open(path, std::ios::out);
+		}
+		for (size_t i = 0; i < (size_t)LogCategory::Count; i++)
+		{
+			limits[i].second.store(0, std::memory_order_relaxed);
+			limits[i].count.store(0, std::memory_order_relaxed);
+			limits[i].dropped.store(0, std::memory_order_relaxed);
+			limits[i].total_dropped.store(0, std::memory_order_relaxed);
+		}
+		if (console && out.is_open())
+		{
+			std::cout << "Logging to " << path << "." << std::endl;
+		}
+		writer = std::thread(&EventLogger::Run, this);
+	}
+
+	EventLogger(const EventLogger&) = delete;
+	EventLogger &operator=(const EventLogger&) = delete;
+
+	void Log(LogCategory category, const char *msg, uint32_t addr)
+	{
+		Push(Record{ std::time(nullptr), msg, addr, category, 0 });
+	}
+
+	// IPv6 sources are logged by the network they are tracked by
+	void Log6(LogCategory category, const char *msg, uint64_t network, uint8_t prefix)
+	{
+		Push(Record{ std::time(nullptr), msg, network, category, prefix });
+	}
+
+	uint64_t Dropped(LogCategory category) const
+	{
+		return limits[(size_t)category].total_dropped.load(std::memory_order_relaxed);
+	}
+
+	~EventLogger()
+	{
+		running = false;
+		writer.join();
+		if (out.is_open())
+		{
+			out.close();
+		}
+	}
+};
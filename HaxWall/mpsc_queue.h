@@ -0,0 +1,91 @@
+#pragma once
+// Bounded lock-free queue for many producers and a single consumer
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Each cell carries a sequence number telling producers and the consumer whose turn it is,
+// so pushes only contend on the tail index and a full queue fails instead of blocking.
+template <typename T, size_t Size>
+class MpscQueue
+{
+private:
+	struct Cell
+	{
+		std::atomic<size_t> sequence;
+		T value;
+	};
+
+	static_assert((Size & (Size - 1)) == 0, "MpscQueue size must be a power of two");
+
+	Cell cells[Size];
+	alignas(64) std::atomic<size_t> tail;
+	alignas(64) std::atomic<size_t> head; // only advanced by the consumer
+
+public:
+	MpscQueue() : tail(0), head(0)
+	{
+		for (size_t i = 0; i < Size; i++)
+		{
+			cells[i].sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	MpscQueue(const MpscQueue&) = delete;
+	MpscQueue &operator=(const MpscQueue&) = delete;
+
+	// Returns false if the queue is full
+	bool TryPush(const T &value)
+	{
+		size_t pos = tail.load(std::memory_order_relaxed);
+		Cell *cell;
+		for (;;)
+		{
+			cell = &cells[pos & (Size - 1)];
+			size_t sequence = cell->sequence.load(std::memory_order_acquire);
+			intptr_t diff = (intptr_t)sequence - (intptr_t)pos;
+			if (diff == 0)
+			{
+				if (tail.compare_exchange_weak(pos, pos + 1))
+				{
+					break;
+				}
+			}
+			else if (diff < 0)
+			{
+				return false;
+			}
+			else
+			{
+				pos = tail.load(std::memory_order_relaxed);
+			}
+		}
+		cell->value = value;
+		cell->sequence.store(pos + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Consumer only
+	bool TryPop(T &value)
+	{
+		size_t pos = head.load(std::memory_order_relaxed);
+		Cell &cell = cells[pos & (Size - 1)];
+		if (cell.sequence.load(std::memory_order_acquire) != pos + 1)
+		{
+			return false;
+		}
+		value = cell.value;
+		cell.sequence.store(pos + Size, std::memory_order_release);
+		head.store(pos + 1, std::memory_order_relaxed);
+		return true;
+	}
+
+	// Includes pushes that are reserved but not yet published
+	size_t Depth() const
+	{
+		size_t queued = tail.load(); // sequentially consistent so a consumer going idle cannot miss a push
+		size_t taken = head.load(std::memory_order_relaxed);
+		return queued > taken ? queued - taken : 0;
+	}
+};
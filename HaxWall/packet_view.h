@@ -0,0 +1,197 @@
+#pragma once
+// Zero-copy views of the raw IP packets in the receive buffers, accessors read in place
+
+#include <cstddef>
+#include <cstdint>
+
+// Network order fields at any alignment, compiles to a load and a byte swap
+inline uint16_t LoadBig16(const unsigned char *p)
+{
+	return (uint16_t)(p[0] << 8 | p[1]);
+}
+
+inline uint32_t LoadBig32(const unsigned char *p)
+{
+	return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+}
+
+enum class PacketParse : uint8_t {
+	Udp,
+	NotUdp,
+	Fragment, // not the first fragment, there is no UDP header
+	Malformed // truncated before the UDP header or inconsistent lengths
+};
+
+struct UdpView
+{
+	static const size_t HEADER_SIZE = 8;
+
+	const unsigned char *data;
+
+	uint16_t SourcePort() const
+	{
+		return LoadBig16(data);
+	}
+
+	uint16_t DestinationPort() const
+	{
+		return LoadBig16(data + 2);
+	}
+};
+
+// IPv4 header of a received packet. The stack may truncate datagrams to the receive
+// buffer, so size can be below TotalLength() but has to cover the UDP header.
+struct Ipv4View
+{
+	static const size_t MIN_HEADER_SIZE = 20;
+
+	const unsigned char *data;
+	size_t size; // bytes received
+
+	uint8_t Version() const
+	{
+		return data[0] >> 4;
+	}
+
+	// Including options
+	size_t HeaderLength() const
+	{
+		return (size_t)(data[0] & 0x0F) * 4;
+	}
+
+	uint16_t TotalLength() const
+	{
+		return LoadBig16(data + 2);
+	}
+
+	// In units of 8 bytes
+	uint16_t FragmentOffset() const
+	{
+		return LoadBig16(data + 6) & 0x1FFF;
+	}
+
+	uint8_t Protocol() const
+	{
+		return data[9];
+	}
+
+	uint32_t Source() const
+	{
+		return LoadBig32(data + 12);
+	}
+
+	// Locates the UDP header behind the options. A first fragment is parsed like a whole
+	// datagram, its ports stand for the whole datagram.
+	PacketParse Udp(UdpView &udp) const
+	{
+		// Headers without options take one compare per word: version and IHL, then the
+		// fragment offset and protocol with the flags and TTL masked out
+		const size_t end = MIN_HEADER_SIZE + UdpView::HEADER_SIZE;
+		if (size >= end && data[0] == 0x45 && (LoadBig32(data + 6) & 0x1FFF00FF) == 17 && TotalLength() >= end)
+		{
+			udp.data = data + MIN_HEADER_SIZE;
+			return PacketParse::Udp;
+		}
+		return UdpWithOptions(udp);
+	}
+
+private:
+	PacketParse UdpWithOptions(UdpView &udp) const
+	{
+		if (size < MIN_HEADER_SIZE || Version() != 4 || HeaderLength() < MIN_HEADER_SIZE || TotalLength() < HeaderLength())
+		{
+			return PacketParse::Malformed;
+		}
+		if (Protocol() != 17)
+		{
+			return PacketParse::NotUdp;
+		}
+		if (FragmentOffset() != 0)
+		{
+			return PacketParse::Fragment;
+		}
+		size_t end = HeaderLength() + UdpView::HEADER_SIZE;
+		if (size < end || TotalLength() < end)
+		{
+			return PacketParse::Malformed;
+		}
+		udp.data = data + HeaderLength();
+		return PacketParse::Udp;
+	}
+};
+
+#define PACKET_IPV6_EXTENSIONS 4 // extension headers walked before giving up on a packet
+
+// IPv6 header of a received packet, see Ipv4View for the size
+struct Ipv6View
+{
+	static const size_t HEADER_SIZE = 40;
+
+	const unsigned char *data;
+	size_t size; // bytes received
+
+	uint8_t Version() const
+	{
+		return data[0] >> 4;
+	}
+
+	// Bytes following the fixed header
+	uint16_t PayloadLength() const
+	{
+		return LoadBig16(data + 4);
+	}
+
+	uint8_t NextHeader() const
+	{
+		return data[6];
+	}
+
+	const unsigned char *Source() const
+	{
+		return data + 8;
+	}
+
+	// Locates the UDP header behind the hop-by-hop, routing, destination options and
+	// fragment headers
+	PacketParse Udp(UdpView &udp) const
+	{
+		if (size < HEADER_SIZE || Version() != 6)
+		{
+			return PacketParse::Malformed;
+		}
+		size_t end = HEADER_SIZE + PayloadLength(); // jumbograms are not expected on the game ports
+		uint8_t next = NextHeader();
+		size_t offset = HEADER_SIZE;
+		for (int i = 0; i < PACKET_IPV6_EXTENSIONS && (next == 0 || next == 43 || next == 44 || next == 60); i++)
+		{
+			if (offset + 8 > size)
+			{
+				return PacketParse::Malformed;
+			}
+			if (next == 44)
+			{
+				if ((LoadBig16(data + offset + 2) & 0xFFF8) != 0)
+				{
+					return PacketParse::Fragment;
+				}
+				next = data[offset];
+				offset += 8;
+			}
+			else
+			{
+				next = data[offset];
+				offset += ((size_t)data[offset + 1] + 1) * 8;
+			}
+		}
+		if (next != 17)
+		{
+			return PacketParse::NotUdp;
+		}
+		if (offset + UdpView::HEADER_SIZE > size || offset + UdpView::HEADER_SIZE > end)
+		{
+			return PacketParse::Malformed;
+		}
+		udp.data = data + offset;
+		return PacketParse::Udp;
+	}
+};
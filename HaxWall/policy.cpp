@@ -0,0 +1,123 @@
+// Rate, port and ban thresholds per destination port, loaded from a config file and replaced at runtime
+
+#include "stdafx.h"
+#include "policy.h"
+#include <Windows.h>
+#include <fstream>
+#include <iostream>
+
+PolicyReloader::PolicyReloader(const char *path) : path(path), stamp(0), current(NULL), policy_function(NULL), running(false)
+{
+}
+
+PolicyReloader::~PolicyReloader()
+{
+	Stop();
+	ReleaseRetired(true);
+	delete current;
+}
+
+bool PolicyReloader::Refresh()
+{
+	WIN32_FILE_ATTRIBUTE_DATA attributes;
+	uint64_t found = 0;
+	if (GetFileAttributesExA(path.c_str(), GetFileExInfoStandard, &attributes))
+	{
+		found = (uint64_t)attributes.ftLastWriteTime.dwHighDateTime << 32 | attributes.ftLastWriteTime.dwLowDateTime;
+	}
+	if (found == stamp)
+	{
+		return false;
+	}
+	stamp = found; // A broken file is reported once, not on every poll
+
+	PolicyTable *loaded = NULL;
+	if (found != 0)
+	{
+		std::ifstream in(path);
+		size_t error_line = 0;
+		loaded = new PolicyTable();
+		if (!in.is_open() || !loaded->Parse(in, error_line))
+		{
+			delete loaded;
+			std::cerr << "Invalid policy " << path << " at line " << error_line << ", keeping the current policy." << std::endl;
+			return false;
+		}
+		std::cout << "Loaded policy " << path << " with " << loaded->Size() << " profiles." << std::endl;
+	}
+	else if (current != NULL)
+	{
+		std::cout << "Policy " << path << " was removed, using the compiled-in limits." << std::endl;
+	}
+	if (current != NULL)
+	{
+		retired.push_back(Retired{ current, MonotonicTicks() });
+	}
+	current = loaded;
+	return true;
+}
+
+void PolicyReloader::ReleaseRetired(bool all)
+{
+	tick_t now = MonotonicTicks();
+	size_t kept = 0;
+	for (size_t i = 0; i < retired.size(); i++)
+	{
+		if (all || now - retired[i].since >= SECONDS_TO_TICKS(POLICY_RETIRE_DELAY))
+		{
+			delete retired[i].policy;
+		}
+		else
+		{
+			retired[kept++] = retired[i];
+		}
+	}
+	retired.resize(kept);
+}
+
+void PolicyReloader::Load()
+{
+	Refresh();
+}
+
+void PolicyReloader::Run()
+{
+	for (;;)
+	{
+		{
+			std::unique_lock<std::mutex> lock(wake_lock);
+			wake.wait_for(lock, std::chrono::seconds(POLICY_POLL_INTERVAL), [this]() { return !running.load(); });
+			if (!running.load())
+			{
+				break;
+			}
+		}
+
+		if (Refresh())
+		{
+			policy_function(current);
+		}
+		ReleaseRetired(false);
+	}
+}
+
+void PolicyReloader::Start(PolicyFunction function)
+{
+	policy_function = function;
+	running = true;
+	watcher = std::thread(&PolicyReloader::Run, this);
+}
+
+void PolicyReloader::Stop()
+{
+	if (!watcher.joinable())
+	{
+		return;
+	}
+	{
+		std::lock_guard<std::mutex> lock(wake_lock);
+		running = false;
+	}
+	wake.notify_one();
+	watcher.join();
+}
@@ -0,0 +1,315 @@
+#pragma once
+// Rate, port and ban thresholds per destination port, loaded from a config file and replaced at runtime.
+// Included by ban.h after the compiled-in limits, which stay the default policy.
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <istream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "clock.h"
+
+#define POLICY_PATH "policy.cfg"
+#define POLICY_POLL_INTERVAL 5 // seconds between checks of the config file
+#define POLICY_RETIRE_DELAY 10 // seconds a replaced policy stays valid for packets still using it
+#define POLICY_MAX_PROFILES 64 // profiles per config file
+
+// Thresholds known at compile time, the firewall and the rate detectors are instantiated
+// for it so that the limits fold into constants
+template <uint32_t Packets, uint32_t FrameTicks, uint32_t Ports, uint32_t MultiportTicks, uint32_t FloodTicks, uint32_t BlacklistTicks>
+struct FixedPolicy
+{
+	constexpr uint32_t MaxPackets() const
+	{
+		return Packets;
+	}
+
+	constexpr uint32_t PacketFrame() const // ticks
+	{
+		return FrameTicks;
+	}
+
+	constexpr uint32_t MaxPorts() const
+	{
+		return Ports;
+	}
+
+	constexpr tick_t BanMultiport() const
+	{
+		return MultiportTicks;
+	}
+
+	constexpr tick_t BanFlood() const
+	{
+		return FloodTicks;
+	}
+
+	constexpr tick_t BanBlacklist() const
+	{
+		return BlacklistTicks;
+	}
+};
+
+typedef FixedPolicy<MAX_PACKETS, MAX_PACKET_FRAME_TICKS, MAX_PORTS, (uint32_t)SECONDS_TO_TICKS(BAN_DURATION_MULTIPORT),
+	(uint32_t)SECONDS_TO_TICKS(BAN_DURATION_FLOOD), (uint32_t)SECONDS_TO_TICKS(BAN_DURATION_BLACKLIST)> DefaultPolicy;
+
+// Same accessors as FixedPolicy, read from a profile of the config file
+struct PolicyProfile
+{
+	uint32_t packets;
+	uint32_t frame; // ticks
+	uint32_t ports;
+	uint32_t ban_multiport; // ticks
+	uint32_t ban_flood;
+	uint32_t ban_blacklist;
+
+	uint32_t MaxPackets() const
+	{
+		return packets;
+	}
+
+	uint32_t PacketFrame() const
+	{
+		return frame;
+	}
+
+	uint32_t MaxPorts() const
+	{
+		return ports;
+	}
+
+	tick_t BanMultiport() const
+	{
+		return ban_multiport;
+	}
+
+	tick_t BanFlood() const
+	{
+		return ban_flood;
+	}
+
+	tick_t BanBlacklist() const
+	{
+		return ban_blacklist;
+	}
+};
+
+// Profile of every destination port. One line per profile, values in seconds:
+//   # comment
+//   default packets=80 frame=1 ports=3 ban_multiport=60 ban_flood=60 ban_blacklist=3600
+//   5000 packets=40
+//   27000-27100 packets=400 ban_flood=300
+// Port lines start from the default line, which starts from the compiled-in limits. Ports
+// without a line keep DefaultPolicy unless there is a default line.
+class PolicyTable
+{
+private:
+	static const uint8_t FIXED = 0xFF;
+
+	std::vector<PolicyProfile> profiles;
+	std::vector<uint8_t> index; // profile per destination port
+
+	static bool ParseSeconds(const std::string &text, double max_seconds, uint32_t &ticks)
+	{
+		char *end;
+		double seconds = strtod(text.c_str(), &end);
+		if (end == text.c_str() || *end != '\0' || !(seconds >= 0.001 && seconds <= max_seconds))
+		{
+			return false;
+		}
+		ticks = (uint32_t)SECONDS_TO_TICKS(seconds);
+		return true;
+	}
+
+	static bool ParseNumber(const std::string &text, uint32_t min, uint32_t max, uint32_t &value)
+	{
+		char *end;
+		unsigned long number = strtoul(text.c_str(), &end, 10);
+		if (end == text.c_str() || *end != '\0' || number < min || number > max)
+		{
+			return false;
+		}
+		value = (uint32_t)number;
+		return true;
+	}
+
+	static bool ParseSetting(const std::string &setting, PolicyProfile &profile)
+	{
+		size_t equals = setting.find('=');
+		if (equals == std::string::npos)
+		{
+			return false;
+		}
+		std::string key = setting.substr(0, equals);
+		std::string value = setting.substr(equals + 1);
+		if (key == "packets")
+		{
+			return ParseNumber(value, 1, 0xFFFF, profile.packets);
+		}
+		if (key == "frame")
+		{
+			return ParseSeconds(value, 60, profile.frame);
+		}
+		if (key == "ports")
+		{
+			return ParseNumber(value, 1, MAX_PORTS, profile.ports); // PORT_SLOTS are allocated per client
+		}
+		if (key == "ban_multiport")
+		{
+			return ParseSeconds(value, 86400, profile.ban_multiport);
+		}
+		if (key == "ban_flood")
+		{
+			return ParseSeconds(value, 86400, profile.ban_flood);
+		}
+		if (key == "ban_blacklist")
+		{
+			return ParseSeconds(value, 86400, profile.ban_blacklist);
+		}
+		return false;
+	}
+
+	static bool ParsePorts(const std::string &text, uint32_t &first, uint32_t &last)
+	{
+		size_t dash = text.find('-');
+		if (dash == std::string::npos)
+		{
+			return ParseNumber(text, 1, 0xFFFF, first) && ParseNumber(text, 1, 0xFFFF, last);
+		}
+		return ParseNumber(text.substr(0, dash), 1, 0xFFFF, first) && ParseNumber(text.substr(dash + 1), 1, 0xFFFF, last) && first <= last;
+	}
+
+public:
+	PolicyTable() : index(0x10000, FIXED)
+	{
+	}
+
+	// Returns false with the line number in error_line if the config is invalid
+	bool Parse(std::istream &in, size_t &error_line)
+	{
+		DefaultPolicy fixed;
+		PolicyProfile base = { fixed.MaxPackets(), fixed.PacketFrame(), fixed.MaxPorts(), (uint32_t)fixed.BanMultiport(),
+			(uint32_t)fixed.BanFlood(), (uint32_t)fixed.BanBlacklist() };
+		bool has_default = false;
+		std::vector<std::pair<std::pair<uint32_t, uint32_t>, PolicyProfile>> ports;
+		std::string line;
+		for (error_line = 1; std::getline(in, line); error_line++)
+		{
+			std::istringstream words(line.substr(0, line.find('#')));
+			std::string name;
+			if (!(words >> name))
+			{
+				continue;
+			}
+			bool is_default = name == "default";
+			uint32_t first = 0, last = 0;
+			if (is_default ? has_default || !ports.empty() : !ParsePorts(name, first, last))
+			{
+				return false; // a single default line comes before the ports
+			}
+			PolicyProfile profile = base;
+			std::string setting;
+			while (words >> setting)
+			{
+				if (!ParseSetting(setting, profile))
+				{
+					return false;
+				}
+			}
+			// Token bucket units have to fit 32 bits
+			if ((uint64_t)profile.packets * profile.frame > 0x7FFFFFFF || ports.size() + 1 >= POLICY_MAX_PROFILES)
+			{
+				return false;
+			}
+			if (is_default)
+			{
+				base = profile;
+				has_default = true;
+			}
+			else
+			{
+				ports.push_back(std::make_pair(std::make_pair(first, last), profile));
+			}
+		}
+
+		if (has_default)
+		{
+			profiles.push_back(base);
+			std::fill(index.begin(), index.end(), 0);
+		}
+		for (auto it = ports.begin(); it != ports.end(); it++)
+		{
+			uint8_t profile = (uint8_t)profiles.size();
+			profiles.push_back(it->second);
+			std::fill(index.begin() + it->first.first, index.begin() + it->first.second + 1, profile); // later lines win
+		}
+		return true;
+	}
+
+	// NULL if the port uses DefaultPolicy
+	const PolicyProfile *Find(uint16_t port) const
+	{
+		uint8_t profile = index[port];
+		return profile == FIXED ? NULL : &profiles[profile];
+	}
+
+	size_t Size() const
+	{
+		return profiles.size();
+	}
+};
+
+typedef void(*PolicyFunction)(const PolicyTable *policy);
+
+// Watches the config file and parses it on the watcher thread whenever it changes. An
+// invalid file keeps the current policy, a removed file switches back to DefaultPolicy.
+class PolicyReloader
+{
+private:
+	struct Retired
+	{
+		PolicyTable *policy;
+		tick_t since;
+	};
+
+	std::string path;
+	uint64_t stamp; // last write time of the file, 0 while it does not exist
+	PolicyTable *current; // NULL for DefaultPolicy everywhere
+	std::vector<Retired> retired;
+	PolicyFunction policy_function;
+	std::thread watcher;
+	std::mutex wake_lock;
+	std::condition_variable wake;
+	std::atomic<bool> running;
+
+	// Returns true when the policy was replaced
+	bool Refresh();
+	void ReleaseRetired(bool all);
+	void Run();
+
+public:
+	PolicyReloader(const char *path);
+	~PolicyReloader();
+
+	PolicyReloader(const PolicyReloader&) = delete;
+	PolicyReloader &operator=(const PolicyReloader&) = delete;
+
+	// Loads the current file, if there is one
+	void Load();
+
+	const PolicyTable *Current() const
+	{
+		return current;
+	}
+
+	// Starts watching, the policy function is called on the watcher thread after every change
+	void Start(PolicyFunction function);
+
+	void Stop();
+};
@@ -0,0 +1,202 @@
+// Data center and whitelist range lists loaded from memory-mapped files and replaced at runtime
+
+#include "stdafx.h"
+#include "range_list.h"
+#include <Windows.h>
+#include <iostream>
+
+MappedRangeList::MappedRangeList() : file(INVALID_HANDLE_VALUE), mapping(NULL), view(NULL), matcher(NULL, 0)
+{
+}
+
+MappedRangeList::~MappedRangeList()
+{
+	if (view != NULL)
+	{
+		UnmapViewOfFile(view);
+	}
+	if (mapping != NULL)
+	{
+		CloseHandle(mapping);
+	}
+	if (file != INVALID_HANDLE_VALUE)
+	{
+		CloseHandle(file);
+	}
+}
+
+bool MappedRangeList::Open(const char *path)
+{
+	file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		std::cerr << "Failed to open list " << path << ": " << GetLastError() << std::endl;
+		return false;
+	}
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size) || size.QuadPart < (LONGLONG)sizeof(ListHeader) || size.QuadPart > 0x7FFFFFFF)
+	{
+		std::cerr << "List " << path << " has an invalid size." << std::endl;
+		return false;
+	}
+	mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	view = mapping != NULL ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+	if (view == NULL)
+	{
+		std::cerr << "Failed to map list " << path << ": " << GetLastError() << std::endl;
+		return false;
+	}
+
+	// Validation touches every page, lookups on the packet path do not fault later
+	size_t count;
+	const CIDRRange *ranges = ValidateRangeList(view, (size_t)size.QuadPart, count);
+	if (ranges == NULL)
+	{
+		std::cerr << "List " << path << " is not a valid range list." << std::endl;
+		return false;
+	}
+	matcher = CIDRRangeMatcher(ranges, count);
+	return true;
+}
+
+ListReloader::ListReloader(const char *blacklist_prefix, const CIDRMatcher *blacklist_fallback,
+	const char *exceptions_prefix, const CIDRMatcher *exceptions_fallback) : lists_function(NULL), running(false)
+{
+	lists[0] = List{ blacklist_prefix, blacklist_fallback, "data center", "", 0, NULL };
+	lists[1] = List{ exceptions_prefix, exceptions_fallback, "whitelist", "", 0, NULL };
+}
+
+ListReloader::~ListReloader()
+{
+	Stop();
+	ReleaseRetired(true);
+	for (size_t i = 0; i < 2; i++)
+	{
+		delete lists[i].current;
+	}
+}
+
+bool ListReloader::Refresh(List &list)
+{
+	if (list.prefix == NULL)
+	{
+		return false;
+	}
+
+	// Newest complete file of the list
+	std::string pattern = std::string(LIST_DIRECTORY) + "\\" + list.prefix + "*.hxl";
+	WIN32_FIND_DATAA found;
+	HANDLE search = FindFirstFileA(pattern.c_str(), &found);
+	if (search == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+	std::string newest;
+	uint64_t newest_stamp = 0;
+	do
+	{
+		uint64_t stamp = (uint64_t)found.ftLastWriteTime.dwHighDateTime << 32 | found.ftLastWriteTime.dwLowDateTime;
+		if (!(found.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) && stamp >= newest_stamp)
+		{
+			newest = found.cFileName;
+			newest_stamp = stamp;
+		}
+	} while (FindNextFileA(search, &found));
+	FindClose(search);
+
+	std::string path = std::string(LIST_DIRECTORY) + "\\" + newest;
+	if (newest.empty() || newest_stamp == list.stamp)
+	{
+		return false;
+	}
+	list.stamp = newest_stamp; // A broken file is reported once, not on every poll
+
+	MappedRangeList *loaded = new MappedRangeList();
+	if (!loaded->Open(path.c_str()))
+	{
+		delete loaded;
+		std::cerr << "Keeping the current " << list.name << " list." << std::endl;
+		return false;
+	}
+	std::cout << "Loaded " << list.name << " list " << path << " with " << loaded->Matcher()->Size() << " ranges." << std::endl;
+	if (list.current != NULL)
+	{
+		retired.push_back(Retired{ list.current, MonotonicTicks() });
+	}
+	list.current = loaded;
+	list.path = path;
+	return true;
+}
+
+void ListReloader::ReleaseRetired(bool all)
+{
+	tick_t now = MonotonicTicks();
+	size_t kept = 0;
+	for (size_t i = 0; i < retired.size(); i++)
+	{
+		if (all || now - retired[i].since >= SECONDS_TO_TICKS(LIST_RETIRE_DELAY))
+		{
+			delete retired[i].list;
+		}
+		else
+		{
+			retired[kept++] = retired[i];
+		}
+	}
+	retired.resize(kept);
+}
+
+void ListReloader::Load()
+{
+	for (size_t i = 0; i < 2; i++)
+	{
+		Refresh(lists[i]);
+	}
+}
+
+void ListReloader::Run()
+{
+	for (;;)
+	{
+		{
+			std::unique_lock<std::mutex> lock(wake_lock);
+			wake.wait_for(lock, std::chrono::seconds(LIST_POLL_INTERVAL), [this]() { return !running.load(); });
+			if (!running.load())
+			{
+				break;
+			}
+		}
+
+		bool changed = false;
+		for (size_t i = 0; i < 2; i++)
+		{
+			changed |= Refresh(lists[i]);
+		}
+		if (changed)
+		{
+			lists_function(Blacklist(), Exceptions());
+		}
+		ReleaseRetired(false);
+	}
+}
+
+void ListReloader::Start(ListsFunction function)
+{
+	lists_function = function;
+	running = true;
+	watcher = std::thread(&ListReloader::Run, this);
+}
+
+void ListReloader::Stop()
+{
+	if (!watcher.joinable())
+	{
+		return;
+	}
+	{
+		std::lock_guard<std::mutex> lock(wake_lock);
+		running = false;
+	}
+	wake.notify_one();
+	watcher.join();
+}
@@ -0,0 +1,146 @@
+#pragma once
+// Data center and whitelist range lists loaded from memory-mapped files and replaced at runtime
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "cidr_matcher.h"
+#include "clock.h"
+
+#define LIST_DIRECTORY "lists"
+#define LIST_DATA_CENTERS "data_centers" // file name prefix, the newest lists\data_centers*.hxl is used
+#define LIST_WHITELIST "whitelist"
+#define LIST_POLL_INTERVAL 5 // seconds between checks for new files
+#define LIST_RETIRE_DELAY 10 // seconds a replaced list stays mapped for lookups still using it
+#define LIST_MAGIC 0x314C5848 // "HXL1", written by scripts/build_list.py
+#define LIST_VERSION 1
+
+struct ListHeader
+{
+	uint32_t magic;
+	uint16_t version;
+	uint16_t record_size;
+	uint32_t count; // ranges following the header
+	uint32_t reserved;
+};
+
+static_assert(sizeof(ListHeader) == 16, "ListHeader layout is part of the file format");
+static_assert(sizeof(CIDRRange) == 8, "CIDRRange layout is part of the file format");
+
+// Returns the ranges of a list file image, or NULL if it is not a sorted and disjoint list
+inline const CIDRRange *ValidateRangeList(const void *data, size_t size, size_t &count)
+{
+	if (size < sizeof(ListHeader))
+	{
+		return NULL;
+	}
+	const ListHeader *header = (const ListHeader*)data;
+	if (header->magic != LIST_MAGIC || header->version != LIST_VERSION || header->record_size != sizeof(CIDRRange) ||
+		(size - sizeof(ListHeader)) / sizeof(CIDRRange) != header->count || (size - sizeof(ListHeader)) % sizeof(CIDRRange) != 0)
+	{
+		return NULL;
+	}
+	const CIDRRange *ranges = (const CIDRRange*)(header + 1);
+	for (size_t i = 0; i < header->count; i++)
+	{
+		if (ranges[i].start > ranges[i].end || (i != 0 && ranges[i - 1].end >= ranges[i].start))
+		{
+			return NULL;
+		}
+	}
+	count = header->count;
+	return ranges;
+}
+
+// Read-only view of a list file, lookups search the mapped ranges in place
+class MappedRangeList
+{
+private:
+	void *file;
+	void *mapping;
+	const void *view;
+	CIDRRangeMatcher matcher;
+
+public:
+	MappedRangeList();
+	~MappedRangeList();
+
+	MappedRangeList(const MappedRangeList&) = delete;
+	MappedRangeList &operator=(const MappedRangeList&) = delete;
+
+	bool Open(const char *path);
+
+	const CIDRMatcher *Matcher() const
+	{
+		return &matcher;
+	}
+};
+
+typedef void(*ListsFunction)(const CIDRMatcher *blacklist, const CIDRMatcher *exceptions);
+
+// Watches LIST_DIRECTORY for newer list files. A new file is mapped and validated on the
+// watcher thread while the current list keeps serving lookups, then handed to the lists
+// function. Files are never modified in place: drop a new file under a temporary name
+// and rename it to <prefix>-<version>.hxl once it is complete.
+class ListReloader
+{
+private:
+	struct List
+	{
+		const char *prefix; // NULL if the list is not used
+		const CIDRMatcher *fallback; // compiled into the binary
+		const char *name; // for messages
+		std::string path; // file currently mapped, empty for the fallback
+		uint64_t stamp; // last write time of the newest file seen
+		MappedRangeList *current;
+	};
+
+	struct Retired
+	{
+		MappedRangeList *list;
+		tick_t since;
+	};
+
+	List lists[2]; // blacklist, exceptions
+	std::vector<Retired> retired;
+	ListsFunction lists_function;
+	std::thread watcher;
+	std::mutex wake_lock;
+	std::condition_variable wake;
+	std::atomic<bool> running;
+
+	// Maps the newest file of the list if it changed, returns true when the list was replaced
+	bool Refresh(List &list);
+	void ReleaseRetired(bool all);
+	void Run();
+
+public:
+	ListReloader(const char *blacklist_prefix, const CIDRMatcher *blacklist_fallback,
+		const char *exceptions_prefix, const CIDRMatcher *exceptions_fallback);
+	~ListReloader();
+
+	ListReloader(const ListReloader&) = delete;
+	ListReloader &operator=(const ListReloader&) = delete;
+
+	// Loads the current files, lists without a file use the compiled-in fallback
+	void Load();
+
+	const CIDRMatcher *Blacklist() const
+	{
+		return lists[0].current != NULL ? lists[0].current->Matcher() : lists[0].fallback;
+	}
+
+	const CIDRMatcher *Exceptions() const
+	{
+		return lists[1].current != NULL ? lists[1].current->Matcher() : lists[1].fallback;
+	}
+
+	// Starts watching, the lists function is called on the watcher thread after every change
+	void Start(ListsFunction function);
+
+	void Stop();
+};
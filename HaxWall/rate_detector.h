@@ -0,0 +1,144 @@
+#pragma once
+// Flood detection strategies, selected with RATE_DETECTOR in ban.h.
+// Each keeps a few bytes per client and reports when a client sends more than
+// MaxPackets() packets within PacketFrame() of the policy, see policy.h. Timestamps
+// are clock ticks, only their differences are used so 32-bit wraparound is harmless.
+
+#include <cstdint>
+#include "clock.h"
+
+#define MAX_PACKET_FRAME_TICKS ((uint32_t)SECONDS_TO_TICKS(MAX_PACKET_FRAME))
+
+// Bucket of MaxPackets() tokens refilled at MaxPackets() per frame. One packet costs
+// PacketFrame() units and every tick refills MaxPackets() units, which keeps the
+// arithmetic exact without divisions.
+class TokenBucketDetector
+{
+private:
+	uint32_t tokens;
+	uint32_t last;
+
+public:
+	// The first packet is counted by Reset
+	template <typename Policy>
+	void Reset(tick_t now, const Policy &policy)
+	{
+		tokens = (policy.MaxPackets() - 1) * policy.PacketFrame();
+		last = (uint32_t)now;
+	}
+
+	// Counts one packet, returns true when the client exceeded the limit
+	template <typename Policy>
+	bool Count(tick_t now, const Policy &policy)
+	{
+		uint32_t elapsed = (uint32_t)now - last;
+		last = (uint32_t)now;
+		if (elapsed >= policy.PacketFrame())
+		{
+			tokens = policy.MaxPackets() * policy.PacketFrame();
+		}
+		else
+		{
+			tokens += elapsed * policy.MaxPackets();
+			if (tokens > policy.MaxPackets() * policy.PacketFrame())
+			{
+				tokens = policy.MaxPackets() * policy.PacketFrame();
+			}
+		}
+
+		if (tokens < policy.PacketFrame())
+		{
+			return true;
+		}
+		tokens -= policy.PacketFrame();
+		return false;
+	}
+};
+
+// Counters for the current and previous frame; the previous frame is weighted by
+// how much of it still overlaps the sliding window ending now.
+class SlidingWindowDetector
+{
+private:
+	uint32_t window_start;
+	uint16_t previous;
+	uint16_t current;
+
+public:
+	template <typename Policy>
+	void Reset(tick_t now, const Policy &policy)
+	{
+		window_start = (uint32_t)now;
+		previous = 0;
+		current = 1;
+	}
+
+	template <typename Policy>
+	bool Count(tick_t now, const Policy &policy)
+	{
+		uint32_t frame = policy.PacketFrame();
+		uint32_t elapsed = (uint32_t)now - window_start;
+		if (elapsed >= 2 * frame)
+		{
+			window_start = (uint32_t)now;
+			previous = 0;
+			current = 0;
+			elapsed = 0;
+		}
+		else if (elapsed >= frame)
+		{
+			window_start += frame;
+			previous = current;
+			current = 0;
+			elapsed -= frame;
+		}
+		if (current < 0xFFFF)
+		{
+			current++;
+		}
+
+		uint64_t weighted = (uint64_t)previous * (frame - elapsed) + (uint64_t)current * frame;
+		return weighted > (uint64_t)policy.MaxPackets() * frame;
+	}
+};
+
+// Original strategy: ring of the last MAX_PACKETS timestamps, 4 bytes per tracked packet.
+// Policies allowing more packets are limited to MAX_PACKETS.
+class TimestampRingDetector
+{
+private:
+	uint32_t times[MAX_PACKETS];
+	uint32_t packet_count;
+	uint32_t last_time;
+
+public:
+	template <typename Policy>
+	void Reset(tick_t now, const Policy &policy)
+	{
+		packet_count = 1;
+		last_time = 0;
+		times[last_time] = (uint32_t)now;
+	}
+
+	template <typename Policy>
+	bool Count(tick_t now, const Policy &policy)
+	{
+		uint32_t size = policy.MaxPackets() < MAX_PACKETS ? policy.MaxPackets() : MAX_PACKETS;
+		if (packet_count <= size)
+		{
+			packet_count++;
+		}
+		if (++last_time >= size)
+		{
+			last_time = 0;
+		}
+		times[last_time] = (uint32_t)now;
+
+		uint32_t first_time = last_time + 1;
+		if (first_time >= size)
+		{
+			first_time = 0;
+		}
+		return packet_count > size && times[last_time] - times[first_time] < policy.PacketFrame();
+	}
+};
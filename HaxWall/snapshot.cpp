@@ -0,0 +1,68 @@
+// Ban and client state saved on shutdown and at intervals, loaded again on the next start
+
+#include "stdafx.h"
+#include "snapshot.h"
+#include <Windows.h>
+#include <chrono>
+#include <iostream>
+#include <string>
+
+static uint64_t SnapshotTime()
+{
+	return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+bool SaveSnapshot(const char *path, const std::vector<SnapshotBan> &bans, const std::vector<SnapshotBan6> &bans6,
+	const std::vector<SnapshotClient> &clients)
+{
+	std::vector<char> data;
+	EncodeSnapshot(bans, bans6, clients, SnapshotTime(), data);
+
+	// Written next to the snapshot, then moved over it
+	std::string temporary = std::string(path) + ".tmp";
+	HANDLE file = CreateFileA(temporary.c_str(), GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		std::cerr << "Failed to create snapshot " << temporary << ": " << GetLastError() << std::endl;
+		return false;
+	}
+	DWORD written = 0;
+	bool complete = WriteFile(file, data.data(), (DWORD)data.size(), &written, NULL) && written == data.size() && FlushFileBuffers(file);
+	CloseHandle(file);
+	if (!complete || !MoveFileExA(temporary.c_str(), path, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+	{
+		std::cerr << "Failed to write snapshot " << path << ": " << GetLastError() << std::endl;
+		DeleteFileA(temporary.c_str());
+		return false;
+	}
+	return true;
+}
+
+bool LoadSnapshot(const char *path, uint32_t timeout, std::vector<SnapshotBan> &bans, std::vector<SnapshotBan6> &bans6,
+	std::vector<SnapshotClient> &clients)
+{
+	HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		return false; // first start
+	}
+	LARGE_INTEGER size;
+	std::vector<char> data;
+	DWORD read = 0;
+	bool complete = GetFileSizeEx(file, &size) && size.QuadPart < 0x7FFFFFFF;
+	if (complete)
+	{
+		data.resize((size_t)size.QuadPart);
+		complete = ReadFile(file, data.data(), (DWORD)data.size(), &read, NULL) && read == data.size();
+	}
+	CloseHandle(file);
+	if (!complete || !DecodeSnapshot(data.data(), data.size(), SnapshotTime(), timeout, bans, bans6, clients))
+	{
+		std::cerr << "Ignoring the damaged snapshot " << path << "." << std::endl;
+		bans.clear();
+		bans6.clear();
+		clients.clear();
+		return false;
+	}
+	return true;
+}
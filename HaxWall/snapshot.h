@@ -0,0 +1,165 @@
+#pragma once
+// Ban and client state saved on shutdown and at intervals, loaded again on the next start
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include "journal.h"
+
+#define SNAPSHOT_PATH "firewall.snapshot"
+#define SNAPSHOT_INTERVAL 30 // seconds between periodic snapshots
+#define SNAPSHOT_MAGIC 0x31535848 // "HXS1"
+#define SNAPSHOT_VERSION 2
+#define SNAPSHOT_CLIENT_PORTS 3 // source ports kept per client
+
+// Remaining ban time when the snapshot was taken
+struct SnapshotBan
+{
+	uint32_t addr;
+	uint32_t remaining; // milliseconds
+	BanReason reason;
+	uint8_t reserved[3];
+};
+
+static_assert(sizeof(SnapshotBan) == 12, "SnapshotBan layout is part of the file format");
+
+// Same as SnapshotBan for an IPv6 network, keyed like the firewall by its upper half
+struct SnapshotBan6
+{
+	uint64_t network;
+	uint32_t remaining; // milliseconds
+	BanReason reason;
+	uint8_t reserved[3];
+};
+
+static_assert(sizeof(SnapshotBan6) == 16, "SnapshotBan6 layout is part of the file format");
+
+// Active client, restored with a fresh rate limit
+struct SnapshotClient
+{
+	uint32_t addr;
+	uint32_t idle; // milliseconds since its last packet
+	uint16_t dport; // selects the policy profile
+	uint8_t port_count;
+	uint8_t reserved[3];
+	uint16_t ports[SNAPSHOT_CLIENT_PORTS];
+};
+
+static_assert(sizeof(SnapshotClient) == 20, "SnapshotClient layout is part of the file format");
+
+// Bans follow the header, then the clients and the IPv6 bans. Files written before the
+// IPv6 bans were saved hold zero in their count and size.
+struct SnapshotHeader
+{
+	uint32_t magic;
+	uint16_t version;
+	uint8_t ban_size;
+	uint8_t client_size;
+	uint32_t ban_count;
+	uint32_t client_count;
+	uint64_t saved; // milliseconds since the Unix epoch
+	uint32_t ban6_count;
+	uint8_t ban6_size;
+	uint8_t reserved[3];
+};
+
+static_assert(sizeof(SnapshotHeader) == 32, "SnapshotHeader layout is part of the file format");
+
+inline void EncodeSnapshot(const std::vector<SnapshotBan> &bans, const std::vector<SnapshotBan6> &bans6,
+	const std::vector<SnapshotClient> &clients, uint64_t saved, std::vector<char> &out)
+{
+	SnapshotHeader header = {};
+	header.magic = SNAPSHOT_MAGIC;
+	header.version = SNAPSHOT_VERSION;
+	header.ban_size = sizeof(SnapshotBan);
+	header.client_size = sizeof(SnapshotClient);
+	header.ban_count = (uint32_t)bans.size();
+	header.client_count = (uint32_t)clients.size();
+	header.saved = saved;
+	header.ban6_count = (uint32_t)bans6.size();
+	header.ban6_size = sizeof(SnapshotBan6);
+	size_t clients_offset = sizeof(header) + bans.size() * sizeof(SnapshotBan);
+	size_t bans6_offset = clients_offset + clients.size() * sizeof(SnapshotClient);
+	out.resize(bans6_offset + bans6.size() * sizeof(SnapshotBan6));
+	memcpy(out.data(), &header, sizeof(header));
+	if (!bans.empty())
+	{
+		memcpy(out.data() + sizeof(header), bans.data(), bans.size() * sizeof(SnapshotBan));
+	}
+	if (!clients.empty())
+	{
+		memcpy(out.data() + clients_offset, clients.data(), clients.size() * sizeof(SnapshotClient));
+	}
+	if (!bans6.empty())
+	{
+		memcpy(out.data() + bans6_offset, bans6.data(), bans6.size() * sizeof(SnapshotBan6));
+	}
+}
+
+// Returns false for a damaged or foreign file. Records are aged by the time the firewall
+// was down, bans that ran out and clients idle for longer than timeout are dropped.
+inline bool DecodeSnapshot(const char *data, size_t size, uint64_t loaded, uint32_t timeout,
+	std::vector<SnapshotBan> &bans, std::vector<SnapshotBan6> &bans6, std::vector<SnapshotClient> &clients)
+{
+	SnapshotHeader header;
+	if (size < sizeof(header))
+	{
+		return false;
+	}
+	memcpy(&header, data, sizeof(header));
+	if (header.magic != SNAPSHOT_MAGIC || header.version != SNAPSHOT_VERSION ||
+		header.ban_size != sizeof(SnapshotBan) || header.client_size != sizeof(SnapshotClient) ||
+		(header.ban6_count != 0 && header.ban6_size != sizeof(SnapshotBan6)) ||
+		size != sizeof(header) + (uint64_t)header.ban_count * sizeof(SnapshotBan) + (uint64_t)header.client_count * sizeof(SnapshotClient) +
+		(uint64_t)header.ban6_count * sizeof(SnapshotBan6))
+	{
+		return false;
+	}
+
+	// A clock set backwards counts as no downtime
+	uint64_t down = loaded > header.saved ? loaded - header.saved : 0;
+	const char *records = data + sizeof(header);
+	for (uint32_t i = 0; i < header.ban_count; i++, records += sizeof(SnapshotBan))
+	{
+		SnapshotBan ban;
+		memcpy(&ban, records, sizeof(ban));
+		if (ban.remaining > down)
+		{
+			ban.remaining -= (uint32_t)down;
+			bans.push_back(ban);
+		}
+	}
+	for (uint32_t i = 0; i < header.client_count; i++, records += sizeof(SnapshotClient))
+	{
+		SnapshotClient client;
+		memcpy(&client, records, sizeof(client));
+		if (client.port_count == 0 || client.port_count > SNAPSHOT_CLIENT_PORTS)
+		{
+			return false;
+		}
+		if (client.idle + down < timeout)
+		{
+			client.idle += (uint32_t)down;
+			clients.push_back(client);
+		}
+	}
+	for (uint32_t i = 0; i < header.ban6_count; i++, records += sizeof(SnapshotBan6))
+	{
+		SnapshotBan6 ban;
+		memcpy(&ban, records, sizeof(ban));
+		if (ban.remaining > down)
+		{
+			ban.remaining -= (uint32_t)down;
+			bans6.push_back(ban);
+		}
+	}
+	return true;
+}
+
+// Replaces the file atomically, a crash while saving leaves the previous snapshot
+bool SaveSnapshot(const char *path, const std::vector<SnapshotBan> &bans, const std::vector<SnapshotBan6> &bans6,
+	const std::vector<SnapshotClient> &clients);
+
+// Returns false if there is no usable snapshot
+bool LoadSnapshot(const char *path, uint32_t timeout, std::vector<SnapshotBan> &bans, std::vector<SnapshotBan6> &bans6,
+	std::vector<SnapshotClient> &clients);
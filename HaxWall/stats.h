@@ -0,0 +1,203 @@
+#pragma once
+// Lock-free counters for throughput, drop reasons, bans and latencies
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+
+#define STATS_MAX_THREADS 64 // threads with a private counter block, later threads share the last one
+#define STATS_HISTOGRAM_BUCKETS 24 // powers of two of microseconds, the last bucket collects the rest
+
+enum class Stat : uint8_t {
+	PacketsReceived,
+	FilteredProtocol, // not UDP, truncated or malformed
+	FilteredFragment, // later fragments of a datagram, only the first one carries the ports
+	FilteredPort, // low ports, RDP or outside the game port range
+	FilteredSpecial, // reserved and private addresses
+	NewSources,
+	BansBlacklist,
+	BansMultiport,
+	BansFlood,
+	Unbans,
+	BannedPackets, // packets of sources that are banned already
+	BansLimited, // blacklisted sources not banned because their shard holds MAX_BANS bans
+	VerdictCacheHits, // blacklist and exception lookups answered by the verdict cache
+	VerdictCacheMisses,
+	Evictions, // tracked sources dropped at MAX_CLIENTS
+	FloodModes, // times flood mode started
+	FloodUntracked, // unknown sources not tracked in flood mode
+	FloodAdmitted, // untracked sources admitted by a verification query
+	VerificationQueries, // addresses looked up by the verification service
+	Count
+};
+
+enum class StatHistogram : uint8_t {
+	FilterLatency, // packet filter transaction per ban batch
+	PurgeDuration, // timer wheel advance over all shards
+	Count
+};
+
+// Every thread increments its own cache line without atomic read-modify-write;
+// readers sum the blocks, so values are eventually consistent but never torn.
+class Statistics
+{
+private:
+	struct alignas(64) Block
+	{
+		std::atomic<uint64_t> values[(size_t)Stat::Count];
+	};
+
+	Block blocks[STATS_MAX_THREADS];
+	std::atomic<size_t> threads;
+	std::atomic<uint64_t> histograms[(size_t)StatHistogram::Count][STATS_HISTOGRAM_BUCKETS];
+
+	Block &Local(bool &shared)
+	{
+		thread_local Statistics *owner = NULL;
+		thread_local Block *block = NULL;
+		thread_local bool block_shared = false;
+		if (owner != this)
+		{
+			size_t index = threads++;
+			block_shared = index >= STATS_MAX_THREADS - 1;
+			block = &blocks[block_shared ? STATS_MAX_THREADS - 1 : index];
+			owner = this;
+		}
+		shared = block_shared;
+		return *block;
+	}
+
+	static const char *Name(Stat stat)
+	{
+		static const char *names[] = { "packets_received", "filtered_protocol", "filtered_fragment", "filtered_port", "filtered_special",
+			"new_sources", "bans_blacklist", "bans_multiport", "bans_flood", "unbans", "banned_packets", "bans_limited",
+			"verdict_cache_hits", "verdict_cache_misses", "evictions", "flood_modes", "flood_untracked", "flood_admitted",
+			"verification_queries" };
+		static_assert(sizeof(names) / sizeof(names[0]) == (size_t)Stat::Count, "Stat names out of date");
+		return names[(size_t)stat];
+	}
+
+	static const char *Name(StatHistogram histogram)
+	{
+		static const char *names[] = { "filter_latency_us", "purge_duration_us" };
+		static_assert(sizeof(names) / sizeof(names[0]) == (size_t)StatHistogram::Count, "Histogram names out of date");
+		return names[(size_t)histogram];
+	}
+
+	// Upper bound of the bucket holding the given fraction of samples
+	uint64_t Percentile(StatHistogram histogram, double fraction) const
+	{
+		uint64_t total = 0;
+		for (size_t i = 0; i < STATS_HISTOGRAM_BUCKETS; i++)
+		{
+			total += histograms[(size_t)histogram][i].load(std::memory_order_relaxed);
+		}
+		uint64_t seen = 0;
+		for (size_t i = 0; i < STATS_HISTOGRAM_BUCKETS; i++)
+		{
+			seen += histograms[(size_t)histogram][i].load(std::memory_order_relaxed);
+			if (total != 0 && seen >= total * fraction)
+			{
+				return (uint64_t)1 << i;
+			}
+		}
+		return 0;
+	}
+
+public:
+	Statistics() : threads(0)
+	{
+		for (size_t i = 0; i < STATS_MAX_THREADS; i++)
+		{
+			for (size_t j = 0; j < (size_t)Stat::Count; j++)
+			{
+				blocks[i].values[j].store(0, std::memory_order_relaxed);
+			}
+		}
+		for (size_t i = 0; i < (size_t)StatHistogram::Count; i++)
+		{
+			for (size_t j = 0; j < STATS_HISTOGRAM_BUCKETS; j++)
+			{
+				histograms[i][j].store(0, std::memory_order_relaxed);
+			}
+		}
+	}
+
+	Statistics(const Statistics&) = delete;
+	Statistics &operator=(const Statistics&) = delete;
+
+	void Add(Stat stat, uint64_t count = 1)
+	{
+		bool shared;
+		std::atomic<uint64_t> &value = Local(shared).values[(size_t)stat];
+		if (shared)
+		{
+			value.fetch_add(count, std::memory_order_relaxed);
+		}
+		else
+		{
+			value.store(value.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
+		}
+	}
+
+	void Record(StatHistogram histogram, uint64_t microseconds)
+	{
+		size_t bucket = 0;
+		while (bucket < STATS_HISTOGRAM_BUCKETS - 1 && ((uint64_t)1 << bucket) < microseconds)
+		{
+			bucket++;
+		}
+		histograms[(size_t)histogram][bucket].fetch_add(1, std::memory_order_relaxed);
+	}
+
+	uint64_t Get(Stat stat) const
+	{
+		uint64_t total = 0;
+		for (size_t i = 0; i < STATS_MAX_THREADS; i++)
+		{
+			total += blocks[i].values[(size_t)stat].load(std::memory_order_relaxed);
+		}
+		return total;
+	}
+
+	// One "name value" line per counter and p50/p99/max per histogram
+	void Write(std::ostream &out) const
+	{
+		for (size_t i = 0; i < (size_t)Stat::Count; i++)
+		{
+			out << Name((Stat)i) << " " << Get((Stat)i) << "\n";
+		}
+		for (size_t i = 0; i < (size_t)StatHistogram::Count; i++)
+		{
+			StatHistogram histogram = (StatHistogram)i;
+			out << Name(histogram) << " p50 " << Percentile(histogram, 0.5) << " p99 " << Percentile(histogram, 0.99)
+				<< " max " << Percentile(histogram, 1.0) << "\n";
+		}
+	}
+};
+
+inline Statistics &GlobalStatistics()
+{
+	static Statistics statistics;
+	return statistics;
+}
+
+// Records the lifetime of the scope into a histogram
+class StatTimer
+{
+private:
+	StatHistogram histogram;
+	std::chrono::steady_clock::time_point start;
+
+public:
+	StatTimer(StatHistogram which) : histogram(which), start(std::chrono::steady_clock::now())
+	{
+	}
+
+	~StatTimer()
+	{
+		auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+		GlobalStatistics().Record(histogram, elapsed.count());
+	}
+};
@@ -0,0 +1,86 @@
+#pragma once
+// Hashed timing wheel used for client timeouts and ban expiry
+
+#include <cstddef>
+#include <vector>
+#include "clock.h"
+
+// Each bucket covers one resolution interval. Deadlines beyond one revolution stay in
+// their bucket until the wheel comes around again, so advancing only touches the
+// buckets that elapsed and the timers stored in them.
+// Timers cannot be cancelled; owners compare the deadline when it fires instead.
+template <typename Key>
+class TimerWheel
+{
+private:
+	struct Timer
+	{
+		Key key;
+		tick_t deadline;
+	};
+
+	std::vector<std::vector<Timer>> buckets;
+	std::vector<Timer> due;
+	tick_t resolution;
+	tick_t position; // interval of the oldest bucket that may still hold due timers
+
+public:
+	TimerWheel(size_t slots, tick_t bucket_ticks, tick_t start) : buckets(slots), resolution(bucket_ticks), position(start / bucket_ticks)
+	{
+	}
+
+	void Schedule(Key key, tick_t deadline)
+	{
+		tick_t interval = deadline / resolution;
+		if (interval < position)
+		{
+			interval = position; // Already due, fire with the next bucket
+		}
+		Timer timer = { key, deadline };
+		buckets[interval % buckets.size()].push_back(timer);
+	}
+
+	// Calls expire(key, deadline) for every timer whose deadline has passed.
+	// expire may schedule new timers.
+	template <typename Function>
+	void Advance(tick_t now, Function expire)
+	{
+		tick_t target = now / resolution;
+		if (target < position)
+		{
+			return;
+		}
+
+		// Visit each bucket at most once, even after a long pause
+		tick_t steps = target - position + 1;
+		if (steps > buckets.size())
+		{
+			steps = buckets.size();
+		}
+		for (tick_t i = 0; i < steps; i++)
+		{
+			std::vector<Timer> &bucket = buckets[(position + i) % buckets.size()];
+			size_t kept = 0;
+			for (size_t j = 0; j < bucket.size(); j++)
+			{
+				if (bucket[j].deadline <= now)
+				{
+					due.push_back(bucket[j]);
+				}
+				else
+				{
+					bucket[kept++] = bucket[j];
+				}
+			}
+			bucket.resize(kept);
+		}
+		position = target; // The current bucket may still receive timers due later in its interval
+
+		// Fire after the buckets are consistent so that expire can reschedule
+		for (size_t j = 0; j < due.size(); j++)
+		{
+			expire(due[j].key, due[j].deadline);
+		}
+		due.clear();
+	}
+};
@@ -0,0 +1,76 @@
+#pragma once
+// Direct-mapped cache of blacklist and exception verdicts per source address
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#define VERDICT_CACHE_BITS 15 // 2^15 slots of 8 bytes, 256 KB
+
+enum VerdictFlags : uint8_t {
+	VerdictBlacklisted = 1,
+	VerdictException = 2
+};
+
+// Every slot is one 64-bit word holding the address, the generation it was computed in
+// and the verdict, so concurrent lookups and stores need no lock and never see a torn
+// entry. Bumping the generation when the lists change invalidates all slots at once.
+class VerdictCache
+{
+private:
+	static const int GENERATION_SHIFT = 32;
+	static const int FLAGS_SHIFT = 62;
+	static const uint64_t GENERATION_MASK = ((uint64_t)1 << (FLAGS_SHIFT - GENERATION_SHIFT)) - 1;
+
+	std::vector<std::atomic<uint64_t>> slots;
+	std::atomic<uint32_t> generation;
+
+	static size_t Slot(uint32_t addr)
+	{
+		return (uint32_t)(addr * 2654435761u) >> (32 - VERDICT_CACHE_BITS);
+	}
+
+public:
+	VerdictCache() : slots((size_t)1 << VERDICT_CACHE_BITS), generation(1)
+	{
+		for (size_t i = 0; i < slots.size(); i++)
+		{
+			slots[i].store(0, std::memory_order_relaxed); // generation 0 is never current
+		}
+	}
+
+	VerdictCache(const VerdictCache&) = delete;
+	VerdictCache &operator=(const VerdictCache&) = delete;
+
+	// Returns false on a miss
+	bool Lookup(uint32_t addr, uint8_t &flags) const
+	{
+		uint64_t entry = slots[Slot(addr)].load(std::memory_order_relaxed);
+		if ((uint32_t)entry != addr || ((entry >> GENERATION_SHIFT) & GENERATION_MASK) != generation.load(std::memory_order_relaxed))
+		{
+			return false;
+		}
+		flags = (uint8_t)(entry >> FLAGS_SHIFT);
+		return true;
+	}
+
+	// A verdict racing with Invalidate() is stored under the generation it was computed in
+	void Store(uint32_t addr, uint8_t flags, uint32_t computed)
+	{
+		slots[Slot(addr)].store((uint64_t)addr | ((uint64_t)computed & GENERATION_MASK) << GENERATION_SHIFT |
+			(uint64_t)flags << FLAGS_SHIFT, std::memory_order_relaxed);
+	}
+
+	// Read before consulting the lists, pass the value to Store()
+	uint32_t Generation() const
+	{
+		return generation.load(std::memory_order_acquire);
+	}
+
+	void Invalidate()
+	{
+		uint32_t next = (generation.load(std::memory_order_relaxed) + 1) & GENERATION_MASK;
+		generation.store(next != 0 ? next : 1, std::memory_order_release);
+	}
+};
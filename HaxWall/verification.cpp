@@ -0,0 +1,123 @@
+// Loopback verification service: tells the room bot whether a joining player's address sent packets
+
+#include "stdafx.h"
+#include "verification.h"
+#include <iostream>
+#include <sstream>
+#include <string>
+
+VerificationService::VerificationService(AttackFirewall &firewall, QueryFunction query, StatsFunction stats)
+	: firewall(firewall), query_function(query), stats_function(stats), sock(INVALID_SOCKET), running(false)
+{
+}
+
+VerificationService::~VerificationService()
+{
+	Stop();
+}
+
+bool VerificationService::Lookup(uint32_t addr, uint32_t &idle)
+{
+	// Only proves activity, the firewall decides about everything else
+	tick_t ticks = 0;
+	bool result = firewall.Verify(addr, TIMEOUT, &ticks);
+	idle = (uint32_t)(ticks * 1000 / TICKS_PER_SECOND);
+	GlobalStatistics().Add(Stat::VerificationQueries);
+	if (query_function != NULL)
+	{
+		query_function(addr, result);
+	}
+	return result;
+}
+
+void VerificationService::Run()
+{
+	unsigned char request[VerificationHeader::SIZE + VERIFICATION_MAX_ADDRESSES * 4];
+	unsigned char reply[VerificationHeader::SIZE + (VERIFICATION_MAX_ADDRESSES + 7) / 8 + VERIFICATION_MAX_ADDRESSES * 4];
+	struct sockaddr_in receiver;
+	int receiver_len;
+	while (running.load())
+	{
+		receiver_len = sizeof(receiver);
+		int count = recvfrom(sock, (char*)request, sizeof(request), 0, (struct sockaddr*)&receiver, &receiver_len);
+		if (count == SOCKET_ERROR)
+		{
+			int error = WSAGetLastError();
+			if (error == WSAECONNRESET || error == WSAEMSGSIZE) // previous reply was not delivered, request too large
+			{
+				continue;
+			}
+			if (running.load())
+			{
+				std::cerr << "Error: Verification service failed. " << error << std::endl;
+			}
+			break;
+		}
+
+		if (count == 1 && request[0] == VERIFICATION_OPCODE_STATS && stats_function != NULL)
+		{
+			// Not logged, monitoring polls this
+			std::ostringstream report;
+			stats_function(report);
+			std::string text = report.str();
+			sendto(sock, text.data(), (int)text.size(), 0, (struct sockaddr*)&receiver, receiver_len);
+		}
+		else if (count == 4)
+		{
+			// Original protocol, one address and a 1 byte reply
+			uint32_t idle;
+			reply[0] = Lookup(LoadBig32(request), idle) ? 1 : 0;
+			sendto(sock, (char*)reply, 1, 0, (struct sockaddr*)&receiver, receiver_len);
+		}
+		else
+		{
+			size_t size = AnswerVerification(request, (size_t)count, reply, [this](uint32_t addr, uint32_t &idle)
+			{
+				return Lookup(addr, idle);
+			});
+			if (size != 0)
+			{
+				sendto(sock, (char*)reply, (int)size, 0, (struct sockaddr*)&receiver, receiver_len);
+			}
+		}
+	}
+}
+
+bool VerificationService::Start(uint16_t port)
+{
+	sock = socket(AF_INET, SOCK_DGRAM, 0);
+	if (sock == INVALID_SOCKET)
+	{
+		std::cerr << "Failed to start verification service." << std::endl;
+		return false;
+	}
+	struct sockaddr_in addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	addr.sin_port = htons(port);
+	if (bind(sock, (struct sockaddr*)&addr, sizeof(addr)) == SOCKET_ERROR)
+	{
+		std::cerr << "Failed to bind to verification service: " << WSAGetLastError() << std::endl;
+		closesocket(sock);
+		sock = INVALID_SOCKET;
+		return false;
+	}
+	running = true;
+	thread = std::thread(&VerificationService::Run, this);
+	return true;
+}
+
+void VerificationService::Stop()
+{
+	running = false;
+	if (sock != INVALID_SOCKET)
+	{
+		closesocket(sock); // wakes up the blocking receive
+		sock = INVALID_SOCKET;
+	}
+	if (thread.joinable())
+	{
+		thread.join();
+	}
+}
@@ -0,0 +1,152 @@
+#pragma once
+// Loopback verification service: tells the room bot whether a joining player's address sent packets
+
+#include <Winsock2.h>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <thread>
+#include "ban.h"
+#include "packet_view.h"
+
+#define VERIFICATION_VERSION 1
+#define VERIFICATION_OPCODE_QUERY 'Q'
+#define VERIFICATION_OPCODE_STATS 'S' // single byte query, answered with the statistics as text
+#define VERIFICATION_MAX_ADDRESSES 256 // addresses per batched query
+#define VERIFICATION_IDLE_UNKNOWN 0xFFFFFFFF // idle time of an inactive address
+
+// Batched query, all fields in network order:
+//   request  "HV" version opcode id:16 count:16, then count IPv4 addresses
+//   reply    "HV" version opcode id:16 count:16, then a bitmap of the active addresses
+//            (first address in the lowest bit of the first byte), then count idle times
+//            in milliseconds, VERIFICATION_IDLE_UNKNOWN for inactive addresses
+// A request of another version is answered with a header of this version and no addresses.
+// The original 4 byte query with its 1 byte reply is still answered.
+struct VerificationHeader
+{
+	static const size_t SIZE = 8;
+
+	uint8_t version;
+	uint8_t opcode;
+	uint16_t id; // chosen by the client to match replies
+	uint16_t count;
+};
+
+inline size_t VerificationReplySize(uint16_t count)
+{
+	return VerificationHeader::SIZE + (count + 7) / 8 + (size_t)count * 4;
+}
+
+inline void StoreBig16(unsigned char *p, uint16_t value)
+{
+	p[0] = (unsigned char)(value >> 8);
+	p[1] = (unsigned char)value;
+}
+
+inline void StoreBig32(unsigned char *p, uint32_t value)
+{
+	StoreBig16(p, (uint16_t)(value >> 16));
+	StoreBig16(p + 2, (uint16_t)value);
+}
+
+// Returns false for datagrams that are not a batched request
+inline bool DecodeVerificationHeader(const unsigned char *data, size_t size, VerificationHeader &header)
+{
+	if (size < VerificationHeader::SIZE || data[0] != 'H' || data[1] != 'V')
+	{
+		return false;
+	}
+	header.version = data[2];
+	header.opcode = data[3];
+	header.id = LoadBig16(data + 4);
+	header.count = LoadBig16(data + 6);
+	return true;
+}
+
+inline void EncodeVerificationHeader(const VerificationHeader &header, unsigned char *data)
+{
+	data[0] = 'H';
+	data[1] = 'V';
+	data[2] = header.version;
+	data[3] = header.opcode;
+	StoreBig16(data + 4, header.id);
+	StoreBig16(data + 6, header.count);
+}
+
+// Writes the reply to a batched request into reply, which needs room for
+// VerificationReplySize(VERIFICATION_MAX_ADDRESSES). lookup(addr, idle) returns whether
+// the address is active and sets its idle time in milliseconds. Returns the reply size,
+// 0 if the request is malformed and not answered.
+template <typename Lookup>
+size_t AnswerVerification(const unsigned char *request, size_t size, unsigned char *reply, Lookup lookup)
+{
+	VerificationHeader header;
+	if (!DecodeVerificationHeader(request, size, header))
+	{
+		return 0;
+	}
+	if (header.version != VERIFICATION_VERSION)
+	{
+		header.version = VERIFICATION_VERSION;
+		header.count = 0;
+		EncodeVerificationHeader(header, reply);
+		return VerificationHeader::SIZE;
+	}
+	if (header.opcode != VERIFICATION_OPCODE_QUERY || header.count > VERIFICATION_MAX_ADDRESSES ||
+		size != VerificationHeader::SIZE + (size_t)header.count * 4)
+	{
+		return 0;
+	}
+
+	EncodeVerificationHeader(header, reply);
+	unsigned char *bitmap = reply + VerificationHeader::SIZE;
+	unsigned char *idle_times = bitmap + (header.count + 7) / 8;
+	memset(bitmap, 0, (header.count + 7) / 8);
+	for (uint16_t i = 0; i < header.count; i++)
+	{
+		uint32_t idle = VERIFICATION_IDLE_UNKNOWN;
+		if (lookup(LoadBig32(request + VerificationHeader::SIZE + (size_t)i * 4), idle))
+		{
+			bitmap[i / 8] |= (unsigned char)(1 << (i % 8));
+		}
+		else
+		{
+			idle = VERIFICATION_IDLE_UNKNOWN;
+		}
+		StoreBig32(idle_times + (size_t)i * 4, idle);
+	}
+	return VerificationReplySize(header.count);
+}
+
+typedef void(*QueryFunction)(uint32_t addr, bool active);
+typedef void(*StatsFunction)(std::ostream &out);
+
+// Answers queries on its own thread, off the capture threads. Every address is looked up
+// in its shard under one short lock, which also admits new players in flood mode.
+class VerificationService
+{
+private:
+	AttackFirewall &firewall;
+	QueryFunction query_function;
+	StatsFunction stats_function;
+	SOCKET sock;
+	std::thread thread;
+	std::atomic<bool> running;
+
+	bool Lookup(uint32_t addr, uint32_t &idle);
+	void Run();
+
+public:
+	// query, if not NULL, is called on the service thread for every address queried
+	VerificationService(AttackFirewall &firewall, QueryFunction query, StatsFunction stats);
+	~VerificationService();
+
+	VerificationService(const VerificationService&) = delete;
+	VerificationService &operator=(const VerificationService&) = delete;
+
+	// Binds the loopback port and starts the service thread
+	bool Start(uint16_t port);
+
+	void Stop();
+};
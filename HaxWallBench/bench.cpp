@@ -0,0 +1,267 @@
+// HaxWallBench: replays packet traces through AttackFirewall and reports the cost per packet
+//
+// Builds with the HaxWallBench project, or without Windows headers, e.g.
+//   g++ -O2 -std=c++14 -pthread -IHaxWall HaxWallBench/bench.cpp HaxWallBench/matcher_bench.cpp -o haxwall-bench
+// Usage: HaxWallBench [--worker] [--trace file [--blacklist]] [scenario ...] [matchers]
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#ifdef _WIN32
+#define NOMINMAX
+#include <Windows.h>
+#include <Psapi.h>
+#pragma comment(lib, "Psapi.lib")
+#else
+#include <sys/resource.h>
+#endif
+#include "bench.h"
+#include "trace.h"
+#include "haxball_whitelist.h"
+
+#define BENCH_SECONDS 60 // simulated duration of the generated traces
+#define BENCH_BATCH 64 // packets per receive batch, the clock is set and the timers advance once per batch
+#define BENCH_SPOOFED_RATE 50000 // packets per second
+#define BENCH_DATA_CENTER_RATE 20000 // packets per second
+#define BENCH_ALIGNMENT 64 // every allocation is aligned like the shards, new does not honor alignas before C++17
+
+// Allocation accounting, every block carries its size in a header in front of it
+static std::atomic<uint64_t> allocations(0);
+static std::atomic<uint64_t> allocated_bytes(0);
+static std::atomic<int64_t> live_bytes(0);
+static std::atomic<int64_t> peak_live_bytes(0);
+
+void *operator new(size_t size)
+{
+	void *block;
+#ifdef _WIN32
+	block = _aligned_malloc(size + BENCH_ALIGNMENT, BENCH_ALIGNMENT);
+#else
+	if (posix_memalign(&block, BENCH_ALIGNMENT, size + BENCH_ALIGNMENT) != 0)
+	{
+		block = NULL;
+	}
+#endif
+	if (block == NULL)
+	{
+		throw std::bad_alloc();
+	}
+	*(size_t*)block = size;
+	allocations.fetch_add(1, std::memory_order_relaxed);
+	allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+	int64_t live = live_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+	int64_t peak = peak_live_bytes.load(std::memory_order_relaxed);
+	while (live > peak && !peak_live_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+	{
+	}
+	return (char*)block + BENCH_ALIGNMENT;
+}
+
+void operator delete(void *memory) noexcept
+{
+	if (memory == NULL)
+	{
+		return;
+	}
+	void *block = (char*)memory - BENCH_ALIGNMENT;
+	live_bytes.fetch_sub(*(size_t*)block, std::memory_order_relaxed);
+#ifdef _WIN32
+	_aligned_free(block);
+#else
+	free(block);
+#endif
+}
+
+void *operator new[](size_t size)
+{
+	return operator new(size);
+}
+
+void operator delete[](void *memory) noexcept
+{
+	operator delete(memory);
+}
+
+int64_t HeapBytes()
+{
+	return live_bytes.load();
+}
+
+// Peak working set of the whole process in bytes
+static uint64_t PeakProcessMemory()
+{
+#ifdef _WIN32
+	PROCESS_MEMORY_COUNTERS counters;
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+	{
+		return counters.PeakWorkingSetSize;
+	}
+	return 0;
+#else
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+	return (uint64_t)usage.ru_maxrss * 1024;
+#endif
+}
+
+// Mocked packet filter, only the calls are counted
+static std::atomic<uint64_t> ban_calls(0);
+static std::atomic<uint64_t> unban_calls(0);
+static std::atomic<uint64_t> events(0);
+
+void MockBan(uint32_t addr)
+{
+	ban_calls++;
+}
+
+void MockUnban(uint32_t addr)
+{
+	unban_calls++;
+}
+
+void MockReconcile(const uint32_t *add, size_t add_count, const uint32_t *remove, size_t remove_count)
+{
+	ban_calls += add_count;
+	unban_calls += remove_count;
+}
+
+void MockEvent(JournalEvent event, BanReason reason, uint32_t addr, uint16_t port)
+{
+	events++;
+}
+
+struct Scenario
+{
+	const char *name;
+	Trace(*generate)();
+	bool blacklist;
+};
+
+static const Scenario scenarios[] = {
+	{ "legitimate", []() { return LegitimateTrace(BENCH_SECONDS); }, false },
+	{ "spoofed", []() { return SpoofedTrace(BENCH_SECONDS, BENCH_SPOOFED_RATE); }, false },
+	{ "multiport", []() { return MultiportTrace(BENCH_SECONDS); }, false },
+	{ "flood", []() { return FloodTrace(BENCH_SECONDS); }, false },
+	{ "datacenter", []() { return DataCenterTrace(BENCH_SECONDS, BENCH_DATA_CENTER_RATE); }, true },
+};
+
+static void PrintHeader(bool worker)
+{
+	std::cout << "Replaying in batches of " << BENCH_BATCH << " packets" << (worker ? " through the ban worker" : "") << "." << std::endl;
+	std::cout << std::left << std::setw(12) << "scenario" << std::right << std::setw(10) << "packets" << std::setw(10) << "ns/packet" <<
+		std::setw(10) << "allocs" << std::setw(12) << "alloc_kb" << std::setw(12) << "heap_kb" << std::setw(9) << "clients" <<
+		std::setw(9) << "bans" << std::setw(9) << "unbans" << std::setw(10) << "events" << std::endl;
+}
+
+// Feeds the trace in receive batches like the capture threads do, with the clock taken from the trace
+static void Replay(const char *name, const Trace &trace, bool blacklist, bool worker)
+{
+	static bool header = false;
+	if (!header)
+	{
+		PrintHeader(worker);
+		header = true;
+	}
+	ban_calls = 0;
+	unban_calls = 0;
+	events = 0;
+	int64_t live_before = live_bytes.load();
+	peak_live_bytes.store(live_before);
+
+	// Constructed in place, new does not honor the alignment of the shards before C++17
+	alignas(AttackFirewall) static unsigned char storage[sizeof(AttackFirewall)];
+	AttackFirewall *fw = new (storage) AttackFirewall(MockBan, MockUnban, NULL, false);
+	fw->SetEventFunction(MockEvent);
+	if (worker)
+	{
+		fw->SetReconcileFunction(MockReconcile);
+	}
+	fw->SetBlacklist(blacklist ? &DataCenters : NULL, &HaxBallMatcher);
+
+	uint64_t allocations_before = allocations.load();
+	uint64_t bytes_before = allocated_bytes.load();
+	auto start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < trace.size(); i += BENCH_BATCH)
+	{
+		fw->SetClock(trace[i].time);
+		fw->ReceiveBatch(&trace[i], std::min<size_t>(BENCH_BATCH, trace.size() - i));
+		fw->ClearOldEntries();
+	}
+	auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+	uint64_t replay_allocations = allocations.load() - allocations_before;
+	uint64_t replay_bytes = allocated_bytes.load() - bytes_before;
+	size_t clients = fw->ClientCount();
+
+	// Bans still queued for the worker at this point are not counted, nor are the unbans at shutdown
+	uint64_t bans = ban_calls.load();
+	uint64_t unbans = unban_calls.load();
+	fw->~AttackFirewall();
+
+	std::cout << std::left << std::setw(12) << name << std::right << std::setw(10) << trace.size() <<
+		std::setw(10) << std::fixed << std::setprecision(1) << (trace.empty() ? 0.0 : (double)elapsed / trace.size()) <<
+		std::setw(10) << replay_allocations << std::setw(12) << replay_bytes / 1024 <<
+		std::setw(12) << (peak_live_bytes.load() - live_before) / 1024 << std::setw(9) << clients <<
+		std::setw(9) << bans << std::setw(9) << unbans << std::setw(10) << events.load() << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+	bool worker = false;
+	bool blacklist = false;
+	const char *trace_path = NULL;
+	std::vector<std::string> selected;
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--worker") == 0)
+		{
+			worker = true;
+		}
+		else if (strcmp(argv[i], "--blacklist") == 0)
+		{
+			blacklist = true;
+		}
+		else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc)
+		{
+			trace_path = argv[++i];
+		}
+		else
+		{
+			selected.push_back(argv[i]);
+		}
+	}
+
+	if (trace_path != NULL)
+	{
+		Trace trace;
+		if (!LoadTrace(trace_path, trace))
+		{
+			std::cerr << "Failed to read trace " << trace_path << "." << std::endl;
+			return 1;
+		}
+		Replay("trace", trace, blacklist, worker);
+	}
+	for (size_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++)
+	{
+		if (trace_path != NULL && selected.empty())
+		{
+			break;
+		}
+		if (!selected.empty() && std::find(selected.begin(), selected.end(), scenarios[i].name) == selected.end())
+		{
+			continue;
+		}
+		Trace trace = scenarios[i].generate();
+		Replay(scenarios[i].name, trace, scenarios[i].blacklist, worker);
+	}
+	if (selected.empty() ? trace_path == NULL : std::find(selected.begin(), selected.end(), "matchers") != selected.end())
+	{
+		RunMatcherBenchmarks();
+	}
+	std::cout << "Peak process memory: " << PeakProcessMemory() / 1024 << " KB." << std::endl;
+	return 0;
+}
@@ -0,0 +1,10 @@
+#pragma once
+// Shared by the benchmark translation units
+
+#include <cstdint>
+
+// Bytes currently allocated through operator new, see bench.cpp
+int64_t HeapBytes();
+
+// Lookup throughput, build time and memory of the CIDR matchers, see matcher_bench.cpp
+void RunMatcherBenchmarks();
@@ -0,0 +1,173 @@
+// Micro-benchmarks of the CIDR matcher engines and the special address filter on the data center list
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include "bench.h"
+#include "trace.h"
+#include "haxball_whitelist.h"
+#include "data_centers.h"
+
+#define MATCHER_ADDRESSES (1 << 20) // addresses per distribution, larger than the caches like real sources
+#define MATCHER_PASSES 4 // lookups per address and measurement
+#define MATCHER_CLUSTER 256 // clustered addresses lie within this distance of a range boundary
+#define MATCHER_RETURNING 4096 // distinct sources of the returning distribution
+
+static const int data_center_count = sizeof(data_centers) / sizeof(data_centers[0]);
+
+struct AddressSet
+{
+	const char *name;
+	std::vector<uint32_t> addrs;
+};
+
+static std::vector<AddressSet> Distributions()
+{
+	TraceRandom random(21);
+	std::vector<AddressSet> sets;
+
+	AddressSet uniform = { "uniform" };
+	AddressSet clustered = { "clustered" }; // around range boundaries, about half of them hit
+	AddressSet hits = { "hits" };
+	AddressSet misses = { "misses" }; // the original engine probes all 33 prefixes
+	AddressSet reserved = { "reserved" }; // private and special networks, rejected before any matcher
+	AddressSet returning = { "returning" }; // a few thousand sources seen over and over, half of them data centers
+	std::vector<uint32_t> sources;
+	for (size_t i = 0; i < MATCHER_RETURNING; i++)
+	{
+		const CIDRRange &range = DataCenters.Ranges()[random.Below((uint32_t)DataCenters.Size())];
+		sources.push_back(i % 2 ? random.Address() : range.start + random.Below(range.end - range.start + 1));
+	}
+	for (size_t i = 0; i < MATCHER_ADDRESSES; i++)
+	{
+		uniform.addrs.push_back(random.Next());
+
+		const CIDRRange &near = DataCenters.Ranges()[random.Below((uint32_t)DataCenters.Size())];
+		uint32_t boundary = random.Below(2) ? near.start : near.end;
+		clustered.addrs.push_back(boundary - MATCHER_CLUSTER + random.Below(2 * MATCHER_CLUSTER));
+
+		const CIDRRange &range = DataCenters.Ranges()[random.Below((uint32_t)DataCenters.Size())];
+		hits.addrs.push_back(range.start + random.Below(range.end - range.start + 1));
+
+		misses.addrs.push_back(random.Address());
+
+		static const uint32_t networks[] = { 0x0A000000, 0xAC100000, 0xC0A80000, 0x64400000, 0xE0000000 };
+		static const uint32_t sizes[] = { 1 << 24, 1 << 20, 1 << 16, 1 << 22, 1 << 28 };
+		uint32_t network = random.Below(sizeof(networks) / sizeof(networks[0]));
+		reserved.addrs.push_back(networks[network] + random.Below(sizes[network]));
+
+		returning.addrs.push_back(sources[random.Below(MATCHER_RETURNING)]);
+	}
+	sets.push_back(std::move(uniform));
+	sets.push_back(std::move(clustered));
+	sets.push_back(std::move(hits));
+	sets.push_back(std::move(misses));
+	sets.push_back(std::move(reserved));
+	sets.push_back(std::move(returning));
+	return sets;
+}
+
+template <typename Lookup>
+static void MeasureLookups(const char *engine, const AddressSet &set, Lookup lookup)
+{
+	size_t matches = 0;
+	auto start = std::chrono::steady_clock::now();
+	for (int pass = 0; pass < MATCHER_PASSES; pass++)
+	{
+		for (size_t i = 0; i < set.addrs.size(); i++)
+		{
+			matches += lookup(set.addrs[i]) ? 1 : 0;
+		}
+	}
+	auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+	double lookups = (double)set.addrs.size() * MATCHER_PASSES;
+	std::cout << std::left << std::setw(16) << engine << std::setw(12) << set.name << std::right <<
+		std::setw(12) << std::fixed << std::setprecision(2) << elapsed / lookups <<
+		std::setw(10) << std::setprecision(1) << 100.0 * matches / lookups << std::endl;
+}
+
+// The batch classifier with the HaxBall ranges, the alternative to IsSpecialAddress on the capture path
+static void MeasureClassifier(const BatchClassifier &classifier, const AddressSet &set)
+{
+	AddressClass classes[BATCH_CLASSIFIER_SIZE];
+	size_t matches = 0;
+	auto start = std::chrono::steady_clock::now();
+	for (int pass = 0; pass < MATCHER_PASSES; pass++)
+	{
+		for (size_t i = 0; i + BATCH_CLASSIFIER_SIZE <= set.addrs.size(); i += BATCH_CLASSIFIER_SIZE)
+		{
+			classifier.Classify(&set.addrs[i], BATCH_CLASSIFIER_SIZE, classes);
+			for (size_t j = 0; j < BATCH_CLASSIFIER_SIZE; j++)
+			{
+				matches += classes[j] == AddressClass::Special ? 1 : 0;
+			}
+		}
+	}
+	auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+	double lookups = (double)set.addrs.size() * MATCHER_PASSES;
+	std::cout << std::left << std::setw(16) << "classifier" << std::setw(12) << set.name << std::right <<
+		std::setw(12) << std::fixed << std::setprecision(2) << elapsed / lookups <<
+		std::setw(10) << std::setprecision(1) << 100.0 * matches / lookups << std::endl;
+}
+
+static void PrintBuild(const char *engine, double milliseconds, int64_t bytes, size_t entries)
+{
+	std::cout << std::left << std::setw(16) << engine << std::right << std::setw(12) << std::fixed << std::setprecision(2) <<
+		milliseconds << std::setw(12) << bytes / 1024 << std::setw(10) << entries << std::endl;
+}
+
+// Builds an engine from the unmerged list and reports its construction time and heap usage
+template <typename Matcher>
+static Matcher *Build(double &milliseconds, int64_t &bytes)
+{
+	int64_t heap_before = HeapBytes();
+	auto start = std::chrono::steady_clock::now();
+	Matcher *matcher = new Matcher(data_centers, data_center_count);
+	milliseconds = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count() / 1000.0;
+	bytes = HeapBytes() - heap_before;
+	return matcher;
+}
+
+void RunMatcherBenchmarks()
+{
+	std::cout << "Data center list: " << data_center_count << " networks, " << DataCenters.Size() << " merged ranges." << std::endl;
+	std::cout << std::left << std::setw(16) << "engine" << std::right << std::setw(12) << "build_ms" << std::setw(12) << "memory_kb" <<
+		std::setw(10) << "entries" << std::endl;
+
+	// The generated table is constant data, nothing is built at runtime
+	PrintBuild("range_table", 0, DataCenters.Size() * sizeof(CIDRRange), DataCenters.Size());
+	double milliseconds;
+	int64_t bytes;
+	std::unique_ptr<CIDRRangeSet> range_set(Build<CIDRRangeSet>(milliseconds, bytes));
+	PrintBuild("range_set", milliseconds, bytes, range_set->Size());
+	std::unique_ptr<CIDRHashMatcher> hash(Build<CIDRHashMatcher>(milliseconds, bytes));
+	PrintBuild("hash", milliseconds, bytes, data_center_count);
+
+	BatchClassifier classifier;
+	classifier.SetWhitelistRanges(HaxBallMatcher.Ranges(), HaxBallMatcher.Size());
+
+	std::unique_ptr<VerdictCache> verdicts(new VerdictCache());
+
+	std::vector<AddressSet> sets = Distributions();
+	std::cout << std::left << std::setw(16) << "engine" << std::setw(12) << "addresses" << std::right << std::setw(12) << "ns/lookup" <<
+		std::setw(10) << "match_%" << std::endl;
+	for (size_t i = 0; i < sets.size(); i++)
+	{
+		MeasureLookups("special", sets[i], [](uint32_t addr) { return AttackFirewall::IsSpecialAddress(addr); });
+		MeasureClassifier(classifier, sets[i]);
+		MeasureLookups("range_table", sets[i], [](uint32_t addr) { return DataCenters.Contains(addr); });
+		MeasureLookups("cached_table", sets[i], [&verdicts](uint32_t addr)
+		{
+			uint8_t flags;
+			if (!verdicts->Lookup(addr, flags))
+			{
+				flags = DataCenters.Contains(addr) ? VerdictBlacklisted : 0;
+				verdicts->Store(addr, flags, verdicts->Generation());
+			}
+			return flags != 0;
+		});
+		MeasureLookups("range_set", sets[i], [&range_set](uint32_t addr) { return range_set->Contains(addr); });
+		MeasureLookups("hash", sets[i], [&hash](uint32_t addr) { return hash->Contains(addr); });
+	}
+}
@@ -0,0 +1,192 @@
+#pragma once
+// Packet traces replayed by the benchmark, generated or loaded from a capture
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "ban.h"
+
+struct TracePacket
+{
+	uint32_t saddr; // host byte order
+	uint16_t sport;
+	tick_t time; // milliseconds since the start of the trace
+	uint16_t dport; // selects the policy profile, 0 in generated traces
+};
+
+typedef std::vector<TracePacket> Trace;
+
+// xorshift64*, traces are the same on every run and platform
+class TraceRandom
+{
+private:
+	uint64_t state;
+
+public:
+	TraceRandom(uint64_t seed) : state(seed ? seed : 1)
+	{
+	}
+
+	uint32_t Next()
+	{
+		state ^= state >> 12;
+		state ^= state << 25;
+		state ^= state >> 27;
+		return (uint32_t)((state * 2685821657736338717ull) >> 32);
+	}
+
+	uint32_t Below(uint32_t bound)
+	{
+		return (uint32_t)(((uint64_t)Next() * bound) >> 32);
+	}
+
+	uint16_t Port()
+	{
+		return (uint16_t)(1024 + Below(65536 - 1024));
+	}
+
+	// Public unicast address that passes the special address filter
+	uint32_t Address()
+	{
+		for (;;)
+		{
+			uint32_t addr = Next();
+			if (!AttackFirewall::IsSpecialAddress(addr) && !DataCenters.Contains(addr))
+			{
+				return addr;
+			}
+		}
+	}
+};
+
+// A fixed population of clients sending at the given rate, packets are spread evenly over the duration
+inline void AddClients(Trace &trace, TraceRandom &random, const std::vector<uint32_t> &clients, uint32_t ports,
+	uint32_t packets_per_second, uint32_t seconds)
+{
+	std::vector<uint16_t> client_ports(clients.size() * ports);
+	for (size_t i = 0; i < client_ports.size(); i++)
+	{
+		client_ports[i] = random.Port();
+	}
+	uint64_t total = (uint64_t)clients.size() * packets_per_second * seconds;
+	for (uint64_t i = 0; i < total; i++)
+	{
+		size_t client = (size_t)(i % clients.size());
+		uint16_t port = client_ports[client * ports + (size_t)((i / clients.size()) % ports)];
+		trace.push_back(TracePacket{ clients[client], port, (tick_t)(i * SECONDS_TO_TICKS(seconds) / total), 0 });
+	}
+}
+
+inline void SortTrace(Trace &trace)
+{
+	std::stable_sort(trace.begin(), trace.end(), [](const TracePacket &a, const TracePacket &b)
+	{
+		return a.time < b.time;
+	});
+}
+
+inline std::vector<uint32_t> RandomClients(TraceRandom &random, size_t count)
+{
+	std::vector<uint32_t> clients(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		clients[i] = random.Address();
+	}
+	return clients;
+}
+
+// Regular room traffic: a few hundred players, each on one port well below the flood limit
+inline Trace LegitimateTrace(uint32_t seconds)
+{
+	TraceRandom random(1);
+	Trace trace;
+	AddClients(trace, random, RandomClients(random, 500), 1, MAX_PACKETS / MAX_PACKET_FRAME / 4, seconds);
+	return trace;
+}
+
+// Every packet comes from a new random source, the worst case for table inserts and timers
+inline Trace SpoofedTrace(uint32_t seconds, uint32_t packets_per_second)
+{
+	TraceRandom random(2);
+	Trace trace;
+	uint64_t total = (uint64_t)packets_per_second * seconds;
+	trace.reserve((size_t)total);
+	for (uint64_t i = 0; i < total; i++)
+	{
+		trace.push_back(TracePacket{ random.Next(), random.Port(), (tick_t)(i * SECONDS_TO_TICKS(seconds) / total), 0 });
+	}
+	return trace;
+}
+
+// Join spam: sources cycling through more ports than allowed, banned and coming back after the ban
+inline Trace MultiportTrace(uint32_t seconds)
+{
+	TraceRandom random(3);
+	Trace trace;
+	AddClients(trace, random, RandomClients(random, 200), 1, MAX_PACKETS / MAX_PACKET_FRAME / 4, seconds);
+	AddClients(trace, random, RandomClients(random, 5000), MAX_PORTS + 2, 10, seconds);
+	SortTrace(trace);
+	return trace;
+}
+
+// A handful of heavy flooders hidden in regular room traffic
+inline Trace FloodTrace(uint32_t seconds)
+{
+	TraceRandom random(4);
+	Trace trace;
+	AddClients(trace, random, RandomClients(random, 500), 1, MAX_PACKETS / MAX_PACKET_FRAME / 4, seconds);
+	AddClients(trace, random, RandomClients(random, 8), 1, 20000, seconds);
+	SortTrace(trace);
+	return trace;
+}
+
+// Sources spread over the data center list, for runs with the blacklist enabled
+inline Trace DataCenterTrace(uint32_t seconds, uint32_t packets_per_second)
+{
+	TraceRandom random(5);
+	Trace trace;
+	uint64_t total = (uint64_t)packets_per_second * seconds;
+	trace.reserve((size_t)total);
+	for (uint64_t i = 0; i < total; i++)
+	{
+		const CIDRRange &range = DataCenters.Ranges()[random.Below((uint32_t)DataCenters.Size())];
+		uint32_t addr = range.start + random.Below(range.end - range.start + 1);
+		trace.push_back(TracePacket{ addr, random.Port(), (tick_t)(i * SECONDS_TO_TICKS(seconds) / total), 0 });
+	}
+	return trace;
+}
+
+// Reads "<seconds> <a.b.c.d> <port> [<destination port>]" lines, e.g. from
+// tshark -r capture.pcap -T fields -e frame.time_relative -e ip.src -e udp.srcport -e udp.dstport udp
+inline bool LoadTrace(const char *path, Trace &trace)
+{
+	std::ifstream file(path);
+	if (!file.is_open())
+	{
+		return false;
+	}
+	std::string line;
+	while (std::getline(file, line))
+	{
+		std::istringstream fields(line);
+		double seconds;
+		unsigned int b1, b2, b3, b4, port;
+		char d1, d2, d3;
+		if (!(fields >> seconds >> b1 >> d1 >> b2 >> d2 >> b3 >> d3 >> b4 >> port) || d1 != '.' || d2 != '.' || d3 != '.')
+		{
+			continue; // Header or a packet without a UDP source
+		}
+		unsigned int dport;
+		if (!(fields >> dport))
+		{
+			dport = 0;
+		}
+		uint32_t addr = (b1 & 0xFF) << 24 | (b2 & 0xFF) << 16 | (b3 & 0xFF) << 8 | (b4 & 0xFF);
+		trace.push_back(TracePacket{ addr, (uint16_t)port, SECONDS_TO_TICKS(seconds), (uint16_t)dport });
+	}
+	SortTrace(trace);
+	return true;
+}
@@ -0,0 +1,52 @@
+#!/usr/bin/python
+# Builds a range list file that HaxWall maps at runtime from the lists directory.
+# The input is either a text file with one a.b.c.d/prefix network per line or a
+# header with {network, prefix} entries such as HaxWall/data_centers.h. Copy the
+# output into the lists directory under a temporary name and rename it to
+# <prefix>-<version>.hxl, e.g. data_centers-20240101.hxl, once it is complete.
+#
+# Usage: python scripts/build_list.py <networks.txt|data_centers.h> <output.hxl>
+import re
+import socket
+import struct
+import sys
+
+from generate_ranges import to_ranges
+
+MAGIC = 0x314C5848 # "HXL1", LIST_MAGIC in HaxWall/range_list.h
+VERSION = 1
+RECORD_SIZE = 8
+
+def parse(path):
+    with open(path) as f:
+        content = f.read()
+    entries = re.findall(r"\{\s*(\d+)\s*,\s*(\d+)\s*\}", content)
+    if entries:
+        return [(int(n), int(p)) for n, p in entries]
+    networks = []
+    for line in content.splitlines():
+        line = line.split("#")[0].strip()
+        if not line:
+            continue
+        address, _, prefix = line.partition("/")
+        network = struct.unpack("!I", socket.inet_aton(address))[0]
+        networks.append((network, int(prefix) if prefix else 32))
+    return networks
+
+def write(path, ranges):
+    with open(path, "wb") as f:
+        f.write(struct.pack("<IHHII", MAGIC, VERSION, RECORD_SIZE, len(ranges), 0))
+        for start, end in ranges:
+            f.write(struct.pack("<II", start, end))
+
+def main():
+    if len(sys.argv) != 3:
+        print("Usage: python scripts/build_list.py <networks.txt|data_centers.h> <output.hxl>")
+        sys.exit(1)
+    networks = parse(sys.argv[1])
+    ranges = to_ranges(networks)
+    write(sys.argv[2], ranges)
+    print("%d networks merged into %d ranges." % (len(networks), len(ranges)))
+
+if __name__ == "__main__":
+    main()
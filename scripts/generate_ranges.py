@@ -0,0 +1,60 @@
+#!/usr/bin/python
+# Generates HaxWall/data_center_ranges.h from HaxWall/data_centers.h.
+# The CIDR list is converted into sorted, merged and non-overlapping
+# [start, end] ranges so that the firewall can search a constant table
+# without building anything at startup.
+#
+# Usage: python scripts/generate_ranges.py [data_centers.h] [data_center_ranges.h]
+import os
+import re
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "HaxWall")
+SOURCE = os.path.join(ROOT, "data_centers.h")
+TARGET = os.path.join(ROOT, "data_center_ranges.h")
+PER_LINE = 8
+
+def parse(path):
+    with open(path) as f:
+        content = f.read()
+    return [(int(n), int(p)) for n, p in re.findall(r"\{\s*(\d+)\s*,\s*(\d+)\s*\}", content)]
+
+def to_ranges(networks):
+    ranges = []
+    for network, prefix in networks:
+        if prefix > 32:
+            continue
+        host = (0xFFFFFFFF >> prefix) if prefix < 32 else 0
+        if network & host:
+            # Networks with host bits set never match, see CIDRRangeSet
+            continue
+        ranges.append((network, network | host))
+    ranges.sort()
+
+    merged = []
+    for start, end in ranges:
+        if merged and start <= merged[-1][1] + 1:
+            merged[-1][1] = max(merged[-1][1], end)
+        else:
+            merged.append([start, end])
+    return merged
+
+def write(path, ranges, source):
+    with open(path, "w") as f:
+        f.write("// Generated by scripts/generate_ranges.py from %s. Do not edit.\n" % os.path.basename(source))
+        f.write("const CIDRRange data_center_ranges[] = {\n")
+        for i in range(0, len(ranges), PER_LINE):
+            chunk = ranges[i:i + PER_LINE]
+            f.write("\t" + ",".join("{%d,%d}" % (s, e) for s, e in chunk) + ",\n")
+        f.write("};\n")
+
+def main():
+    source = sys.argv[1] if len(sys.argv) > 1 else SOURCE
+    target = sys.argv[2] if len(sys.argv) > 2 else TARGET
+    networks = parse(source)
+    ranges = to_ranges(networks)
+    write(target, ranges, source)
+    print("%d networks merged into %d ranges." % (len(networks), len(ranges)))
+
+if __name__ == "__main__":
+    main()
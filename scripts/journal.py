@@ -0,0 +1,91 @@
+#!/usr/bin/python
+# Reads the binary event journal written by HaxWall (see HaxWall/journal.h).
+#
+# Usage: python scripts/journal.py [--dir journal] [--addr 1.2.3.4] [--event ban]
+#                                  [--since "2020-01-01 12:00"] dump|top|bans
+#   dump  prints every matching record
+#   top   lists the addresses with the most records
+#   bans  counts bans per minute and reason
+import argparse
+import collections
+import datetime
+import glob
+import os
+import socket
+import struct
+import time
+
+MAGIC = 0x314A5848
+HEADER = struct.Struct("<IHHIIQ40x")
+RECORD = struct.Struct("<QIHBB")
+EVENTS = ["none", "first_packet", "reappearance", "whitelist", "ban", "unban", "query", "protecting"]
+REASONS = ["", "blacklist", "multiport", "flood", "restored"]
+
+def segments(directory):
+    def key(path):
+        started, sequence = os.path.splitext(os.path.basename(path))[0].split("-")
+        return int(started), int(sequence)
+    return sorted(glob.glob(os.path.join(directory, "*.hxj")), key=key)
+
+def records(path):
+    with open(path, "rb") as f:
+        header = f.read(HEADER.size)
+        if len(header) < HEADER.size:
+            return
+        magic, version, record_size, sequence, capacity, created = HEADER.unpack(header)
+        if magic != MAGIC or record_size != RECORD.size:
+            raise ValueError("%s is not a journal segment" % path)
+        while True:
+            data = f.read(RECORD.size * 4096)
+            for offset in range(0, len(data) - RECORD.size + 1, RECORD.size):
+                record = RECORD.unpack_from(data, offset)
+                if record[0] == 0:
+                    return # Rest of a segment that was not closed
+                yield record
+            if len(data) < RECORD.size * 4096:
+                return
+
+def address(value):
+    return socket.inet_ntoa(struct.pack("!I", value))
+
+def timestamp(ms):
+    return datetime.datetime.fromtimestamp(ms / 1000.0)
+
+def main():
+    parser = argparse.ArgumentParser(description="HaxWall event journal reader")
+    parser.add_argument("command", choices=["dump", "top", "bans"])
+    parser.add_argument("--dir", default="journal")
+    parser.add_argument("--addr")
+    parser.add_argument("--event", choices=EVENTS)
+    parser.add_argument("--since", help="local time, YYYY-MM-DD HH:MM")
+    parser.add_argument("--limit", type=int, default=20, help="rows of the top command")
+    args = parser.parse_args()
+
+    since = 0
+    if args.since:
+        since = int(time.mktime(datetime.datetime.strptime(args.since, "%Y-%m-%d %H:%M").timetuple()) * 1000)
+    addr = struct.unpack("!I", socket.inet_aton(args.addr))[0] if args.addr else None
+    event = EVENTS.index(args.event) if args.event else None
+
+    talkers = collections.Counter()
+    bans = collections.Counter()
+    for path in segments(args.dir):
+        for ms, source, port, kind, reason in records(path):
+            if ms < since or (addr is not None and source != addr) or (event is not None and kind != event):
+                continue
+            if args.command == "dump":
+                print("%s %-13s %-9s %s:%d" % (timestamp(ms).strftime("%Y-%m-%d %H:%M:%S.%f")[:-3], EVENTS[kind], REASONS[reason], address(source), port))
+            elif args.command == "top":
+                talkers[source] += 1
+            elif kind == EVENTS.index("ban"):
+                bans[(timestamp(ms).strftime("%Y-%m-%d %H:%M"), REASONS[reason])] += 1
+
+    if args.command == "top":
+        for source, count in talkers.most_common(args.limit):
+            print("%-15s %d" % (address(source), count))
+    elif args.command == "bans":
+        for (minute, reason), count in sorted(bans.items()):
+            print("%s %-9s %d" % (minute, reason, count))
+
+if __name__ == "__main__":
+    main()
@@ -1,4 +1,5 @@
 #!/usr/bin/python
+import random
 import socket
 import struct
 
@@ -6,17 +7,57 @@ EP = ("127.0.0.1", 1337,)
 sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
 sock.settimeout(1)
 
+VERSION = 1
+MAX_ADDRESSES = 256 # per datagram, see verification.h
+IDLE_UNKNOWN = 0xFFFFFFFF
+
+def verify_many(ips):
+    """Returns {ip: idle milliseconds or None if the firewall has not seen it}."""
+    result = {}
+    for start in range(0, len(ips), MAX_ADDRESSES):
+        chunk = ips[start:start + MAX_ADDRESSES]
+        request_id = random.randint(0, 0xFFFF)
+        request = struct.pack("!2sBBHH", b"HV", VERSION, ord("Q"), request_id, len(chunk))
+        request += b"".join(socket.inet_aton(ip) for ip in chunk)
+        try:
+            sock.sendto(request, EP)
+            while True:
+                reply = sock.recv(0xFFFF)
+                magic, version, opcode, reply_id, count = struct.unpack("!2sBBHH", reply[:8])
+                if magic == b"HV" and reply_id == request_id:
+                    break
+        except (socket.error, OSError):
+            # No answer or the port is closed (timeouts and resets included),
+            # do not reject players because of the firewall
+            result.update((ip, 0) for ip in chunk)
+            continue
+        if version != VERSION or count != len(chunk):
+            raise RuntimeError("firewall speaks verification protocol version %d" % version)
+        bitmap = bytearray(reply[8:8 + (count + 7) // 8]) # indexes to ints on Python 2 as well
+        idle = struct.unpack("!%dI" % count, reply[8 + len(bitmap):])
+        for i, ip in enumerate(chunk):
+            active = bitmap[i // 8] & (1 << (i % 8))
+            result[ip] = idle[i] if active and idle[i] != IDLE_UNKNOWN else None
+    return result
+
 def verify(ip):
-    octets = [int(x) for x in ip.split(".")]
-    packed = struct.pack("!BBBB", *octets)
-    sock.sendto(packed, EP)
+    return verify_many([ip])[ip] is not None
+
+def stats():
+    sock.sendto(b"S", EP)
     try:
-        result = sock.recv(1)
+        return sock.recv(0xFFFF).decode()
     except:
-        return True
-    return result != b'\x00'
+        return None
 
 # The following function call verifies whether the firewall
 # has indeed seen packets from 8.8.8.8. If not, this is an
 # indicator for a precomputed fake signature (anti-ban).
 # verify("8.8.8.8")
+
+# Checks a whole room at once and returns how long ago each
+# address sent its last packet, in milliseconds.
+# verify_many(["8.8.8.8", "1.1.1.1"])
+
+# Prints the packet, ban and latency counters of the firewall.
+# print(stats())